@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= (- 14) a)))
+(assert (and true))
+(assert (not (and true (<= (- (/ 17765732 7371225)) (^ a (/ 1.0 3.0))))))
+(check-sat)
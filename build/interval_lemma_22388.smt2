@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= 4 a)))
+(assert (and true))
+(assert (not (and true (<= (/ 1871025303622500 1178684919384361) (^ a (/ 1.0 3.0))))))
+(check-sat)
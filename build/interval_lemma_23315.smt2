@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= a 18)))
+(assert (and true))
+(assert (not (and true (<= (^ a (/ 1.0 3.0)) (/ 1333471782030674588268989973348476971 508814713023373491156244309312141128)))))
+(check-sat)
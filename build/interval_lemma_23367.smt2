@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (< a 3)))
+(assert (and true))
+(assert (not (and true (<= (^ a (/ 1.0 3.0)) (/ 3643011739493436460308811 2525922878107219185690225)))))
+(check-sat)
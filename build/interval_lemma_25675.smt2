@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (< a 2)))
+(assert (and true (<= 1 b)))
+(assert (not (and true (< (/ a b) 2))))
+(check-sat)
@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (< (- 1) a) (< a 3)))
+(assert (and true))
+(assert (not (and true (< (* a a) 9))))
+(check-sat)
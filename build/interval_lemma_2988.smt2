@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= (- 6) a)))
+(assert (and true))
+(assert (not (and true (<= (- (/ 51548671674137615362187301993231158665164896234819816031062650219100645272433 28368325884051020032360826097821664176098720094041245477998243083726189521228)) (^ a (/ 1.0 3.0))))))
+(check-sat)
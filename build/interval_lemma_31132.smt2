@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (< (- 3) a)))
+(assert (and true))
+(assert (not (and true (< (- 27) (* a a a)))))
+(check-sat)
@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= a (- 7))))
+(assert (and true))
+(assert (not (and true (<= (^ a (/ 1.0 3.0)) (- (/ 852107883547887065607461628650307586641279139170715509101020386331829005278239155564804753175601177367412727 445446577195967628293812062807878260182262241639959680476012041428547670783680160853148727736125200110537889))))))
+(check-sat)
@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= (- 1) a) (<= a (- 1))))
+(assert (and true (<= (- 3) b)))
+(assert (not (and true (<= (* a b) 3))))
+(check-sat)
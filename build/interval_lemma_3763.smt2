@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (< a (- 3))))
+(assert (and true))
+(assert (not (and true (<= (^ a (/ 1.0 3.0)) (- (/ 19140859158436373016607305152145524848228981651875 13271534534086993755954691616626746813393484233721))))))
+(check-sat)
@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= (- 5) a)))
+(assert (and true))
+(assert (not (and true (<= (- (/ 3766298507232942588134729480249087484781149755696306155301793393680750032108034019607 2202544723222648996643117278098467154733233736958791653034439656822445092411105451523)) (^ a (/ 1.0 3.0))))))
+(check-sat)
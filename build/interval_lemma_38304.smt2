@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= (- 4) a)))
+(assert (and true (< 2 b)))
+(assert (not (and true (< (- 2) (+ a b)))))
+(check-sat)
@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (< 3 a) (<= a 4)))
+(assert (and true))
+(assert (not (and true (<= (^ a (/ 1.0 2.0)) 2))))
+(check-sat)
@@ -0,0 +1,9 @@
+(set-info :status unsat)
+(set-option :auto-config true)
+(set-option :numeral-as-real true)
+(declare-const a Real)
+(declare-const b Real)
+(assert (and true (<= (- 4) a) (<= a (- 2))))
+(assert (and true))
+(assert (not (and true (<= (/ 1 a) (- (/ 1 4))))))
+(check-sat)
@@ -0,0 +1,25 @@
+// Automatically generated file.
+#include"task_pool.h"
+#include"rational.h"
+#include"debug.h"
+#include"scoped_timer.h"
+#include"prime_generator.h"
+#include"symbol.h"
+#include"gparams.h"
+#include"trace.h"
+void mem_initialize() {
+task_pool::initialize();
+rational::initialize();
+initialize_symbols();
+gparams::init();
+}
+void mem_finalize() {
+task_pool::finalize();
+rational::finalize();
+finalize_debug();
+scoped_timer::finalize();
+prime_iterator::finalize();
+finalize_symbols();
+gparams::finalize();
+finalize_trace();
+}
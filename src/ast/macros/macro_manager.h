@@ -89,6 +89,7 @@ public:
     func_decl * get_macro_func_decl(unsigned i) const { return m_decls.get(i); }
     func_decl * get_macro_interpretation(unsigned i, expr_ref & interp) const;
     quantifier * get_macro_quantifier(func_decl * f) const { quantifier * q = 0; m_decl2macro.find(f, q); return q; }
+    proof * get_macro_proof(func_decl * f) const { proof * pr = 0; m_decl2macro_pr.find(f, pr); return pr; }
     void get_head_def(quantifier * q, func_decl * d, app * & head, expr * & def) const;
     void expand_macros(expr * n, proof * pr, expr_ref & r, proof_ref & new_pr);
     
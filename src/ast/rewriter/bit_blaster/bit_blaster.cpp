@@ -125,4 +125,6 @@ bit_blaster::bit_blaster(ast_manager & m, bit_blaster_params const & params):
     bit_blaster_tpl<bit_blaster_cfg>(bit_blaster_cfg(m_util, params, m_simp)),
     m_util(m),
     m_simp(m) {
+    set_circuit_cache(params.m_bb_circuit_cache);
+    set_encodings(params.m_bb_mul_encoding, params.m_bb_div_encoding);
 }
@@ -0,0 +1,188 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    bit_blaster_cache.cpp
+
+Abstract:
+
+    Cache of bit-blasted circuits for the expensive bit-vector operators.
+
+Author:
+
+Revision History:
+
+--*/
+#include"bit_blaster_cache.h"
+#include"hash.h"
+
+bit_blaster_cache::bit_blaster_cache(ast_manager & m):
+    m_manager(m),
+    m_templates(m),
+    m_cacheable(false),
+    m_slots(m),
+    m_hits(0),
+    m_misses(0) {
+}
+
+bit_blaster_cache::~bit_blaster_cache() {
+    reset();
+}
+
+void bit_blaster_cache::reset() {
+    m_table.reset();
+    std::for_each(m_entries.begin(), m_entries.end(), delete_proc<entry>());
+    m_entries.reset();
+    m_templates.reset();
+    m_atoms.reset();
+    m_atom2idx.reset();
+    m_cacheable = false;
+}
+
+bool bit_blaster_cache::find(op_kind op, unsigned sz, unsigned num_inputs, expr * const * inputs, expr_ref_vector & out) {
+    m_key.m_op = op;
+    m_key.m_sz = sz;
+    m_key.m_signature.reset();
+    m_atoms.reset();
+    m_atom2idx.reset();
+    m_cacheable = true;
+    for (unsigned i = 0; i < num_inputs; i++) {
+        expr * a = inputs[i];
+        bool neg = m().is_not(a, a);
+        if (m().is_true(a) || m().is_false(a)) {
+            m_cacheable = false;
+            return false;
+        }
+        unsigned idx;
+        if (!m_atom2idx.find(a, idx)) {
+            idx = m_atoms.size();
+            m_atoms.push_back(a);
+            m_atom2idx.insert(a, idx);
+        }
+        m_key.m_signature.push_back(2*idx + (neg ? 1 : 0));
+    }
+    m_key.m_num_atoms = m_atoms.size();
+    m_key.m_hash = string_hash(reinterpret_cast<char const *>(m_key.m_signature.c_ptr()),
+                               m_key.m_signature.size() * sizeof(unsigned),
+                               combine_hash(op, sz));
+    entry * e = 0;
+    if (m_table.find(&m_key, e)) {
+        m_hits++;
+        instantiate(*e, out);
+        return true;
+    }
+    m_misses++;
+    return false;
+}
+
+bool bit_blaster_cache::mk_template_inputs(expr_ref_vector & t_inputs) const {
+    if (!m_cacheable)
+        return false;
+    sort * b = m().mk_bool_sort();
+    for (unsigned i = 0; i < m_key.m_signature.size(); i++) {
+        unsigned s = m_key.m_signature[i];
+        expr * v   = m().mk_var(s / 2, b);
+        t_inputs.push_back(s % 2 == 1 ? m().mk_not(v) : v);
+    }
+    return true;
+}
+
+void bit_blaster_cache::insert(expr_ref_vector const & t_outputs, expr_ref_vector & out) {
+    SASSERT(m_cacheable);
+    entry * e = alloc(entry);
+    e->m_op        = m_key.m_op;
+    e->m_sz        = m_key.m_sz;
+    e->m_signature = m_key.m_signature;
+    e->m_hash      = m_key.m_hash;
+    e->m_num_atoms = m_key.m_num_atoms;
+    compile(t_outputs, *e);
+    m_templates.append(t_outputs);
+    m_entries.push_back(e);
+    m_table.insert(e);
+    m_cacheable = false;
+    instantiate(*e, out);
+}
+
+/**
+   \brief Store in e the straight-line program that computes t_outputs.
+*/
+void bit_blaster_cache::compile(expr_ref_vector const & t_outputs, entry & e) {
+    // the slots of the nodes are shifted after all leaves are known.
+    obj_map<expr, unsigned> leaf2slot, node2idx;
+    ptr_buffer<expr> todo;
+    for (unsigned i = 0; i < t_outputs.size(); i++) {
+        todo.push_back(t_outputs.get(i));
+        while (!todo.empty()) {
+            expr * t = todo.back();
+            if (is_var(t) || leaf2slot.contains(t) || node2idx.contains(t)) {
+                todo.pop_back();
+                continue;
+            }
+            app * a = to_app(t);
+            if (a->get_num_args() == 0) {
+                leaf2slot.insert(a, e.m_num_atoms + e.m_leaves.size());
+                e.m_leaves.push_back(a);
+                todo.pop_back();
+                continue;
+            }
+            bool visited = true;
+            for (unsigned j = 0; j < a->get_num_args(); j++) {
+                expr * arg = a->get_arg(j);
+                if (!is_var(arg) && !leaf2slot.contains(arg) && !node2idx.contains(arg)) {
+                    todo.push_back(arg);
+                    visited = false;
+                }
+            }
+            if (visited) {
+                node2idx.insert(a, e.m_nodes.size());
+                e.m_nodes.push_back(a);
+                todo.pop_back();
+            }
+        }
+    }
+    unsigned first_node = e.m_num_atoms + e.m_leaves.size();
+    #define MK_SLOT(T) (is_var(T) ? to_var(T)->get_idx() : (leaf2slot.contains(T) ? leaf2slot.find(T) : first_node + node2idx.find(T)))
+    for (unsigned i = 0; i < e.m_nodes.size(); i++) {
+        app * a = e.m_nodes[i];
+        for (unsigned j = 0; j < a->get_num_args(); j++) {
+            expr * arg = a->get_arg(j);
+            e.m_args.push_back(MK_SLOT(arg));
+        }
+    }
+    for (unsigned i = 0; i < t_outputs.size(); i++) {
+        expr * t = t_outputs.get(i);
+        e.m_outputs.push_back(MK_SLOT(t));
+    }
+    #undef MK_SLOT
+}
+
+/**
+   \brief Append to out the outputs of the template e, where the free variable i is
+   replaced with the i-th atom of the last lookup.
+*/
+void bit_blaster_cache::instantiate(entry const & e, expr_ref_vector & out) {
+    SASSERT(e.m_num_atoms == m_atoms.size());
+    m_slots.reset();
+    m_slots.append(m_atoms.size(), m_atoms.c_ptr());
+    m_slots.append(e.m_leaves.size(), e.m_leaves.c_ptr());
+    unsigned const * args = e.m_args.c_ptr();
+    ptr_buffer<expr> new_args;
+    for (unsigned i = 0; i < e.m_nodes.size(); i++) {
+        app * a = e.m_nodes[i];
+        unsigned num_args = a->get_num_args();
+        new_args.reset();
+        for (unsigned j = 0; j < num_args; j++)
+            new_args.push_back(m_slots.get(args[j]));
+        args += num_args;
+        m_slots.push_back(m().mk_app(a->get_decl(), num_args, new_args.c_ptr()));
+    }
+    for (unsigned i = 0; i < e.m_outputs.size(); i++)
+        out.push_back(m_slots.get(e.m_outputs[i]));
+    m_slots.reset();
+}
+
+void bit_blaster_cache::collect_statistics(statistics & st) const {
+    st.update("bb circuit cache hits", m_hits);
+    st.update("bb circuit cache misses", m_misses);
+}
@@ -0,0 +1,117 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    bit_blaster_cache.h
+
+Abstract:
+
+    Cache of bit-blasted circuits for the expensive bit-vector operators.
+
+    A circuit is stored as a template over Boolean free variables,
+    and it is keyed by the operator, the bit-width, and the structure
+    of the input bits: which input bits are the same atom, and which
+    ones are negated. A cache hit instantiates the template by
+    substituting the input bits for the free variables.
+    Input bits that are true or false are not cached, since the
+    bit-blaster folds them into much smaller circuits.
+
+Author:
+
+Revision History:
+
+--*/
+#ifndef _BIT_BLASTER_CACHE_H_
+#define _BIT_BLASTER_CACHE_H_
+
+#include"ast.h"
+#include"obj_hashtable.h"
+#include"statistics.h"
+
+class bit_blaster_cache {
+public:
+    enum op_kind {
+        BB_MUL,
+        BB_UDIV_UREM,
+        BB_SHL,
+        BB_LSHR,
+        BB_ASHR
+    };
+
+private:
+    /**
+       \brief A template is compiled into a straight-line program. The slots of the
+       program are the atoms (free variables), the leaves (constants), and the
+       results of the nodes, in this order. The arguments of a node and the
+       outputs of the circuit are slot indices.
+    */
+    struct entry {
+        unsigned        m_op;
+        unsigned        m_sz;
+        unsigned_vector m_signature; // per input bit, 2*atom index + 1 if the bit is negated.
+        unsigned        m_hash;
+        unsigned        m_num_atoms;
+        ptr_vector<expr> m_leaves;
+        ptr_vector<app> m_nodes;     // in topological order
+        unsigned_vector m_args;      // arguments of m_nodes, in sequence
+        unsigned_vector m_outputs;
+    };
+
+    struct entry_hash_proc { unsigned operator()(entry const * e) const { return e->m_hash; } };
+    struct entry_eq_proc {
+        bool operator()(entry const * e1, entry const * e2) const {
+            if (e1->m_op != e2->m_op || e1->m_sz != e2->m_sz || e1->m_signature.size() != e2->m_signature.size())
+                return false;
+            for (unsigned i = 0; i < e1->m_signature.size(); i++)
+                if (e1->m_signature[i] != e2->m_signature[i])
+                    return false;
+            return true;
+        }
+    };
+    typedef ptr_hashtable<entry, entry_hash_proc, entry_eq_proc> entry_table;
+
+    ast_manager &        m_manager;
+    entry_table          m_table;
+    ptr_vector<entry>    m_entries;
+    expr_ref_vector      m_templates;   // keep the nodes of the templates alive
+    // key and input atoms of the last lookup
+    entry                m_key;
+    bool                 m_cacheable;
+    ptr_vector<expr>     m_atoms;
+    obj_map<expr, unsigned> m_atom2idx;
+    expr_ref_vector      m_slots;
+    unsigned             m_hits;
+    unsigned             m_misses;
+
+    ast_manager & m() const { return m_manager; }
+    void compile(expr_ref_vector const & t_outputs, entry & e);
+    void instantiate(entry const & e, expr_ref_vector & out);
+
+public:
+    bit_blaster_cache(ast_manager & m);
+    ~bit_blaster_cache();
+
+    /**
+       \brief Return true if the circuit of op for the given input bits is in the cache,
+       and append its output bits to out. Otherwise, the key is kept for mk_template_inputs and insert.
+    */
+    bool find(op_kind op, unsigned sz, unsigned num_inputs, expr * const * inputs, expr_ref_vector & out);
+
+    /**
+       \brief Store in t_inputs the inputs of the template for the key of the last failed lookup.
+       Return false if the inputs of the last lookup cannot be cached.
+    */
+    bool mk_template_inputs(expr_ref_vector & t_inputs) const;
+
+    /**
+       \brief Store the circuit built on the inputs produced by mk_template_inputs, and
+       append its instance for the inputs of the last lookup to out.
+    */
+    void insert(expr_ref_vector const & t_outputs, expr_ref_vector & out);
+
+    void reset();
+    void collect_statistics(statistics & st) const;
+};
+
+#endif /* _BIT_BLASTER_CACHE_H_ */
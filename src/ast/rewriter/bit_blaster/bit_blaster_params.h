@@ -19,12 +19,30 @@ Revision History:
 #ifndef _BIT_BLASTER_PARAMS_H_
 #define _BIT_BLASTER_PARAMS_H_
 
+enum bb_mul_encoding {
+    BB_MUL_ARRAY,     // shift-and-add array
+    BB_MUL_WALLACE,   // Wallace tree
+    BB_MUL_DADDA,     // Dadda tree
+    BB_MUL_KARATSUBA  // Karatsuba decomposition of wide operands
+};
+
+enum bb_div_encoding {
+    BB_DIV_RESTORING,
+    BB_DIV_NON_RESTORING
+};
+
 struct bit_blaster_params {
-    bool  m_bb_ext_gates;
-    bool  m_bb_quantifiers;
+    bool            m_bb_ext_gates;
+    bool            m_bb_quantifiers;
+    bool            m_bb_circuit_cache;
+    bb_mul_encoding m_bb_mul_encoding;
+    bb_div_encoding m_bb_div_encoding;
     bit_blaster_params():
         m_bb_ext_gates(false),
-        m_bb_quantifiers(false) {
+        m_bb_quantifiers(false),
+        m_bb_circuit_cache(false),
+        m_bb_mul_encoding(BB_MUL_ARRAY),
+        m_bb_div_encoding(BB_DIV_RESTORING) {
     }
 #if 0
     void register_params(ini_params & p) {
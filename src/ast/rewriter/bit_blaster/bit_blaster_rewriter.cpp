@@ -132,6 +132,8 @@ struct blaster_rewriter_cfg : public default_rewriter_cfg {
         m_blast_full     = p.get_bool("blast_full", false);
         m_blast_quant    = p.get_bool("blast_quant", false);
         m_blaster.set_max_memory(m_max_memory);
+        m_blaster.set_circuit_cache(p.get_bool("blast_cache", false));
+        m_blaster.set_encodings(p.get_uint("blast_mul_encoding", BB_MUL_ARRAY), p.get_uint("blast_div_encoding", BB_DIV_RESTORING));
     }
 
     bool rewrite_patterns() const { return true; }
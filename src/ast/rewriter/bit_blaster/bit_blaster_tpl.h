@@ -20,6 +20,8 @@ Revision History:
 #define _BIT_BLASTER_TPL_H_
 
 #include"rational.h"
+#include"bit_blaster_cache.h"
+#include"bit_blaster_params.h"
 
 template<typename Cfg>
 class bit_blaster_tpl : public Cfg {
@@ -37,23 +39,62 @@ protected:
 
     unsigned long long m_max_memory;
     volatile bool      m_cancel;
-    bool               m_use_wtm; /* Wallace Tree Multiplier */
+    unsigned           m_mul_encoding; /* see bb_mul_encoding */
+    unsigned           m_div_encoding; /* see bb_div_encoding */
     bool               m_use_bcm; /* Booth Multiplier for constants */
+    scoped_ptr<bit_blaster_cache> m_cache;
+    bool               m_building_template;
     void checkpoint();
 
+    void mk_array_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits);
+    void mk_wallace_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits);
+    void mk_dadda_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits);
+    void mk_karatsuba_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits);
+    void mk_full_product(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits);
+    void mk_non_restoring_udiv_urem(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & q_bits, expr_ref_vector & r_bits);
+
+    bool mk_cached(bit_blaster_cache::op_kind op, unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits);
+
 public:
     bit_blaster_tpl(Cfg const & cfg = Cfg(), unsigned long long max_memory = UINT64_MAX, bool use_wtm = false, bool use_bcm=false):
         Cfg(cfg),
         m_max_memory(max_memory),
         m_cancel(false),
-        m_use_wtm(use_wtm),
-        m_use_bcm(use_bcm) {
+        m_mul_encoding(use_wtm ? BB_MUL_WALLACE : BB_MUL_ARRAY),
+        m_div_encoding(BB_DIV_RESTORING),
+        m_use_bcm(use_bcm),
+        m_building_template(false) {
     }
 
     void set_max_memory(unsigned long long max_memory) {
         m_max_memory = max_memory;
     }
 
+    /**
+       \brief Enable/disable the cache of the circuits of multipliers, dividers and shifts.
+    */
+    void set_circuit_cache(bool f) {
+        if (!f)
+            m_cache = 0;
+        else if (!m_cache)
+            m_cache = alloc(bit_blaster_cache, m());
+    }
+
+    /**
+       \brief Select the circuits of multipliers and dividers, see bb_mul_encoding and bb_div_encoding.
+    */
+    void set_encodings(unsigned mul_encoding, unsigned div_encoding) {
+        if (m_cache && (m_mul_encoding != mul_encoding || m_div_encoding != div_encoding))
+            m_cache->reset();
+        m_mul_encoding = mul_encoding;
+        m_div_encoding = div_encoding;
+    }
+
+    void collect_statistics(statistics & st) const {
+        if (m_cache)
+            m_cache->collect_statistics(st);
+    }
+
     void set_cancel(bool f) { m_cancel = f; }
     void cancel() { set_cancel(true); }
     void reset_cancel() { set_cancel(false); }
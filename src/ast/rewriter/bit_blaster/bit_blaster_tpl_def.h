@@ -155,9 +155,41 @@ void bit_blaster_tpl<Cfg>::mk_subtracter(unsigned sz, expr * const * a_bits, exp
     SASSERT(out_bits.size() == sz);
 }
 
+/**
+   \brief Use the circuit cache for op. Return false if the cache is disabled, or if
+   the circuit must be built directly because some input bits are constant.
+*/
+template<typename Cfg>
+bool bit_blaster_tpl<Cfg>::mk_cached(bit_blaster_cache::op_kind op, unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
+    if (!m_cache || m_building_template)
+        return false;
+    expr_ref_vector inputs(m());
+    inputs.append(sz, a_bits);
+    inputs.append(sz, b_bits);
+    if (m_cache->find(op, sz, inputs.size(), inputs.c_ptr(), out_bits))
+        return true;
+    expr_ref_vector t_inputs(m()), t_outputs(m()), t_aux(m());
+    if (!m_cache->mk_template_inputs(t_inputs))
+        return false;
+    flet<bool> _building(m_building_template, true);
+    expr * const * t_a = t_inputs.c_ptr();
+    expr * const * t_b = t_inputs.c_ptr() + sz;
+    switch (op) {
+    case bit_blaster_cache::BB_MUL:       mk_multiplier(sz, t_a, t_b, t_outputs); break;
+    case bit_blaster_cache::BB_UDIV_UREM: mk_udiv_urem(sz, t_a, t_b, t_outputs, t_aux); t_outputs.append(t_aux); break;
+    case bit_blaster_cache::BB_SHL:       mk_shl(sz, t_a, t_b, t_outputs); break;
+    case bit_blaster_cache::BB_LSHR:      mk_lshr(sz, t_a, t_b, t_outputs); break;
+    case bit_blaster_cache::BB_ASHR:      mk_ashr(sz, t_a, t_b, t_outputs); break;
+    }
+    m_cache->insert(t_outputs, out_bits);
+    return true;
+}
+
 template<typename Cfg>
 void bit_blaster_tpl<Cfg>::mk_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
     SASSERT(sz > 0);
+    if (mk_cached(bit_blaster_cache::BB_MUL, sz, a_bits, b_bits, out_bits))
+        return;
     
     if (!m_use_bcm) {
         numeral n_a, n_b;
@@ -184,151 +216,305 @@ void bit_blaster_tpl<Cfg>::mk_multiplier(unsigned sz, expr * const * a_bits, exp
         }
     }
 
-    if (!m_use_wtm) {
+    switch (m_mul_encoding) {
+    case BB_MUL_WALLACE:   mk_wallace_multiplier(sz, a_bits, b_bits, out_bits); break;
+    case BB_MUL_DADDA:     mk_dadda_multiplier(sz, a_bits, b_bits, out_bits); break;
+    case BB_MUL_KARATSUBA: mk_karatsuba_multiplier(sz, a_bits, b_bits, out_bits); break;
+    default:               mk_array_multiplier(sz, a_bits, b_bits, out_bits); break;
+    }
+}
+
+template<typename Cfg>
+void bit_blaster_tpl<Cfg>::mk_array_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
 #if 0
     static unsigned counter = 0;
     counter++;
     verbose_stream() << "MK_MULTIPLIER: " << counter << std::endl;
 #endif
-        
-        expr_ref_vector cins(m()), couts(m());
-        expr_ref out(m()), cout(m());
 
-        mk_and(a_bits[0], b_bits[0], out);
-        out_bits.push_back(out);
-
-        /*
-           out = a*b is encoded using the following circuit.
-      
-                      a[0]&b[0]         a[0]&b[1]          a[0]&b[2]         a[0]&b[3]  ...
-                          |                 |                  |                 |
-                          |     a[1]&b[0] - HA     a[1]&b[1] - HA    a[1]&b[2] - HA 
-                          |                 | \                | \               | \
-                          |                 |  --------------- |  -------------- |  --- ...
-                          |                 |                 \|                \
-                          |                 |      a[2]&b[0] - FA    a[2]&b[1] - FA
-                          |                 |                  | \               | \      
-                          |                 |                  |  -------------- |  -- ...
-                          |                 |                  |                \| 
-                          |                 |                  |     a[3]&b[0] - FA
-                          |                 |                  |                 | \
-                          |                 |                  |                 |  -- ....
-                         ...               ...                ...               ...
-                        out[0]            out[1]             out[2]            out[3]
-      
-           HA denotes a half-adder.
-           FA denotes a full-adder.
-        */
-
-        for (unsigned i = 1; i < sz; i++) {
-            checkpoint();
-            couts.reset();
-            expr_ref i1(m()), i2(m());
-            mk_and(a_bits[0], b_bits[i],   i1);
-            mk_and(a_bits[1], b_bits[i-1], i2);
-            if (i < sz - 1) {
-                mk_half_adder(i1, i2, out, cout);
+    expr_ref_vector cins(m()), couts(m());
+    expr_ref out(m()), cout(m());
+
+    mk_and(a_bits[0], b_bits[0], out);
+    out_bits.push_back(out);
+
+    /*
+       out = a*b is encoded using the following circuit.
+  
+                  a[0]&b[0]         a[0]&b[1]          a[0]&b[2]         a[0]&b[3]  ...
+                      |                 |                  |                 |
+                      |     a[1]&b[0] - HA     a[1]&b[1] - HA    a[1]&b[2] - HA 
+                      |                 | \                | \               | \
+                      |                 |  --------------- |  -------------- |  --- ...
+                      |                 |                 \|                \
+                      |                 |      a[2]&b[0] - FA    a[2]&b[1] - FA
+                      |                 |                  | \               | \      
+                      |                 |                  |  -------------- |  -- ...
+                      |                 |                  |                \| 
+                      |                 |                  |     a[3]&b[0] - FA
+                      |                 |                  |                 | \
+                      |                 |                  |                 |  -- ....
+                     ...               ...                ...               ...
+                    out[0]            out[1]             out[2]            out[3]
+  
+       HA denotes a half-adder.
+       FA denotes a full-adder.
+    */
+
+    for (unsigned i = 1; i < sz; i++) {
+        checkpoint();
+        couts.reset();
+        expr_ref i1(m()), i2(m());
+        mk_and(a_bits[0], b_bits[i],   i1);
+        mk_and(a_bits[1], b_bits[i-1], i2);
+        if (i < sz - 1) {
+            mk_half_adder(i1, i2, out, cout);
+            couts.push_back(cout);
+            for (unsigned j = 2; j <= i; j++) {
+                expr_ref prev_out(m());
+                prev_out = out;
+                expr_ref i3(m());
+                mk_and(a_bits[j], b_bits[i-j], i3);
+                mk_full_adder(i3, prev_out, cins.get(j-2), out, cout);
                 couts.push_back(cout);
-                for (unsigned j = 2; j <= i; j++) {
-                    expr_ref prev_out(m());
-                    prev_out = out;
-                    expr_ref i3(m());
-                    mk_and(a_bits[j], b_bits[i-j], i3);
-                    mk_full_adder(i3, prev_out, cins.get(j-2), out, cout);
-                    couts.push_back(cout);
-                }
-                out_bits.push_back(out);
-                cins.swap(couts);
             }
-            else {
-                // last step --> I don't need to generate/store couts.
-                mk_xor(i1, i2, out);
-                for (unsigned j = 2; j <= i; j++) {
-                    expr_ref i3(m());
-                    mk_and(a_bits[j], b_bits[i-j], i3);
-                    mk_xor3(i3, out, cins.get(j-2), out);
-                }
-                out_bits.push_back(out);
+            out_bits.push_back(out);
+            cins.swap(couts);
+        }
+        else {
+            // last step --> I don't need to generate/store couts.
+            mk_xor(i1, i2, out);
+            for (unsigned j = 2; j <= i; j++) {
+                expr_ref i3(m());
+                mk_and(a_bits[j], b_bits[i-j], i3);
+                mk_xor3(i3, out, cins.get(j-2), out);
             }
+            out_bits.push_back(out);
         }
     }
-    else { 
-        // WALLACE TREE MULTIPLIER        
+}
 
-        if (sz == 1) {
-            expr_ref t(m());
-            mk_and(a_bits[0], b_bits[0], t);
-            out_bits.push_back(t);
-            return;
+template<typename Cfg>
+void bit_blaster_tpl<Cfg>::mk_wallace_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
+    if (sz == 1) {
+        expr_ref t(m());
+        mk_and(a_bits[0], b_bits[0], t);
+        out_bits.push_back(t);
+        return;
+    }
+
+    // There are sz numbers to add and we use a Wallace tree to reduce that to two. 
+    // In this tree, we reduce as early as possible, as opposed to the Dada tree where some 
+    // additions may be delayed if they don't increase the propagation delay [which may be 
+    // a little bit more efficient, but it's tricky to find out which additions create 
+    // additional delays].
+            
+    expr_ref zero(m());
+    zero = m().mk_false();
+
+    vector< expr_ref_vector > pps;
+    pps.resize(sz, m());
+           
+    for (unsigned i = 0; i < sz; i++) {
+        checkpoint();
+        // The partial product is a_bits AND b_bits[i] 
+        // [or alternatively ITE(b_bits[i], a_bits, bv0[sz])]
+
+        expr_ref_vector & pp = pps[i];
+        expr_ref t(m());
+        for (unsigned j = 0; j < i; j++)
+            pp.push_back(zero); // left shift by i bits
+        for (unsigned j = 0; j < (sz - i); j++) {
+            mk_and(a_bits[j], b_bits[i], t);
+            pp.push_back(t);
         }
 
-        // There are sz numbers to add and we use a Wallace tree to reduce that to two. 
-        // In this tree, we reduce as early as possible, as opposed to the Dada tree where some 
-        // additions may be delayed if they don't increase the propagation delay [which may be 
-        // a little bit more efficient, but it's tricky to find out which additions create 
-        // additional delays].
-                
-        expr_ref zero(m());
-        zero = m().mk_false();
-
-        vector< expr_ref_vector > pps;
-        pps.resize(sz, m());
-               
-        for (unsigned i = 0; i < sz; i++) {
+        SASSERT(pps[i].size() == sz);            
+    }        
+    
+    while (pps.size() != 2) {            
+        unsigned save_inx = 0;
+        unsigned i = 0;
+        unsigned end = pps.size() - 3;
+        for ( ; i <= end; i += 3) {
             checkpoint();
-            // The partial product is a_bits AND b_bits[i] 
-            // [or alternatively ITE(b_bits[i], a_bits, bv0[sz])]
-
-            expr_ref_vector & pp = pps[i];
-            expr_ref t(m());
-            for (unsigned j = 0; j < i; j++)
-                pp.push_back(zero); // left shift by i bits
-            for (unsigned j = 0; j < (sz - i); j++) {
-                mk_and(a_bits[j], b_bits[i], t);
-                pp.push_back(t);
-            }
+            expr_ref_vector pp1(m()), pp2(m()), pp3(m());
+            pp1.swap(pps[i]);
+            pp2.swap(pps[i+1]);
+            pp3.swap(pps[i+2]);
+            expr_ref_vector & sum_bits = pps[save_inx];
+            expr_ref_vector & carry_bits = pps[save_inx+1];
+            SASSERT(sum_bits.empty() && carry_bits.empty());
+            carry_bits.push_back(zero);                
+            mk_carry_save_adder(pp1.size(), pp1.c_ptr(), pp2.c_ptr(), pp3.c_ptr(), sum_bits, carry_bits);
+            carry_bits.pop_back();
+            save_inx += 2;                
+        }
 
-            SASSERT(pps[i].size() == sz);            
-        }        
-        
-        while (pps.size() != 2) {            
-            unsigned save_inx = 0;
-            unsigned i = 0;
-            unsigned end = pps.size() - 3;
-            for ( ; i <= end; i += 3) {
-                checkpoint();
-                expr_ref_vector pp1(m()), pp2(m()), pp3(m());
-                pp1.swap(pps[i]);
-                pp2.swap(pps[i+1]);
-                pp3.swap(pps[i+2]);
-                expr_ref_vector & sum_bits = pps[save_inx];
-                expr_ref_vector & carry_bits = pps[save_inx+1];
-                SASSERT(sum_bits.empty() && carry_bits.empty());
-                carry_bits.push_back(zero);                
-                mk_carry_save_adder(pp1.size(), pp1.c_ptr(), pp2.c_ptr(), pp3.c_ptr(), sum_bits, carry_bits);
-                carry_bits.pop_back();
-                save_inx += 2;                
-            }
+        if (i == pps.size()-2) {
+            pps[save_inx++].swap(pps[i++]);
+            pps[save_inx++].swap(pps[i++]);
+        }
+        else if (i == pps.size()-1) {
+            pps[save_inx++].swap(pps[i++]);
+        }
 
-            if (i == pps.size()-2) {
-                pps[save_inx++].swap(pps[i++]);
-                pps[save_inx++].swap(pps[i++]);
-            }
-            else if (i == pps.size()-1) {
-                pps[save_inx++].swap(pps[i++]);
+        SASSERT (save_inx < pps.size() && i == pps.size());            
+        pps.shrink(save_inx);
+    }        
+
+    SASSERT(pps.size() == 2);
+
+    // Now there are only two numbers to add, we can use a ripple carry adder here.
+    mk_adder(sz, pps[0].c_ptr(), pps[1].c_ptr(), out_bits);
+}
+
+/**
+   \brief Dadda tree multiplier. The partial products are arranged in columns of equal weight,
+   and each stage only adds the full and half adders needed to bring the height of every column
+   down to the next number of the sequence 2, 3, 4, 6, 9, 13, ... The two remaining rows are
+   added with a ripple carry adder. Only the sz lowest columns are computed.
+*/
+template<typename Cfg>
+void bit_blaster_tpl<Cfg>::mk_dadda_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
+    vector<expr_ref_vector> cols;
+    cols.resize(sz, m());
+    expr_ref t(m()), sum(m()), carry(m());
+    for (unsigned i = 0; i < sz; i++) {
+        for (unsigned j = 0; i + j < sz; j++) {
+            mk_and(a_bits[j], b_bits[i], t);
+            cols[i + j].push_back(t);
+        }
+    }
+    expr_ref_vector new_col(m());
+    while (true) {
+        checkpoint();
+        unsigned max_h = 0;
+        for (unsigned k = 0; k < sz; k++)
+            max_h = std::max(max_h, cols[k].size());
+        if (max_h <= 2)
+            break;
+        // d is the largest number of the sequence below max_h.
+        unsigned d = 2;
+        while (d * 3 / 2 < max_h)
+            d = d * 3 / 2;
+        for (unsigned k = 0; k < sz; k++) {
+            expr_ref_vector & col = cols[k];
+            bool has_next = k + 1 < sz;
+            unsigned pos = 0;
+            new_col.reset();
+            // the carries produced in column k-1 during this stage are already in col.
+            while (col.size() - pos + new_col.size() > d && col.size() - pos >= 2) {
+                if (col.size() - pos + new_col.size() == d + 1 || col.size() - pos == 2) {
+                    if (has_next)
+                        mk_half_adder(col.get(pos), col.get(pos+1), sum, carry);
+                    else
+                        mk_xor(col.get(pos), col.get(pos+1), sum);
+                    pos += 2;
+                }
+                else {
+                    if (has_next)
+                        mk_full_adder(col.get(pos), col.get(pos+1), col.get(pos+2), sum, carry);
+                    else
+                        mk_xor3(col.get(pos), col.get(pos+1), col.get(pos+2), sum);
+                    pos += 3;
+                }
+                new_col.push_back(sum);
+                if (has_next)
+                    cols[k+1].push_back(carry);
             }
+            for (; pos < col.size(); pos++)
+                new_col.push_back(col.get(pos));
+            col.swap(new_col);
+        }
+    }
 
-            SASSERT (save_inx < pps.size() && i == pps.size());            
-            pps.shrink(save_inx);
-        }        
+    expr_ref_vector row1(m()), row2(m());
+    for (unsigned k = 0; k < sz; k++) {
+        SASSERT(cols[k].size() <= 2);
+        row1.push_back(cols[k].size() > 0 ? cols[k].get(0) : m().mk_false());
+        row2.push_back(cols[k].size() > 1 ? cols[k].get(1) : m().mk_false());
+    }
+    mk_adder(sz, row1.c_ptr(), row2.c_ptr(), out_bits);
+}
 
-        SASSERT(pps.size() == 2);
+/**
+   \brief Minimal width of the operands split by the Karatsuba multiplier.
+   Narrower products use the array multiplier.
+*/
+#define BB_KARATSUBA_MIN 16
 
-        // Now there are only two numbers to add, we can use a ripple carry adder here.
-        mk_adder(sz, pps[0].c_ptr(), pps[1].c_ptr(), out_bits);
+/**
+   \brief Multiplier modulo 2^sz based on the Karatsuba decomposition.
+   For a = a1*2^h + a0 and b = b1*2^h + b0 with 2h >= sz, the term a1*b1*2^2h vanishes, so the
+   result is a0*b0 + ((a1*b0 + a0*b1) << h), where a0*b0 is a full product of width 2h and
+   the cross products are truncated to sz - h bits.
+*/
+template<typename Cfg>
+void bit_blaster_tpl<Cfg>::mk_karatsuba_multiplier(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
+    if (sz < BB_KARATSUBA_MIN) {
+        mk_array_multiplier(sz, a_bits, b_bits, out_bits);
+        return;
     }
+    checkpoint();
+    unsigned h = (sz + 1) / 2;
+    unsigned l = sz - h;
+    expr_ref_vector low(m()), c1(m()), c2(m()), cross(m());
+    mk_full_product(h, a_bits, b_bits, low);
+    // only the l lowest bits of a0 and b0 contribute to the truncated cross products.
+    mk_karatsuba_multiplier(l, a_bits + h, b_bits, c1);
+    mk_karatsuba_multiplier(l, a_bits, b_bits + h, c2);
+    mk_adder(l, c1.c_ptr(), c2.c_ptr(), cross);
+    out_bits.append(h, low.c_ptr());
+    mk_adder(l, low.c_ptr() + h, cross.c_ptr(), out_bits);
 }
 
+/**
+   \brief Store in out_bits the 2*sz bits of the product of a_bits and b_bits.
+   Wide operands are multiplied using three products of half width:
+   z0 = a0*b0, z2 = a1*b1 and z1 = (a0 + a1)*(b0 + b1), where a*b = z2*2^2h + (z1 - z0 - z2)*2^h + z0.
+*/
+template<typename Cfg>
+void bit_blaster_tpl<Cfg>::mk_full_product(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
+    if (sz < BB_KARATSUBA_MIN) {
+        expr_ref_vector a_ext(m()), b_ext(m());
+        mk_zero_extend(sz, a_bits, sz, a_ext);
+        mk_zero_extend(sz, b_bits, sz, b_ext);
+        mk_array_multiplier(2*sz, a_ext.c_ptr(), b_ext.c_ptr(), out_bits);
+        return;
+    }
+    checkpoint();
+    unsigned h = sz / 2;
+    unsigned l = sz - h;
+    expr_ref_vector z0(m()), z1(m()), z2(m()), a_lo(m()), b_lo(m()), a_hi(m()), b_hi(m()), a_sum(m()), b_sum(m());
+    mk_full_product(h, a_bits, b_bits, z0);
+    mk_full_product(l, a_bits + h, b_bits + h, z2);
+    // the sums of the halves have l + 1 bits.
+    mk_zero_extend(h, a_bits, l + 1 - h, a_lo);
+    mk_zero_extend(h, b_bits, l + 1 - h, b_lo);
+    mk_zero_extend(l, a_bits + h, 1, a_hi);
+    mk_zero_extend(l, b_bits + h, 1, b_hi);
+    mk_adder(l + 1, a_lo.c_ptr(), a_hi.c_ptr(), a_sum);
+    mk_adder(l + 1, b_lo.c_ptr(), b_hi.c_ptr(), b_sum);
+    mk_full_product(l + 1, a_sum.c_ptr(), b_sum.c_ptr(), z1);
+    // mid = z1 - z0 - z2 on 2l + 2 bits
+    unsigned mid_sz = 2*l + 2;
+    expr_ref_vector z0_ext(m()), z2_ext(m()), t(m()), mid(m());
+    expr_ref cout(m());
+    mk_zero_extend(2*h, z0.c_ptr(), mid_sz - 2*h, z0_ext);
+    mk_zero_extend(2*l, z2.c_ptr(), 2, z2_ext);
+    mk_subtracter(mid_sz, z1.c_ptr(), z0_ext.c_ptr(), t, cout);
+    mk_subtracter(mid_sz, t.c_ptr(), z2_ext.c_ptr(), mid, cout);
+    // z0 and z2 do not overlap, so the result is (z2 ++ z0) + (mid << h).
+    unsigned out_sz = 2*sz;
+    expr_ref_vector high(m()), mid_ext(m());
+    high.append(h, z0.c_ptr() + h);
+    high.append(z2);
+    for (unsigned i = 0; i < out_sz - h; i++)
+        mid_ext.push_back(i < mid_sz ? mid.get(i) : m().mk_false());
+    out_bits.append(h, z0.c_ptr());
+    mk_adder(out_sz - h, high.c_ptr(), mid_ext.c_ptr(), out_bits);
+}
 
 template<typename Cfg>
 void bit_blaster_tpl<Cfg>::mk_umul_no_overflow(unsigned sz, expr * const * a_bits,  expr * const * b_bits, expr_ref & result) {
@@ -439,6 +625,18 @@ void bit_blaster_tpl<Cfg>::mk_smul_no_underflow(unsigned sz, expr * const * a_bi
 template<typename Cfg>
 void bit_blaster_tpl<Cfg>::mk_udiv_urem(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & q_bits, expr_ref_vector & r_bits) {
     SASSERT(sz > 0);
+    if (m_cache) {
+        expr_ref_vector out(m());
+        if (mk_cached(bit_blaster_cache::BB_UDIV_UREM, sz, a_bits, b_bits, out)) {
+            q_bits.append(sz, out.c_ptr());
+            r_bits.append(sz, out.c_ptr() + sz);
+            return;
+        }
+    }
+    if (m_div_encoding == BB_DIV_NON_RESTORING) {
+        mk_non_restoring_udiv_urem(sz, a_bits, b_bits, q_bits, r_bits);
+        return;
+    }
 
     // p is the residual of each stage of the division.
     expr_ref_vector & p = r_bits;
@@ -496,6 +694,55 @@ void bit_blaster_tpl<Cfg>::mk_udiv_urem(unsigned sz, expr * const * a_bits, expr
           );
 }
 
+/**
+   \brief Non-restoring divider. The partial remainder r is kept in two's complement on sz + 1 bits,
+   and each stage either subtracts or adds b depending on the sign of r, instead of selecting
+   between p - b and p as the restoring divider does. Every stage is a single adder/subtracter
+   whose operand is b xor the sign of r, and the quotient bit is the complement of the new sign.
+   A negative final remainder is corrected by adding b.
+   For b = 0, r is never negative, so the quotient is all ones and the remainder is a,
+   as in the restoring divider.
+*/
+template<typename Cfg>
+void bit_blaster_tpl<Cfg>::mk_non_restoring_udiv_urem(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & q_bits, expr_ref_vector & r_bits) {
+    unsigned n = sz + 1;
+    expr_ref_vector r(m()), b_ext(m()), t(m());
+    mk_zero_extend(sz, b_bits, 1, b_ext);
+    for (unsigned j = 0; j < n; j++)
+        r.push_back(m().mk_false());
+    expr_ref neg(m()), sub(m()), y(m()), cin(m()), cout(m()), out(m());
+    neg = m().mk_false();
+    q_bits.resize(sz);
+    for (unsigned i = sz; i-- > 0; ) {
+        checkpoint();
+        // r := 2r + a[i] - b if r >= 0, and 2r + a[i] + b otherwise.
+        mk_not(neg, sub);
+        cin = sub;
+        t.reset();
+        for (unsigned j = 0; j < n; j++) {
+            mk_xor(b_ext.get(j), sub, y);
+            expr * s_j = j == 0 ? a_bits[i] : r.get(j-1);
+            if (j < n - 1)
+                mk_full_adder(s_j, y, cin, out, cout);
+            else
+                mk_xor3(s_j, y, cin, out);
+            t.push_back(out);
+            cin = cout;
+        }
+        r.swap(t);
+        neg = r.get(n-1);
+        expr_ref q(m());
+        mk_not(neg, q);
+        q_bits.set(i, q);
+    }
+    t.reset();
+    mk_adder(sz, r.c_ptr(), b_bits, t);
+    for (unsigned j = 0; j < sz; j++) {
+        mk_ite(neg, t.get(j), r.get(j), out);
+        r_bits.push_back(out);
+    }
+}
+
 template<typename Cfg>
 void bit_blaster_tpl<Cfg>::mk_udiv(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & q_bits) {
     expr_ref_vector aux(m());
@@ -901,6 +1148,8 @@ void bit_blaster_tpl<Cfg>::mk_eqs(unsigned sz, expr * const * a_bits, expr_ref_v
 template<typename Cfg>
 void bit_blaster_tpl<Cfg>::mk_shl(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
     numeral k;
+    if (mk_cached(bit_blaster_cache::BB_SHL, sz, a_bits, b_bits, out_bits))
+        return;
     if (is_numeral(sz, b_bits, k)) {
         if (k > numeral(sz)) k = numeral(sz);
         unsigned n = static_cast<unsigned>(k.get_int64());
@@ -947,6 +1196,8 @@ void bit_blaster_tpl<Cfg>::mk_shl(unsigned sz, expr * const * a_bits, expr * con
 template<typename Cfg>
 void bit_blaster_tpl<Cfg>::mk_lshr(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
     numeral k;
+    if (mk_cached(bit_blaster_cache::BB_LSHR, sz, a_bits, b_bits, out_bits))
+        return;
     if (is_numeral(sz, b_bits, k)) {
         if (k > numeral(sz)) k = numeral(sz);
         unsigned n   = static_cast<unsigned>(k.get_int64()); 
@@ -990,6 +1241,8 @@ void bit_blaster_tpl<Cfg>::mk_lshr(unsigned sz, expr * const * a_bits, expr * co
 template<typename Cfg>
 void bit_blaster_tpl<Cfg>::mk_ashr(unsigned sz, expr * const * a_bits, expr * const * b_bits, expr_ref_vector & out_bits) {
     numeral k;
+    if (mk_cached(bit_blaster_cache::BB_ASHR, sz, a_bits, b_bits, out_bits))
+        return;
     if (is_numeral(sz, b_bits, k)) {
         if (k > numeral(sz)) k = numeral(sz);
         unsigned n   = static_cast<unsigned>(k.get_int64()); 
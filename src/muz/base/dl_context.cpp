@@ -290,10 +290,14 @@ namespace datalog {
     unsigned context::similarity_compressor_threshold() const { return m_params->similarity_compressor_threshold(); }
     unsigned context::timeout() const { return m_fparams.m_timeout; }
     unsigned context::initial_restart_timeout() const { return m_params->initial_restart_timeout(); } 
+    unsigned context::join_replan_factor() const { return m_params->join_replan_factor(); }
+    unsigned context::max_join_replans() const { return m_params->max_join_replans(); }
     bool context::generate_explanations() const { return m_params->generate_explanations(); }
     bool context::explanations_on_relation_level() const { return m_params->explanations_on_relation_level(); }
     bool context::magic_sets_for_queries() const { return m_params->magic_sets_for_queries();  }
     bool context::eager_emptiness_checking() const { return m_params->eager_emptiness_checking(); }
+    bool context::parallel_rule_evaluation() const { return m_params->parallel_rule_evaluation(); }
+    bool context::leapfrog_join() const { return m_params->leapfrog_join(); }
 
     bool context::bit_blast() const { return m_params->bit_blast(); }
     bool context::karr() const { return m_params->karr(); }
@@ -260,10 +260,14 @@ namespace datalog {
         unsigned similarity_compressor_threshold() const;
         unsigned timeout() const;
         unsigned initial_restart_timeout() const;
+        unsigned join_replan_factor() const;
+        unsigned max_join_replans() const;
         bool generate_explanations() const;
         bool explanations_on_relation_level() const;
         bool magic_sets_for_queries() const;
         bool eager_emptiness_checking() const;
+        bool parallel_rule_evaluation() const;
+        bool leapfrog_join() const;
         bool bit_blast() const;
         bool karr() const;
         bool scale() const;
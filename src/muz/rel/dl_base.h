@@ -890,6 +890,16 @@ namespace datalog {
     };
 
 
+    class table_nary_join_fn : public base_table_fn {
+    public:
+        /**
+           \brief Join the \c n tables in \c tables in a single pass, without materializing
+           any intermediate results.
+        */
+        virtual table_base * operator()(unsigned n, const table_base * const * tables) = 0;
+    };
+
+
     class table_signature : public table_infrastructure::signature_base {
     public:
         struct hash {
@@ -1016,6 +1026,13 @@ namespace datalog {
 
         virtual bool can_handle_signature(const table_signature & s) { return s.functional_columns()==0; }
 
+        /**
+           \brief Return true if operations on distinct tables of this plugin can be executed
+           on parallel threads. Operations on the same table must still be serialized, 
+           even read-only ones.
+        */
+        virtual bool is_thread_safe() const { return false; }
+
     protected:
         /**
            If the returned value is non-zero, the returned object must take ownership of \c mapper.
@@ -1030,6 +1047,17 @@ namespace datalog {
         virtual table_transformer_fn * mk_project_with_reduce_fn(const table_base & t, unsigned col_cnt, 
             const unsigned * removed_cols, table_row_pair_reduce_fn * reducer) { return 0; }
 
+        /**
+           \brief Return a functor joining \c n tables.
+
+           \c col_vars contains, for the columns of all tables in order, the number of the join 
+           variable the column is bound to. Variables are numbered from zero, and the numbering
+           determines the order in which they are eliminated. No variable may occur twice in one 
+           table. The columns of the result are the variables in \c result_vars.
+        */
+        virtual table_nary_join_fn * mk_nary_join_fn(unsigned n, const table_base * const * tables, 
+            const unsigned_vector & col_vars, const unsigned_vector & result_vars) { return 0; }
+
     };
 
     class table_base : public table_infrastructure::base_ancestor {
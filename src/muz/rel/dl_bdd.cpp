@@ -0,0 +1,377 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    dl_bdd.cpp
+
+Abstract:
+
+    Reduced ordered binary decision diagrams used by the BDD table plugin.
+
+Author:
+
+Revision History:
+
+--*/
+#include<algorithm>
+#include<math.h>
+#include"dl_bdd.h"
+
+namespace datalog {
+
+    static const unsigned INITIAL_GC_THRESHOLD = 1 << 16;
+    static const unsigned INITIAL_CACHE_SIZE   = 1 << 14;
+    static const unsigned MAX_CACHE_SIZE       = 1 << 22;
+
+    bdd_manager::bdd_manager():
+        m_unique(DEFAULT_HASHTABLE_INITIAL_CAPACITY, node_hash_proc(this), node_eq_proc(this)),
+        m_gc_threshold(INITIAL_GC_THRESHOLD),
+        m_permute_id(0),
+        m_permutation(0),
+        m_num_gc(0) {
+        // terminals: 0 is false, 1 is true.
+        m_nodes.push_back(node());
+        m_nodes.push_back(node());
+        m_cache.resize(INITIAL_CACHE_SIZE, cache_entry());
+    }
+
+    unsigned bdd_manager::mk_node(unsigned v, unsigned lo, unsigned hi) {
+        if (lo == hi)
+            return lo;
+        SASSERT(is_const(lo) || v < level(lo));
+        SASSERT(is_const(hi) || v < level(hi));
+        unsigned n;
+        if (m_free_nodes.empty()) {
+            n = m_nodes.size();
+            m_nodes.push_back(node(v, lo, hi));
+        }
+        else {
+            n = m_free_nodes.back();
+            m_free_nodes.pop_back();
+            m_nodes[n] = node(v, lo, hi);
+        }
+        unique_table::entry * e = m_unique.find_core(n);
+        if (e) {
+            unsigned r = e->get_data();
+            m_nodes[n].m_var = UINT_MAX;
+            m_free_nodes.push_back(n);
+            return r;
+        }
+        m_unique.insert(n);
+        return n;
+    }
+
+    bdd_manager::cache_entry & bdd_manager::get_entry(unsigned op, unsigned a, unsigned b, unsigned c) {
+        unsigned h = mk_mix(a, b, c) + op * 0x9e3779b9;
+        return m_cache[h & (m_cache.size() - 1)];
+    }
+
+    bool bdd_manager::find_cache(unsigned op, unsigned a, unsigned b, unsigned c, unsigned & r) {
+        cache_entry const & e = get_entry(op, a, b, c);
+        if (e.m_op == op && e.m_a == a && e.m_b == b && e.m_c == c) {
+            r = e.m_result;
+            return true;
+        }
+        return false;
+    }
+
+    void bdd_manager::insert_cache(unsigned op, unsigned a, unsigned b, unsigned c, unsigned r) {
+        cache_entry & e = get_entry(op, a, b, c);
+        e.m_op     = op;
+        e.m_a      = a;
+        e.m_b      = b;
+        e.m_c      = c;
+        e.m_result = r;
+    }
+
+    unsigned bdd_manager::mk_and_rec(unsigned a, unsigned b) {
+        if (a == 0 || b == 0) return 0;
+        if (a == 1 || a == b) return b;
+        if (b == 1) return a;
+        if (a > b) std::swap(a, b);
+        unsigned r;
+        if (find_cache(OP_AND, a, b, 0, r))
+            return r;
+        unsigned v  = std::min(level(a), level(b));
+        unsigned a0 = level(a) == v ? lo(a) : a;
+        unsigned a1 = level(a) == v ? hi(a) : a;
+        unsigned b0 = level(b) == v ? lo(b) : b;
+        unsigned b1 = level(b) == v ? hi(b) : b;
+        unsigned r0 = mk_and_rec(a0, b0);
+        unsigned r1 = mk_and_rec(a1, b1);
+        r = mk_node(v, r0, r1);
+        insert_cache(OP_AND, a, b, 0, r);
+        return r;
+    }
+
+    unsigned bdd_manager::mk_or_rec(unsigned a, unsigned b) {
+        if (a == 1 || b == 1) return 1;
+        if (a == 0 || a == b) return b;
+        if (b == 0) return a;
+        if (a > b) std::swap(a, b);
+        unsigned r;
+        if (find_cache(OP_OR, a, b, 0, r))
+            return r;
+        unsigned v  = std::min(level(a), level(b));
+        unsigned a0 = level(a) == v ? lo(a) : a;
+        unsigned a1 = level(a) == v ? hi(a) : a;
+        unsigned b0 = level(b) == v ? lo(b) : b;
+        unsigned b1 = level(b) == v ? hi(b) : b;
+        unsigned r0 = mk_or_rec(a0, b0);
+        unsigned r1 = mk_or_rec(a1, b1);
+        r = mk_node(v, r0, r1);
+        insert_cache(OP_OR, a, b, 0, r);
+        return r;
+    }
+
+    unsigned bdd_manager::mk_not_rec(unsigned a) {
+        if (is_const(a)) return 1 - a;
+        unsigned r;
+        if (find_cache(OP_NOT, a, 0, 0, r))
+            return r;
+        unsigned r0 = mk_not_rec(lo(a));
+        unsigned r1 = mk_not_rec(hi(a));
+        r = mk_node(var(a), r0, r1);
+        insert_cache(OP_NOT, a, 0, 0, r);
+        return r;
+    }
+
+    unsigned bdd_manager::mk_ite_rec(unsigned f, unsigned g, unsigned h) {
+        if (f == 1) return g;
+        if (f == 0) return h;
+        if (g == h) return g;
+        if (g == 1 && h == 0) return f;
+        if (g == 0 && h == 1) return mk_not_rec(f);
+        unsigned r;
+        if (find_cache(OP_ITE, f, g, h, r))
+            return r;
+        unsigned v  = std::min(level(f), std::min(level(g), level(h)));
+        unsigned f0 = level(f) == v ? lo(f) : f;
+        unsigned f1 = level(f) == v ? hi(f) : f;
+        unsigned g0 = level(g) == v ? lo(g) : g;
+        unsigned g1 = level(g) == v ? hi(g) : g;
+        unsigned h0 = level(h) == v ? lo(h) : h;
+        unsigned h1 = level(h) == v ? hi(h) : h;
+        unsigned r0 = mk_ite_rec(f0, g0, h0);
+        unsigned r1 = mk_ite_rec(f1, g1, h1);
+        r = mk_node(v, r0, r1);
+        insert_cache(OP_ITE, f, g, h, r);
+        return r;
+    }
+
+    unsigned bdd_manager::mk_exists_rec(unsigned a, unsigned cube) {
+        if (is_const(a)) return a;
+        while (level(cube) < level(a))
+            cube = hi(cube);
+        if (cube == 1) return a;
+        unsigned r;
+        if (find_cache(OP_EXISTS, a, cube, 0, r))
+            return r;
+        if (level(cube) == level(a)) {
+            unsigned r0 = mk_exists_rec(lo(a), hi(cube));
+            unsigned r1 = r0 == 1 ? 1 : mk_exists_rec(hi(a), hi(cube));
+            r = mk_or_rec(r0, r1);
+        }
+        else {
+            unsigned r0 = mk_exists_rec(lo(a), cube);
+            unsigned r1 = mk_exists_rec(hi(a), cube);
+            r = mk_node(var(a), r0, r1);
+        }
+        insert_cache(OP_EXISTS, a, cube, 0, r);
+        return r;
+    }
+
+    unsigned bdd_manager::mk_and_exists_rec(unsigned a, unsigned b, unsigned cube) {
+        if (a == 0 || b == 0) return 0;
+        if (a == 1 && b == 1) return 1;
+        if (a == 1 || a == b) return mk_exists_rec(b, cube);
+        if (b == 1) return mk_exists_rec(a, cube);
+        if (a > b) std::swap(a, b);
+        unsigned v = std::min(level(a), level(b));
+        while (level(cube) < v)
+            cube = hi(cube);
+        if (cube == 1) return mk_and_rec(a, b);
+        unsigned r;
+        if (find_cache(OP_AND_EXISTS, a, b, cube, r))
+            return r;
+        unsigned a0 = level(a) == v ? lo(a) : a;
+        unsigned a1 = level(a) == v ? hi(a) : a;
+        unsigned b0 = level(b) == v ? lo(b) : b;
+        unsigned b1 = level(b) == v ? hi(b) : b;
+        if (level(cube) == v) {
+            unsigned r0 = mk_and_exists_rec(a0, b0, hi(cube));
+            unsigned r1 = r0 == 1 ? 1 : mk_and_exists_rec(a1, b1, hi(cube));
+            r = mk_or_rec(r0, r1);
+        }
+        else {
+            unsigned r0 = mk_and_exists_rec(a0, b0, cube);
+            unsigned r1 = mk_and_exists_rec(a1, b1, cube);
+            r = mk_node(v, r0, r1);
+        }
+        insert_cache(OP_AND_EXISTS, a, b, cube, r);
+        return r;
+    }
+
+    unsigned bdd_manager::mk_permute_rec(unsigned a) {
+        if (is_const(a)) return a;
+        unsigned r;
+        if (find_cache(OP_PERMUTE, a, m_permute_id, 0, r))
+            return r;
+        unsigned v = var(a);
+        m_permutation->find(v, v);
+        unsigned r0 = mk_permute_rec(lo(a));
+        unsigned r1 = mk_permute_rec(hi(a));
+        r = mk_ite_rec(mk_var_core(v), r1, r0);
+        insert_cache(OP_PERMUTE, a, m_permute_id, 0, r);
+        return r;
+    }
+
+    unsigned bdd_manager::mk_cube(unsigned num_vars, unsigned const * vars) {
+        unsigned_vector vs(num_vars, vars);
+        std::sort(vs.begin(), vs.end());
+        unsigned r = 1;
+        for (unsigned i = vs.size(); i-- > 0; ) {
+            if (i + 1 < vs.size() && vs[i] == vs[i + 1])
+                continue;
+            r = mk_node(vs[i], 0, r);
+        }
+        return r;
+    }
+
+    bdd bdd_manager::mk_var(unsigned v) {
+        try_gc();
+        return mk_bdd(mk_var_core(v));
+    }
+
+    bdd bdd_manager::mk_nvar(unsigned v) {
+        try_gc();
+        return mk_bdd(mk_node(v, 1, 0));
+    }
+
+    bdd bdd_manager::mk_and(bdd const & a, bdd const & b) {
+        try_gc();
+        return mk_bdd(mk_and_rec(a.root(), b.root()));
+    }
+
+    bdd bdd_manager::mk_or(bdd const & a, bdd const & b) {
+        try_gc();
+        return mk_bdd(mk_or_rec(a.root(), b.root()));
+    }
+
+    bdd bdd_manager::mk_not(bdd const & a) {
+        try_gc();
+        return mk_bdd(mk_not_rec(a.root()));
+    }
+
+    bdd bdd_manager::mk_ite(bdd const & f, bdd const & g, bdd const & h) {
+        try_gc();
+        return mk_bdd(mk_ite_rec(f.root(), g.root(), h.root()));
+    }
+
+    bdd bdd_manager::mk_exists(unsigned num_vars, unsigned const * vars, bdd const & a) {
+        try_gc();
+        unsigned cube = mk_cube(num_vars, vars);
+        return mk_bdd(mk_exists_rec(a.root(), cube));
+    }
+
+    bdd bdd_manager::mk_and_exists(unsigned num_vars, unsigned const * vars, bdd const & a, bdd const & b) {
+        try_gc();
+        unsigned cube = mk_cube(num_vars, vars);
+        return mk_bdd(mk_and_exists_rec(a.root(), b.root(), cube));
+    }
+
+    bdd bdd_manager::mk_permute(u_map<unsigned> const & perm, bdd const & a) {
+        try_gc();
+        m_permute_id++;
+        m_permutation = &perm;
+        unsigned r = mk_permute_rec(a.root());
+        m_permutation = 0;
+        return mk_bdd(r);
+    }
+
+    double bdd_manager::count_rec(unsigned n, u_map<unsigned> const & pos, unsigned num_vars, u_map<double> & cache) {
+        if (is_const(n))
+            return n;
+        double r;
+        if (cache.find(n, r))
+            return r;
+        unsigned p  = UINT_MAX, p0 = num_vars, p1 = num_vars;
+        VERIFY(pos.find(var(n), p));
+        if (!is_const(lo(n))) VERIFY(pos.find(var(lo(n)), p0));
+        if (!is_const(hi(n))) VERIFY(pos.find(var(hi(n)), p1));
+        r = ldexp(count_rec(lo(n), pos, num_vars, cache), static_cast<int>(p0 - p - 1)) +
+            ldexp(count_rec(hi(n), pos, num_vars, cache), static_cast<int>(p1 - p - 1));
+        cache.insert(n, r);
+        return r;
+    }
+
+    double bdd_manager::count(bdd const & a, unsigned_vector const & vars) {
+        u_map<unsigned> pos;
+        for (unsigned i = 0; i < vars.size(); i++)
+            pos.insert(vars[i], i);
+        u_map<double> cache;
+        unsigned n = a.root();
+        if (is_const(n))
+            return ldexp(static_cast<double>(n), static_cast<int>(vars.size()));
+        unsigned p = 0;
+        VERIFY(pos.find(var(n), p));
+        return ldexp(count_rec(n, pos, vars.size(), cache), static_cast<int>(p));
+    }
+
+    unsigned bdd_manager::dag_size(bdd const & a) {
+        svector<bool> visited(m_nodes.size(), false);
+        unsigned_vector todo;
+        unsigned r = 0;
+        todo.push_back(a.root());
+        while (!todo.empty()) {
+            unsigned n = todo.back();
+            todo.pop_back();
+            if (is_const(n) || visited[n])
+                continue;
+            visited[n] = true;
+            r++;
+            todo.push_back(lo(n));
+            todo.push_back(hi(n));
+        }
+        return r;
+    }
+
+    void bdd_manager::gc() {
+        m_num_gc++;
+        svector<bool> reachable(m_nodes.size(), false);
+        unsigned_vector todo;
+        reachable[0] = reachable[1] = true;
+        for (unsigned n = 2; n < m_nodes.size(); n++) {
+            if (m_nodes[n].m_refcount > 0)
+                todo.push_back(n);
+        }
+        while (!todo.empty()) {
+            unsigned n = todo.back();
+            todo.pop_back();
+            if (reachable[n])
+                continue;
+            reachable[n] = true;
+            todo.push_back(lo(n));
+            todo.push_back(hi(n));
+        }
+        for (unsigned n = 2; n < m_nodes.size(); n++) {
+            if (!reachable[n] && m_nodes[n].m_var != UINT_MAX) {
+                m_unique.erase(n);
+                m_nodes[n].m_var = UINT_MAX;
+                m_free_nodes.push_back(n);
+            }
+        }
+        // cached results may refer to collected nodes.
+        if (2 * num_nodes() > m_gc_threshold) {
+            m_gc_threshold *= 2;
+            unsigned sz = m_cache.size();
+            if (sz < MAX_CACHE_SIZE) {
+                m_cache.reset();
+                m_cache.resize(2 * sz, cache_entry());
+            }
+        }
+        std::fill(m_cache.begin(), m_cache.end(), cache_entry());
+    }
+
+};
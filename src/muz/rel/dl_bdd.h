@@ -0,0 +1,212 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    dl_bdd.h
+
+Abstract:
+
+    Reduced ordered binary decision diagrams used by the BDD table plugin.
+
+    Nodes are hash-consed in a unique table and results of the
+    recursive operations are memoized in a direct mapped cache.
+    The variable order is given by the variable index: smaller
+    indices are closer to the root.
+
+    Clients keep BDDs alive through reference counted bdd handles.
+    Unreferenced nodes are collected only when a public operation
+    starts, so intermediate results of an operation are never lost.
+
+Author:
+
+Revision History:
+
+--*/
+#ifndef _DL_BDD_H_
+#define _DL_BDD_H_
+
+#include"vector.h"
+#include"hashtable.h"
+#include"map.h"
+
+namespace datalog {
+
+    class bdd_manager;
+
+    class bdd {
+        friend class bdd_manager;
+        bdd_manager * m_manager;
+        unsigned      m_root;
+        bdd(unsigned root, bdd_manager & m);
+    public:
+        bdd(bdd const & other);
+        ~bdd();
+        bdd & operator=(bdd const & other);
+        unsigned root() const { return m_root; }
+        bool is_true() const { return m_root == 1; }
+        bool is_false() const { return m_root == 0; }
+        bool operator==(bdd const & other) const { return m_root == other.m_root; }
+        bool operator!=(bdd const & other) const { return m_root != other.m_root; }
+    };
+
+    class bdd_manager {
+        friend class bdd;
+
+        enum op_kind {
+            OP_AND,
+            OP_OR,
+            OP_NOT,
+            OP_ITE,
+            OP_EXISTS,
+            OP_AND_EXISTS,
+            OP_PERMUTE
+        };
+
+        struct node {
+            unsigned m_var;      // UINT_MAX for the terminals.
+            unsigned m_lo;
+            unsigned m_hi;
+            unsigned m_refcount; // number of bdd handles pointing to the node.
+            node():m_var(UINT_MAX), m_lo(0), m_hi(0), m_refcount(0) {}
+            node(unsigned v, unsigned lo, unsigned hi):m_var(v), m_lo(lo), m_hi(hi), m_refcount(0) {}
+        };
+
+        struct cache_entry {
+            unsigned m_op;
+            unsigned m_a;
+            unsigned m_b;
+            unsigned m_c;
+            unsigned m_result;
+            cache_entry():m_op(UINT_MAX), m_a(0), m_b(0), m_c(0), m_result(0) {}
+        };
+
+        struct node_hash_proc {
+            bdd_manager const * m_manager;
+            node_hash_proc(bdd_manager const * m = 0):m_manager(m) {}
+            unsigned operator()(unsigned n) const {
+                node const & d = m_manager->m_nodes[n];
+                return mk_mix(d.m_var, d.m_lo, d.m_hi);
+            }
+        };
+
+        struct node_eq_proc {
+            bdd_manager const * m_manager;
+            node_eq_proc(bdd_manager const * m = 0):m_manager(m) {}
+            bool operator()(unsigned n1, unsigned n2) const {
+                node const & d1 = m_manager->m_nodes[n1];
+                node const & d2 = m_manager->m_nodes[n2];
+                return d1.m_var == d2.m_var && d1.m_lo == d2.m_lo && d1.m_hi == d2.m_hi;
+            }
+        };
+
+        typedef hashtable<unsigned, node_hash_proc, node_eq_proc> unique_table;
+
+        svector<node>           m_nodes;
+        unsigned_vector         m_free_nodes;
+        unique_table            m_unique;
+        svector<cache_entry>    m_cache;
+        unsigned                m_gc_threshold;
+        unsigned                m_permute_id;  // distinguishes cache entries of different permutations.
+        u_map<unsigned> const * m_permutation; // permutation applied by mk_permute_rec.
+        unsigned                m_num_gc;
+
+        bool is_const(unsigned n) const { return n <= 1; }
+        unsigned var(unsigned n) const { return m_nodes[n].m_var; }
+        unsigned lo(unsigned n) const { return m_nodes[n].m_lo; }
+        unsigned hi(unsigned n) const { return m_nodes[n].m_hi; }
+        unsigned level(unsigned n) const { return m_nodes[n].m_var; }
+
+        unsigned mk_node(unsigned v, unsigned lo, unsigned hi);
+        unsigned mk_var_core(unsigned v) { return mk_node(v, 0, 1); }
+
+        cache_entry & get_entry(unsigned op, unsigned a, unsigned b, unsigned c);
+        bool find_cache(unsigned op, unsigned a, unsigned b, unsigned c, unsigned & r);
+        void insert_cache(unsigned op, unsigned a, unsigned b, unsigned c, unsigned r);
+
+        unsigned mk_and_rec(unsigned a, unsigned b);
+        unsigned mk_or_rec(unsigned a, unsigned b);
+        unsigned mk_not_rec(unsigned a);
+        unsigned mk_ite_rec(unsigned f, unsigned g, unsigned h);
+        unsigned mk_exists_rec(unsigned a, unsigned cube);
+        unsigned mk_and_exists_rec(unsigned a, unsigned b, unsigned cube);
+        unsigned mk_permute_rec(unsigned a);
+        unsigned mk_cube(unsigned num_vars, unsigned const * vars);
+        double count_rec(unsigned n, u_map<unsigned> const & pos, unsigned num_vars, u_map<double> & cache);
+
+        void inc_ref(unsigned n) { if (!is_const(n)) m_nodes[n].m_refcount++; }
+        void dec_ref(unsigned n) { if (!is_const(n)) { SASSERT(m_nodes[n].m_refcount > 0); m_nodes[n].m_refcount--; } }
+
+        void gc();
+        void try_gc() { if (m_nodes.size() - m_free_nodes.size() > m_gc_threshold) gc(); }
+
+        bdd mk_bdd(unsigned r) { return bdd(r, *this); }
+
+    public:
+        bdd_manager();
+
+        bdd mk_true() { return mk_bdd(1); }
+        bdd mk_false() { return mk_bdd(0); }
+        bdd mk_var(unsigned v);
+        bdd mk_nvar(unsigned v);
+        bdd mk_and(bdd const & a, bdd const & b);
+        bdd mk_or(bdd const & a, bdd const & b);
+        bdd mk_not(bdd const & a);
+        bdd mk_ite(bdd const & f, bdd const & g, bdd const & h);
+        bdd mk_iff(bdd const & a, bdd const & b) { return mk_ite(a, b, mk_not(b)); }
+
+        /**
+           \brief Existentially quantify the variables vars in a.
+        */
+        bdd mk_exists(unsigned num_vars, unsigned const * vars, bdd const & a);
+
+        /**
+           \brief Return (exists vars. a & b) without building a & b (relational product).
+        */
+        bdd mk_and_exists(unsigned num_vars, unsigned const * vars, bdd const & a, bdd const & b);
+
+        /**
+           \brief Replace every variable v in a by perm[v]. Variables that are not keys of perm are unchanged.
+           perm must be injective on the support of a.
+        */
+        bdd mk_permute(u_map<unsigned> const & perm, bdd const & a);
+
+        /**
+           \brief Number of assignments to vars that satisfy a.
+           The variables in the support of a must be contained in vars, and vars must be sorted.
+        */
+        double count(bdd const & a, unsigned_vector const & vars);
+
+        /**
+           \brief Number of internal nodes of a.
+        */
+        unsigned dag_size(bdd const & a);
+
+        /**
+           \brief Number of nodes in the unique table (alive or waiting to be collected).
+        */
+        unsigned num_nodes() const { return m_nodes.size() - m_free_nodes.size(); }
+
+        unsigned num_gc() const { return m_num_gc; }
+
+        // navigation
+        unsigned get_var(unsigned n) const { return var(n); }
+        unsigned get_lo(unsigned n) const { return lo(n); }
+        unsigned get_hi(unsigned n) const { return hi(n); }
+    };
+
+    inline bdd::bdd(unsigned root, bdd_manager & m):m_manager(&m), m_root(root) { m_manager->inc_ref(m_root); }
+    inline bdd::bdd(bdd const & other):m_manager(other.m_manager), m_root(other.m_root) { m_manager->inc_ref(m_root); }
+    inline bdd::~bdd() { m_manager->dec_ref(m_root); }
+    inline bdd & bdd::operator=(bdd const & other) {
+        SASSERT(m_manager == other.m_manager);
+        unsigned old_root = m_root;
+        m_root = other.m_root;
+        m_manager->inc_ref(m_root);
+        m_manager->dec_ref(old_root);
+        return *this;
+    }
+
+};
+
+#endif /* _DL_BDD_H_ */
@@ -0,0 +1,716 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    dl_bdd_table.cpp
+
+Abstract:
+
+    Table plugin that represents relations symbolically as BDDs.
+
+Author:
+
+Revision History:
+
+--*/
+
+#include<limits>
+#include"dl_context.h"
+#include"dl_util.h"
+#include"dl_bdd_table.h"
+#include"dl_relation_manager.h"
+#include"fixedpoint_params.hpp"
+
+namespace datalog {
+
+    // -----------------------------------
+    //
+    // bdd_table_plugin
+    //
+    // -----------------------------------
+
+    bdd_table_plugin::bdd_table_plugin(relation_manager & manager)
+        : table_plugin(symbol("bdd"), manager),
+          m_interleave(manager.get_context().get_params().bdd_interleave_columns()) {
+    }
+
+    bdd_table const & bdd_table_plugin::get(table_base const & t) {
+        return static_cast<bdd_table const &>(t);
+    }
+
+    bdd_table & bdd_table_plugin::get(table_base & t) {
+        return static_cast<bdd_table &>(t);
+    }
+
+    unsigned bdd_table_plugin::get_num_bits(table_sort s) {
+        if (s == 0) {
+            return 64;
+        }
+        uint64 max_value = s - 1;
+        unsigned num_bits = 1;
+        while (num_bits < 64 && (max_value >> num_bits) != 0) {
+            ++num_bits;
+        }
+        return num_bits;
+    }
+
+    /**
+       \brief BDD variable for bit \c pos of column \c col, where the bits of
+       every column are numbered from 0 (most significant bit of a 64 bit
+       value) to 63 (least significant bit).
+       A column of n bits uses the positions 64-n, ..., 63, so that equal
+       positions have the same significance in all columns.
+    */
+    unsigned bdd_table_plugin::get_var(unsigned col, unsigned pos) const {
+        SASSERT(col < MAX_COLUMNS && pos < 64);
+        return m_interleave ? pos * MAX_COLUMNS + col : col * 64 + pos;
+    }
+
+    void bdd_table_plugin::get_vars(const table_signature & sig, unsigned col, unsigned_vector & vars) const {
+        unsigned num_bits = get_num_bits(sig[col]);
+        for (unsigned pos = 64 - num_bits; pos < 64; ++pos) {
+            vars.push_back(get_var(col, pos));
+        }
+    }
+
+    void bdd_table_plugin::get_vars(const table_signature & sig, unsigned col_cnt, const unsigned * cols,
+                                    unsigned_vector & vars) const {
+        for (unsigned i = 0; i < col_cnt; ++i) {
+            get_vars(sig, cols[i], vars);
+        }
+    }
+
+    /**
+       \brief Constraint: value of column \c col is \c value.
+       It is false if \c value does not fit in the bits of the column.
+    */
+    bdd bdd_table_plugin::mk_value(const table_signature & sig, unsigned col, table_element value) {
+        unsigned num_bits = get_num_bits(sig[col]);
+        if (num_bits < 64 && (value >> num_bits) != 0) {
+            return m_manager.mk_false();
+        }
+        bdd r = m_manager.mk_true();
+        for (unsigned i = 0; i < num_bits; ++i) {
+            unsigned v = get_var(col, 63 - i);
+            if ((value >> i) & 1) {
+                r = m_manager.mk_and(r, m_manager.mk_var(v));
+            }
+            else {
+                r = m_manager.mk_and(r, m_manager.mk_nvar(v));
+            }
+        }
+        return r;
+    }
+
+    /**
+       \brief Constraint: value of column \c col is smaller than \c bound.
+    */
+    bdd bdd_table_plugin::mk_lt(const table_signature & sig, unsigned col, uint64 bound) {
+        unsigned num_bits = get_num_bits(sig[col]);
+        if (num_bits == 64 || bound >= (static_cast<uint64>(1) << num_bits)) {
+            return m_manager.mk_true();
+        }
+        // process bits from least to most significant, r is the constraint on the lower bits.
+        bdd r = m_manager.mk_false();
+        for (unsigned i = 0; i < num_bits; ++i) {
+            bdd x = m_manager.mk_var(get_var(col, 63 - i));
+            if ((bound >> i) & 1) {
+                r = m_manager.mk_ite(x, r, m_manager.mk_true());
+            }
+            else {
+                r = m_manager.mk_ite(x, m_manager.mk_false(), r);
+            }
+        }
+        return r;
+    }
+
+    bdd bdd_table_plugin::mk_eq(const table_signature & sig, unsigned col1, unsigned col2) {
+        unsigned num_bits1 = get_num_bits(sig[col1]);
+        unsigned num_bits2 = get_num_bits(sig[col2]);
+        unsigned num_bits  = std::max(num_bits1, num_bits2);
+        bdd r = m_manager.mk_true();
+        for (unsigned i = 0; i < num_bits; ++i) {
+            unsigned pos = 63 - i;
+            bdd x = i < num_bits1 ? m_manager.mk_var(get_var(col1, pos)) : m_manager.mk_false();
+            bdd y = i < num_bits2 ? m_manager.mk_var(get_var(col2, pos)) : m_manager.mk_false();
+            r = m_manager.mk_and(r, m_manager.mk_iff(x, y));
+        }
+        return r;
+    }
+
+    bdd bdd_table_plugin::mk_eq(const table_signature & sig, unsigned col_cnt, const unsigned * cols1,
+                                const unsigned * cols2) {
+        bdd r = m_manager.mk_true();
+        for (unsigned i = 0; i < col_cnt; ++i) {
+            r = m_manager.mk_and(r, mk_eq(sig, cols1[i], cols2[i]));
+        }
+        return r;
+    }
+
+    bdd bdd_table_plugin::mk_domain(const table_signature & sig) {
+        bdd r = m_manager.mk_true();
+        for (unsigned i = 0; i < sig.size(); ++i) {
+            if (sig[i] != 0) {
+                r = m_manager.mk_and(r, mk_lt(sig, i, sig[i]));
+            }
+        }
+        return r;
+    }
+
+    bdd bdd_table_plugin::mk_move(const table_signature & sig, const unsigned_vector & cols, bdd const & b) {
+        SASSERT(cols.size() == sig.size());
+        u_map<unsigned> perm;
+        for (unsigned i = 0; i < cols.size(); ++i) {
+            if (cols[i] == UINT_MAX || cols[i] == i) {
+                continue;
+            }
+            unsigned num_bits = get_num_bits(sig[i]);
+            for (unsigned pos = 64 - num_bits; pos < 64; ++pos) {
+                perm.insert(get_var(i, pos), get_var(cols[i], pos));
+            }
+        }
+        if (perm.empty()) {
+            return b;
+        }
+        return m_manager.mk_permute(perm, b);
+    }
+
+    bdd bdd_table_plugin::mk_shift(const table_signature & sig, unsigned offset, bdd const & b) {
+        unsigned_vector cols;
+        for (unsigned i = 0; i < sig.size(); ++i) {
+            cols.push_back(i + offset);
+        }
+        return mk_move(sig, cols, b);
+    }
+
+    /**
+       \brief Existentially quantify the removed columns of \c b and close the gaps they leave.
+    */
+    bdd bdd_table_plugin::mk_project(const table_signature & sig, unsigned col_cnt, const unsigned * removed_cols,
+                                     bdd const & b) {
+        unsigned_vector vars;
+        get_vars(sig, col_cnt, removed_cols, vars);
+        bdd r = m_manager.mk_exists(vars.size(), vars.c_ptr(), b);
+        unsigned_vector cols;
+        unsigned r_idx = 0;
+        for (unsigned i = 0; i < sig.size(); ++i) {
+            if (r_idx < col_cnt && removed_cols[r_idx] == i) {
+                cols.push_back(UINT_MAX);
+                ++r_idx;
+            }
+            else {
+                cols.push_back(i - r_idx);
+            }
+        }
+        return mk_move(sig, cols, r);
+    }
+
+    bdd_table * bdd_table_plugin::mk_table(const table_signature & sig, bdd const & b) {
+        return alloc(bdd_table, *this, sig, b);
+    }
+
+    bool bdd_table_plugin::can_handle_signature(const table_signature & s) {
+        return s.functional_columns() == 0 && s.size() <= MAX_COLUMNS;
+    }
+
+    table_base * bdd_table_plugin::mk_empty(const table_signature & s) {
+        SASSERT(can_handle_signature(s));
+        return mk_table(s, m_manager.mk_false());
+    }
+
+    class bdd_table_plugin::join_fn : public convenient_table_join_fn {
+    public:
+        join_fn(const table_signature & sig1, const table_signature & sig2, unsigned col_cnt,
+                const unsigned * cols1, const unsigned * cols2)
+            : convenient_table_join_fn(sig1, sig2, col_cnt, cols1, cols2) {}
+
+        virtual table_base * operator()(const table_base & t1, const table_base & t2) {
+            const bdd_table & bt1 = get(t1);
+            const bdd_table & bt2 = get(t2);
+            bdd_table_plugin & plugin = bt1.get_plugin();
+            bdd_manager & m = plugin.get_bdd_manager();
+            const table_signature & sig = get_result_signature();
+            unsigned n1 = t1.get_signature().size();
+            unsigned_vector cols2;
+            for (unsigned i = 0; i < m_cols2.size(); ++i) {
+                cols2.push_back(m_cols2[i] + n1);
+            }
+            bdd r = plugin.mk_eq(sig, m_cols1.size(), m_cols1.c_ptr(), cols2.c_ptr());
+            r = m.mk_and(r, bt1.get_bdd());
+            r = m.mk_and(r, plugin.mk_shift(t2.get_signature(), n1, bt2.get_bdd()));
+            return plugin.mk_table(sig, r);
+        }
+    };
+
+    table_join_fn * bdd_table_plugin::mk_join_fn(const table_base & t1, const table_base & t2,
+            unsigned col_cnt, const unsigned * cols1, const unsigned * cols2) {
+        if (t1.get_kind() != get_kind() || t2.get_kind() != get_kind() ||
+            t1.get_signature().size() + t2.get_signature().size() > MAX_COLUMNS) {
+            return 0;
+        }
+        return alloc(join_fn, t1.get_signature(), t2.get_signature(), col_cnt, cols1, cols2);
+    }
+
+    class bdd_table_plugin::join_project_fn : public convenient_table_join_project_fn {
+        table_signature m_joined_sig;
+    public:
+        join_project_fn(const table_signature & sig1, const table_signature & sig2, unsigned col_cnt,
+                        const unsigned * cols1, const unsigned * cols2, unsigned removed_col_cnt,
+                        const unsigned * removed_cols)
+            : convenient_table_join_project_fn(sig1, sig2, col_cnt, cols1, cols2, removed_col_cnt, removed_cols) {
+            table_signature::from_join(sig1, sig2, col_cnt, cols1, cols2, m_joined_sig);
+        }
+
+        virtual table_base * operator()(const table_base & t1, const table_base & t2) {
+            const bdd_table & bt1 = get(t1);
+            const bdd_table & bt2 = get(t2);
+            bdd_table_plugin & plugin = bt1.get_plugin();
+            bdd_manager & m = plugin.get_bdd_manager();
+            unsigned n1 = t1.get_signature().size();
+            unsigned_vector cols2;
+            for (unsigned i = 0; i < m_cols2.size(); ++i) {
+                cols2.push_back(m_cols2[i] + n1);
+            }
+            bdd r1 = plugin.mk_eq(m_joined_sig, m_cols1.size(), m_cols1.c_ptr(), cols2.c_ptr());
+            r1 = m.mk_and(r1, bt1.get_bdd());
+            bdd r2 = plugin.mk_shift(t2.get_signature(), n1, bt2.get_bdd());
+            // the removed columns are quantified while the conjunction is built.
+            unsigned_vector vars;
+            plugin.get_vars(m_joined_sig, m_removed_cols.size(), m_removed_cols.c_ptr(), vars);
+            bdd r = m.mk_and_exists(vars.size(), vars.c_ptr(), r1, r2);
+            r = plugin.mk_project(m_joined_sig, m_removed_cols.size(), m_removed_cols.c_ptr(), r);
+            return plugin.mk_table(get_result_signature(), r);
+        }
+    };
+
+    table_join_fn * bdd_table_plugin::mk_join_project_fn(const table_base & t1, const table_base & t2,
+            unsigned col_cnt, const unsigned * cols1, const unsigned * cols2, unsigned removed_col_cnt,
+            const unsigned * removed_cols) {
+        if (t1.get_kind() != get_kind() || t2.get_kind() != get_kind() ||
+            t1.get_signature().size() + t2.get_signature().size() > MAX_COLUMNS) {
+            return 0;
+        }
+        return alloc(join_project_fn, t1.get_signature(), t2.get_signature(), col_cnt, cols1, cols2,
+                     removed_col_cnt, removed_cols);
+    }
+
+    class bdd_table_plugin::union_fn : public table_union_fn {
+    public:
+        virtual void operator()(table_base & tgt0, const table_base & src0, table_base * delta0) {
+            bdd_table & tgt = get(tgt0);
+            const bdd_table & src = get(src0);
+            bdd_manager & m = tgt.get_plugin().get_bdd_manager();
+            if (delta0) {
+                bdd_table & delta = get(*delta0);
+                bdd added = m.mk_and(src.get_bdd(), m.mk_not(tgt.get_bdd()));
+                delta.set_bdd(m.mk_or(delta.get_bdd(), added));
+                tgt.set_bdd(m.mk_or(tgt.get_bdd(), added));
+            }
+            else {
+                tgt.set_bdd(m.mk_or(tgt.get_bdd(), src.get_bdd()));
+            }
+        }
+    };
+
+    table_union_fn * bdd_table_plugin::mk_union_fn(const table_base & tgt, const table_base & src,
+            const table_base * delta) {
+        if (tgt.get_kind() != get_kind() || src.get_kind() != get_kind() ||
+            (delta && delta->get_kind() != get_kind()) ||
+            tgt.get_signature() != src.get_signature() ||
+            (delta && delta->get_signature() != tgt.get_signature())) {
+            return 0;
+        }
+        return alloc(union_fn);
+    }
+
+    class bdd_table_plugin::project_fn : public convenient_table_project_fn {
+        table_signature m_orig_sig;
+    public:
+        project_fn(const table_signature & orig_sig, unsigned col_cnt, const unsigned * removed_cols)
+            : convenient_table_project_fn(orig_sig, col_cnt, removed_cols),
+              m_orig_sig(orig_sig) {}
+
+        virtual table_base * operator()(const table_base & t) {
+            const bdd_table & bt = get(t);
+            bdd_table_plugin & plugin = bt.get_plugin();
+            bdd r = plugin.mk_project(m_orig_sig, m_removed_cols.size(), m_removed_cols.c_ptr(), bt.get_bdd());
+            return plugin.mk_table(get_result_signature(), r);
+        }
+    };
+
+    table_transformer_fn * bdd_table_plugin::mk_project_fn(const table_base & t, unsigned col_cnt,
+            const unsigned * removed_cols) {
+        if (t.get_kind() != get_kind()) {
+            return 0;
+        }
+        return alloc(project_fn, t.get_signature(), col_cnt, removed_cols);
+    }
+
+    class bdd_table_plugin::rename_fn : public convenient_table_rename_fn {
+        table_signature m_orig_sig;
+        unsigned_vector m_new_cols;
+    public:
+        rename_fn(const table_signature & orig_sig, unsigned cycle_len, const unsigned * cycle)
+            : convenient_table_rename_fn(orig_sig, cycle_len, cycle),
+              m_orig_sig(orig_sig) {
+            // column cycle[i] moves to cycle[i-1] and cycle[0] moves to cycle[cycle_len-1],
+            // see permutate_by_cycle.
+            for (unsigned i = 0; i < orig_sig.size(); ++i) {
+                m_new_cols.push_back(i);
+            }
+            for (unsigned i = 1; i < cycle_len; ++i) {
+                m_new_cols[cycle[i]] = cycle[i-1];
+            }
+            m_new_cols[cycle[0]] = cycle[cycle_len-1];
+        }
+
+        virtual table_base * operator()(const table_base & t) {
+            const bdd_table & bt = get(t);
+            bdd_table_plugin & plugin = bt.get_plugin();
+            return plugin.mk_table(get_result_signature(), plugin.mk_move(m_orig_sig, m_new_cols, bt.get_bdd()));
+        }
+    };
+
+    table_transformer_fn * bdd_table_plugin::mk_rename_fn(const table_base & t, unsigned permutation_cycle_len,
+            const unsigned * permutation_cycle) {
+        if (t.get_kind() != get_kind()) {
+            return 0;
+        }
+        return alloc(rename_fn, t.get_signature(), permutation_cycle_len, permutation_cycle);
+    }
+
+    class bdd_table_plugin::filter_identical_fn : public table_mutator_fn {
+        unsigned_vector m_cols;
+    public:
+        filter_identical_fn(unsigned col_cnt, const unsigned * identical_cols)
+            : m_cols(col_cnt, identical_cols) {}
+
+        virtual void operator()(table_base & t) {
+            bdd_table & bt = get(t);
+            bdd_table_plugin & plugin = bt.get_plugin();
+            bdd_manager & m = plugin.get_bdd_manager();
+            bdd r = bt.get_bdd();
+            for (unsigned i = 1; i < m_cols.size(); ++i) {
+                r = m.mk_and(r, plugin.mk_eq(t.get_signature(), m_cols[0], m_cols[i]));
+            }
+            bt.set_bdd(r);
+        }
+    };
+
+    table_mutator_fn * bdd_table_plugin::mk_filter_identical_fn(const table_base & t, unsigned col_cnt,
+            const unsigned * identical_cols) {
+        if (t.get_kind() != get_kind()) {
+            return 0;
+        }
+        return alloc(filter_identical_fn, col_cnt, identical_cols);
+    }
+
+    class bdd_table_plugin::filter_equal_fn : public table_mutator_fn {
+        table_element m_value;
+        unsigned      m_col;
+    public:
+        filter_equal_fn(const table_element & value, unsigned col)
+            : m_value(value), m_col(col) {}
+
+        virtual void operator()(table_base & t) {
+            bdd_table & bt = get(t);
+            bdd_table_plugin & plugin = bt.get_plugin();
+            bdd_manager & m = plugin.get_bdd_manager();
+            bt.set_bdd(m.mk_and(bt.get_bdd(), plugin.mk_value(t.get_signature(), m_col, m_value)));
+        }
+    };
+
+    table_mutator_fn * bdd_table_plugin::mk_filter_equal_fn(const table_base & t, const table_element & value,
+            unsigned col) {
+        if (t.get_kind() != get_kind()) {
+            return 0;
+        }
+        return alloc(filter_equal_fn, value, col);
+    }
+
+    class bdd_table_plugin::select_equal_and_project_fn : public convenient_table_transformer_fn {
+        table_signature m_orig_sig;
+        table_element   m_value;
+        unsigned        m_col;
+    public:
+        select_equal_and_project_fn(const table_signature & orig_sig, table_element value, unsigned col)
+            : m_orig_sig(orig_sig), m_value(value), m_col(col) {
+            table_signature::from_project(orig_sig, 1, &col, get_result_signature());
+        }
+
+        virtual table_base * operator()(const table_base & t) {
+            const bdd_table & bt = get(t);
+            bdd_table_plugin & plugin = bt.get_plugin();
+            bdd_manager & m = plugin.get_bdd_manager();
+            unsigned_vector vars;
+            plugin.get_vars(m_orig_sig, m_col, vars);
+            bdd r = m.mk_and_exists(vars.size(), vars.c_ptr(), bt.get_bdd(),
+                                    plugin.mk_value(m_orig_sig, m_col, m_value));
+            r = plugin.mk_project(m_orig_sig, 1, &m_col, r);
+            return plugin.mk_table(get_result_signature(), r);
+        }
+    };
+
+    table_transformer_fn * bdd_table_plugin::mk_select_equal_and_project_fn(const table_base & t,
+            const table_element & value, unsigned col) {
+        if (t.get_kind() != get_kind()) {
+            return 0;
+        }
+        return alloc(select_equal_and_project_fn, t.get_signature(), value, col);
+    }
+
+    class bdd_table_plugin::filter_by_negation_fn : public convenient_table_negation_filter_fn {
+        table_signature m_joined_sig;
+        unsigned_vector m_neg_vars;
+        unsigned_vector m_shifted_cols2;
+    public:
+        filter_by_negation_fn(const table_base & t, const table_base & negated_obj, unsigned joined_col_cnt,
+                              const unsigned * t_cols, const unsigned * negated_cols)
+            : convenient_table_negation_filter_fn(t, negated_obj, joined_col_cnt, t_cols, negated_cols) {
+            const table_signature & sig1 = t.get_signature();
+            const table_signature & sig2 = negated_obj.get_signature();
+            table_signature::from_join(sig1, sig2, 0, 0, 0, m_joined_sig);
+            unsigned n1 = sig1.size();
+            for (unsigned i = 0; i < joined_col_cnt; ++i) {
+                m_shifted_cols2.push_back(negated_cols[i] + n1);
+            }
+            bdd_table_plugin & plugin = get(t).get_plugin();
+            for (unsigned i = 0; i < sig2.size(); ++i) {
+                plugin.get_vars(m_joined_sig, n1 + i, m_neg_vars);
+            }
+        }
+
+        virtual void operator()(table_base & t, const table_base & negated_obj) {
+            bdd_table & bt = get(t);
+            const bdd_table & neg = get(negated_obj);
+            bdd_table_plugin & plugin = bt.get_plugin();
+            bdd_manager & m = plugin.get_bdd_manager();
+            unsigned n1 = t.get_signature().size();
+            bdd eqs = plugin.mk_eq(m_joined_sig, m_joined_col_cnt, m_cols1.c_ptr(), m_shifted_cols2.c_ptr());
+            bdd shifted = plugin.mk_shift(negated_obj.get_signature(), n1, neg.get_bdd());
+            // rows of t that match some row of the negated table
+            bdd matched = m.mk_and_exists(m_neg_vars.size(), m_neg_vars.c_ptr(), eqs, shifted);
+            bt.set_bdd(m.mk_and(bt.get_bdd(), m.mk_not(matched)));
+        }
+    };
+
+    table_intersection_filter_fn * bdd_table_plugin::mk_filter_by_negation_fn(const table_base & t,
+            const table_base & negated_obj, unsigned joined_col_cnt,
+            const unsigned * t_cols, const unsigned * negated_cols) {
+        if (t.get_kind() != get_kind() || negated_obj.get_kind() != get_kind() ||
+            t.get_signature().size() + negated_obj.get_signature().size() > MAX_COLUMNS) {
+            return 0;
+        }
+        return alloc(filter_by_negation_fn, t, negated_obj, joined_col_cnt, t_cols, negated_cols);
+    }
+
+    // -----------------------------------
+    //
+    // bdd_table
+    //
+    // -----------------------------------
+
+    /**
+       \brief Enumerate the rows of a table by a depth first traversal of its BDD
+       along the bits of all columns. Only the current path is stored, the next
+       row is computed when the iterator is advanced.
+    */
+    class bdd_table::our_iterator_core : public iterator_core {
+
+        class our_row : public row_interface {
+            const our_iterator_core & m_parent;
+        public:
+            our_row(const our_iterator_core & p) : row_interface(p.m_table), m_parent(p) {}
+
+            virtual table_element operator[](unsigned col) const {
+                return m_parent.m_current[col];
+            }
+        };
+
+        struct bit_info {
+            unsigned m_var;
+            unsigned m_col;
+            unsigned m_shift;
+            bool operator<(bit_info const & other) const { return m_var < other.m_var; }
+        };
+
+        const bdd_table &      m_table;
+        bdd_manager &          m_manager;
+        svector<bit_info>      m_bits;
+        unsigned_vector        m_nodes;    // m_nodes[i] is the node of the path before bit i is assigned
+        svector<bool>          m_branch;   // m_branch[i] is the value of bit i on the path
+        table_fact             m_current;
+        bool                   m_finished;
+        our_row                m_row_obj;
+
+        unsigned child(unsigned i, bool hi) const {
+            unsigned n = m_nodes[i];
+            if (n > 1 && m_manager.get_var(n) == m_bits[i].m_var) {
+                return hi ? m_manager.get_hi(n) : m_manager.get_lo(n);
+            }
+            return n;
+        }
+
+        void set_branch(unsigned i, bool hi) {
+            bit_info const & b = m_bits[i];
+            table_element mask = static_cast<table_element>(1) << b.m_shift;
+            if (hi) {
+                m_current[b.m_col] |= mask;
+            }
+            else {
+                m_current[b.m_col] &= ~mask;
+            }
+            m_branch[i] = hi;
+            m_nodes[i + 1] = child(i, hi);
+        }
+
+        /**
+           \brief Move to the next path to the true node. The search continues below
+           node m_nodes[i] if \c down is true, and backtracks from bit \c i otherwise.
+        */
+        void next(unsigned i, bool down) {
+            unsigned num_bits = m_bits.size();
+            while (true) {
+                if (down) {
+                    if (m_nodes[i] == 0) {
+                        down = false;
+                    }
+                    else if (i == num_bits) {
+                        SASSERT(m_nodes[i] == 1);
+                        return;
+                    }
+                    else {
+                        set_branch(i, false);
+                        ++i;
+                    }
+                }
+                else {
+                    if (i == 0) {
+                        m_finished = true;
+                        return;
+                    }
+                    --i;
+                    if (!m_branch[i]) {
+                        set_branch(i, true);
+                        ++i;
+                        down = true;
+                    }
+                }
+            }
+        }
+
+    public:
+        our_iterator_core(const bdd_table & t, bool finished)
+            : m_table(t),
+              m_manager(t.get_plugin().get_bdd_manager()),
+              m_finished(finished),
+              m_row_obj(*this) {
+            if (finished) {
+                return;
+            }
+            bdd_table_plugin & plugin = t.get_plugin();
+            const table_signature & sig = t.get_signature();
+            unsigned num_cols = sig.size();
+            for (unsigned col = 0; col < num_cols; ++col) {
+                unsigned num_bits = bdd_table_plugin::get_num_bits(sig[col]);
+                for (unsigned i = 0; i < num_bits; ++i) {
+                    bit_info b;
+                    b.m_var   = plugin.get_var(col, 63 - i);
+                    b.m_col   = col;
+                    b.m_shift = i;
+                    m_bits.push_back(b);
+                }
+            }
+            std::sort(m_bits.begin(), m_bits.end());
+            m_nodes.resize(m_bits.size() + 1, 0);
+            m_branch.resize(m_bits.size(), false);
+            m_current.resize(num_cols, 0);
+            m_nodes[0] = t.get_bdd().root();
+            next(0, true);
+        }
+
+        virtual bool is_finished() const {
+            return m_finished;
+        }
+
+        virtual row_interface & operator*() {
+            SASSERT(!is_finished());
+            return m_row_obj;
+        }
+
+        virtual void operator++() {
+            SASSERT(!is_finished());
+            next(m_bits.size(), false);
+        }
+    };
+
+    bdd_table::bdd_table(bdd_table_plugin & plugin, const table_signature & sig, bdd const & b)
+        : table_base(plugin, sig),
+          m_bdd(b) {
+    }
+
+    bdd bdd_table::mk_fact(const table_element * f) const {
+        bdd_table_plugin & plugin = get_plugin();
+        bdd_manager & m = plugin.get_bdd_manager();
+        const table_signature & sig = get_signature();
+        bdd r = m.mk_true();
+        for (unsigned i = 0; i < sig.size(); ++i) {
+            r = m.mk_and(r, plugin.mk_value(sig, i, f[i]));
+        }
+        return r;
+    }
+
+    void bdd_table::add_fact(const table_fact & f) {
+        bdd_manager & m = get_plugin().get_bdd_manager();
+        m_bdd = m.mk_or(m_bdd, mk_fact(f.c_ptr()));
+    }
+
+    void bdd_table::remove_fact(const table_element* fact) {
+        bdd_manager & m = get_plugin().get_bdd_manager();
+        m_bdd = m.mk_and(m_bdd, m.mk_not(mk_fact(fact)));
+    }
+
+    bool bdd_table::contains_fact(const table_fact & f) const {
+        bdd_manager & m = get_plugin().get_bdd_manager();
+        return !m.mk_and(m_bdd, mk_fact(f.c_ptr())).is_false();
+    }
+
+    table_base * bdd_table::clone() const {
+        return get_plugin().mk_table(get_signature(), m_bdd);
+    }
+
+    table_base * bdd_table::complement(func_decl* p, const table_element * func_columns) const {
+        SASSERT(get_signature().functional_columns() == 0);
+        bdd_table_plugin & plugin = get_plugin();
+        bdd_manager & m = plugin.get_bdd_manager();
+        bdd r = m.mk_and(plugin.mk_domain(get_signature()), m.mk_not(m_bdd));
+        return plugin.mk_table(get_signature(), r);
+    }
+
+    table_base::iterator bdd_table::begin() const {
+        return mk_iterator(alloc(our_iterator_core, *this, false));
+    }
+
+    table_base::iterator bdd_table::end() const {
+        return mk_iterator(alloc(our_iterator_core, *this, true));
+    }
+
+    unsigned bdd_table::get_size_estimate_rows() const {
+        bdd_table_plugin & plugin = get_plugin();
+        const table_signature & sig = get_signature();
+        unsigned_vector vars;
+        for (unsigned i = 0; i < sig.size(); ++i) {
+            plugin.get_vars(sig, i, vars);
+        }
+        std::sort(vars.begin(), vars.end());
+        double r = plugin.get_bdd_manager().count(m_bdd, vars);
+        return r >= static_cast<double>(UINT_MAX) ? UINT_MAX : static_cast<unsigned>(r);
+    }
+
+    unsigned bdd_table::get_size_estimate_bytes() const {
+        // each node stores a variable, two children and a reference counter.
+        return get_plugin().get_bdd_manager().dag_size(m_bdd) * 4 * sizeof(unsigned);
+    }
+
+};
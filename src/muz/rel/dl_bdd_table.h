@@ -0,0 +1,143 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    dl_bdd_table.h
+
+Abstract:
+
+    Table plugin that represents relations symbolically as BDDs.
+
+    Every column of a table is encoded in binary using as many bits as
+    its domain needs. Column i of every table uses the same BDD variables,
+    so joins only need to shift the columns of the second table.
+    The variable order either interleaves the bits of all columns
+    (default), or places the bits of each column next to each other.
+
+Author:
+
+Revision History:
+
+--*/
+#ifndef _DL_BDD_TABLE_H_
+#define _DL_BDD_TABLE_H_
+
+#include "dl_base.h"
+#include "dl_bdd.h"
+
+namespace datalog {
+
+    class bdd_table;
+
+    class bdd_table_plugin : public table_plugin {
+        friend class bdd_table;
+        class join_fn;
+        class join_project_fn;
+        class project_fn;
+        class rename_fn;
+        class union_fn;
+        class filter_identical_fn;
+        class filter_equal_fn;
+        class select_equal_and_project_fn;
+        class filter_by_negation_fn;
+
+        bdd_manager m_manager;
+        bool        m_interleave;
+
+        unsigned get_var(unsigned col, unsigned pos) const;
+        void get_vars(const table_signature & sig, unsigned col, unsigned_vector & vars) const;
+        void get_vars(const table_signature & sig, unsigned col_cnt, const unsigned * cols, unsigned_vector & vars) const;
+
+        bdd mk_value(const table_signature & sig, unsigned col, table_element value);
+        bdd mk_lt(const table_signature & sig, unsigned col, uint64 bound);
+        bdd mk_eq(const table_signature & sig, unsigned col1, unsigned col2);
+        bdd mk_eq(const table_signature & sig, unsigned col_cnt, const unsigned * cols1, const unsigned * cols2);
+        bdd mk_domain(const table_signature & sig);
+
+        /**
+           \brief Move column i of b to column cols[i]. Columns with cols[i] == UINT_MAX must not occur in b.
+        */
+        bdd mk_move(const table_signature & sig, const unsigned_vector & cols, bdd const & b);
+        bdd mk_shift(const table_signature & sig, unsigned offset, bdd const & b);
+        bdd mk_project(const table_signature & sig, unsigned col_cnt, const unsigned * removed_cols, bdd const & b);
+
+        bdd_table * mk_table(const table_signature & sig, bdd const & b);
+
+        static unsigned get_num_bits(table_sort s);
+
+    public:
+        typedef bdd_table table;
+
+        static const unsigned MAX_COLUMNS = 1024;
+
+        bdd_table_plugin(relation_manager & manager);
+
+        bdd_manager & get_bdd_manager() { return m_manager; }
+
+        virtual bool can_handle_signature(const table_signature & s);
+
+        virtual table_base * mk_empty(const table_signature & s);
+
+        static bdd_table const & get(table_base const & t);
+        static bdd_table & get(table_base & t);
+
+    protected:
+        virtual table_join_fn * mk_join_fn(const table_base & t1, const table_base & t2,
+            unsigned col_cnt, const unsigned * cols1, const unsigned * cols2);
+        virtual table_join_fn * mk_join_project_fn(const table_base & t1, const table_base & t2,
+            unsigned col_cnt, const unsigned * cols1, const unsigned * cols2, unsigned removed_col_cnt,
+            const unsigned * removed_cols);
+        virtual table_union_fn * mk_union_fn(const table_base & tgt, const table_base & src,
+            const table_base * delta);
+        virtual table_transformer_fn * mk_project_fn(const table_base & t, unsigned col_cnt,
+            const unsigned * removed_cols);
+        virtual table_transformer_fn * mk_rename_fn(const table_base & t, unsigned permutation_cycle_len,
+            const unsigned * permutation_cycle);
+        virtual table_mutator_fn * mk_filter_identical_fn(const table_base & t, unsigned col_cnt,
+            const unsigned * identical_cols);
+        virtual table_mutator_fn * mk_filter_equal_fn(const table_base & t, const table_element & value,
+            unsigned col);
+        virtual table_transformer_fn * mk_select_equal_and_project_fn(const table_base & t,
+            const table_element & value, unsigned col);
+        virtual table_intersection_filter_fn * mk_filter_by_negation_fn(const table_base & t,
+            const table_base & negated_obj, unsigned joined_col_cnt,
+            const unsigned * t_cols, const unsigned * negated_cols);
+    };
+
+    class bdd_table : public table_base {
+        friend class bdd_table_plugin;
+
+        class our_iterator_core;
+
+        bdd m_bdd;
+
+        bdd_table(bdd_table_plugin & plugin, const table_signature & sig, bdd const & b);
+
+        bdd mk_fact(const table_element * f) const;
+    public:
+        bdd_table_plugin & get_plugin() const
+        { return static_cast<bdd_table_plugin &>(table_base::get_plugin()); }
+
+        bdd const & get_bdd() const { return m_bdd; }
+        void set_bdd(bdd const & b) { m_bdd = b; }
+
+        virtual bool empty() const { return m_bdd.is_false(); }
+        virtual void add_fact(const table_fact & f);
+        virtual void remove_fact(const table_element* fact);
+        virtual bool contains_fact(const table_fact & f) const;
+        virtual void reset() { m_bdd = get_plugin().get_bdd_manager().mk_false(); }
+        virtual table_base * clone() const;
+        virtual table_base * complement(func_decl* p, const table_element * func_columns = 0) const;
+
+        virtual iterator begin() const;
+        virtual iterator end() const;
+
+        virtual unsigned get_size_estimate_rows() const;
+        virtual unsigned get_size_estimate_bytes() const;
+        virtual bool knows_exact_size() const { return true; }
+    };
+
+};
+
+#endif /* _DL_BDD_TABLE_H_ */
@@ -158,6 +158,27 @@ namespace datalog {
         }
     }
 
+    instruction_block & compiler::begin_rule_evaluations(instruction_block & acc) {
+        if (!parallel_rule_evaluation()) {
+            return acc;
+        }
+        instruction_block * rules = alloc(instruction_block);
+        rules->set_observer(&m_instruction_observer);
+        return *rules;
+    }
+
+    void compiler::end_rule_evaluations(instruction_block & rules, instruction_block & acc) {
+        if (&rules == &acc) {
+            return;
+        }
+        rules.set_observer(0);
+        if (rules.size() == 0) {
+            dealloc(&rules);
+            return;
+        }
+        acc.push_back(instruction::mk_parallel(&rules));
+    }
+
     void compiler::make_add_constant_column(func_decl* head_pred, reg_idx src, const relation_sort & s, const relation_element & val,
             reg_idx & result, bool & dealloc, instruction_block & acc) {
         reg_idx singleton_table;
@@ -431,6 +452,175 @@ namespace datalog {
         get_local_indexes_for_projection(t2, counter, t1->get_num_args(), res);
     }
 
+    void compiler::make_linear_tail(app * a, reg_idx src, reg_idx & result, expr_ref_vector & result_expr,
+            bool & dealloc, instruction_block & acc) {
+        ast_manager & m = m_context.get_manager();
+        SASSERT(result_expr.empty());
+        result = src;
+        dealloc = false;
+
+        unsigned n = a->get_num_args();
+        for(unsigned i=0; i<n; i++) {
+            expr * arg = a->get_arg(i);
+            if(is_app(arg)) {
+                SASSERT(m.is_value(arg));
+                reg_idx new_reg;
+                make_select_equal_and_project(result, to_app(arg), result_expr.size(), new_reg, acc);
+                if(dealloc) {
+                    make_dealloc_non_void(result, acc);
+                }
+                result = new_reg;
+                dealloc = true;
+            }
+            else {
+                SASSERT(is_var(arg));
+                result_expr.push_back(arg);
+            }
+        }
+
+        //keep only the first column of every variable
+        unsigned_vector removed_cols;
+        unsigned len = result_expr.size();
+        for(unsigned i=0; i<len; i++) {
+            if(removed_cols.contains(i)) {
+                continue;
+            }
+            unsigned_vector identical;
+            identical.push_back(i);
+            for(unsigned j=i+1; j<len; j++) {
+                if(result_expr.get(j)==result_expr.get(i)) {
+                    identical.push_back(j);
+                    removed_cols.push_back(j);
+                }
+            }
+            if(identical.size()>1) {
+                if(!dealloc) {
+                    make_clone(result, result, acc);
+                    dealloc = true;
+                }
+                acc.push_back(instruction::mk_filter_identical(result, identical.size(), identical.c_ptr()));
+            }
+        }
+        if(!removed_cols.empty()) {
+            std::sort(removed_cols.begin(), removed_cols.end());
+            reg_idx new_reg;
+            make_projection(result, removed_cols.size(), removed_cols.c_ptr(), new_reg, acc);
+            if(dealloc) {
+                make_dealloc_non_void(result, acc);
+            }
+            result = new_reg;
+            dealloc = true;
+
+            expr_ref_vector remaining(m);
+            for(unsigned i=0; i<len; i++) {
+                if(!removed_cols.contains(i)) {
+                    remaining.push_back(result_expr.get(i));
+                }
+            }
+            result_expr.swap(remaining);
+        }
+    }
+
+    /**
+       Order of join variables: the variables shared by most tails are bound first, and the 
+       variables needed in the result before those that are only checked for existence.
+    */
+    class nary_join_var_lt {
+        const unsigned_vector & m_occurrences;
+        const svector<bool> & m_needed;
+    public:
+        nary_join_var_lt(const unsigned_vector & occurrences, const svector<bool> & needed) 
+            : m_occurrences(occurrences), m_needed(needed) {}
+        bool operator()(unsigned v1, unsigned v2) const {
+            if(m_occurrences[v1]!=m_occurrences[v2]) {
+                return m_occurrences[v1]>m_occurrences[v2];
+            }
+            if(m_needed[v1]!=m_needed[v2]) {
+                return m_needed[v1];
+            }
+            return v1<v2;
+        }
+    };
+
+    void compiler::make_nary_join(rule * r, const reg_idx * tail_regs, reg_idx & result, 
+            expr_ref_vector & result_expr, instruction_block & acc) {
+        ast_manager & m = m_context.get_manager();
+        unsigned pt_len = r->get_positive_tail_size();
+        SASSERT(pt_len>=2);
+
+        //after the positive tails are subtracted, the counter contains the variables that 
+        //must be kept in the result
+        rule_counter counter;
+        counter.count_rule_vars(m, r);
+
+        svector<reg_idx> regs;
+        svector<bool> deallocs;
+        unsigned_vector col_positions;  //for every column of the joined relations the position of its variable
+        u_map<unsigned> var_positions;  //variable index -> position in order of first occurrence
+        ptr_vector<expr> var_exprs;
+        relation_signature var_sorts;
+        unsigned_vector occurrences;
+        for(unsigned i=0; i<pt_len; i++) {
+            app * a = r->get_tail(i);
+            counter.count_vars(m, a, -1);
+            reg_idx reg;
+            bool dealloc;
+            expr_ref_vector tail_expr(m);
+            make_linear_tail(a, tail_regs[i], reg, tail_expr, dealloc, acc);
+            regs.push_back(reg);
+            deallocs.push_back(dealloc);
+            for(unsigned j=0; j<tail_expr.size(); j++) {
+                unsigned var_idx = to_var(tail_expr.get(j))->get_idx();
+                unsigned pos;
+                if(!var_positions.find(var_idx, pos)) {
+                    pos = var_exprs.size();
+                    var_positions.insert(var_idx, pos);
+                    var_exprs.push_back(tail_expr.get(j));
+                    var_sorts.push_back(m_reg_signatures[reg][j]);
+                    occurrences.push_back(0);
+                }
+                occurrences[pos]++;
+                col_positions.push_back(pos);
+            }
+        }
+        unsigned var_cnt = var_exprs.size();
+
+        svector<bool> needed;
+        unsigned_vector order;
+        for(unsigned i=0; i<var_cnt; i++) {
+            needed.push_back(counter.get(to_var(var_exprs[i])->get_idx())!=0);
+            order.push_back(i);
+        }
+        std::sort(order.begin(), order.end(), nary_join_var_lt(occurrences, needed));
+        unsigned_vector var_numbers;
+        var_numbers.resize(var_cnt);
+        for(unsigned i=0; i<var_cnt; i++) {
+            var_numbers[order[i]] = i;
+        }
+
+        unsigned_vector col_vars;
+        for(unsigned i=0; i<col_positions.size(); i++) {
+            col_vars.push_back(var_numbers[col_positions[i]]);
+        }
+        unsigned_vector result_vars;
+        relation_signature res_sig;
+        for(unsigned i=0; i<var_cnt; i++) {
+            if(needed[i]) {
+                result_vars.push_back(var_numbers[i]);
+                res_sig.push_back(var_sorts[i]);
+                result_expr.push_back(var_exprs[i]);
+            }
+        }
+        result = get_fresh_register(res_sig);
+        acc.push_back(instruction::mk_nary_join(regs.size(), regs.c_ptr(), col_vars, result_vars, result));
+
+        for(unsigned i=0; i<pt_len; i++) {
+            if(deallocs[i]) {
+                make_dealloc_non_void(regs[i], acc);
+            }
+        }
+    }
+
     void compiler::compile_rule_evaluation_run(rule * r, reg_idx head_reg, const reg_idx * tail_regs, 
             reg_idx delta_reg, bool use_widening, instruction_block & acc) {
         
@@ -444,7 +634,8 @@ namespace datalog {
         TRACE("dl", r->display(m_context, tout); );
 
         unsigned pt_len = r->get_positive_tail_size();
-        SASSERT(pt_len<=2); //we require rules to be processed by the mk_simple_joins rule transformer plugin
+        //rules are split into binary joins by the mk_simple_joins rule transformer plugin, 
+        //except for those left to the n-ary join (see the leapfrog_join parameter)
 
         reg_idx single_res;
         expr_ref_vector single_res_expr(m);
@@ -500,6 +691,9 @@ namespace datalog {
             }
             SASSERT(rem_index==rem_sz);
         }
+        else if(pt_len>2) {
+            make_nary_join(r, tail_regs, single_res, single_res_expr, acc);
+        }
         else if(pt_len==1) {
             reg_idx t_reg=tail_regs[0];
             app * a = r->get_tail(0);
@@ -1117,7 +1311,9 @@ namespace datalog {
         //generate code for the iterative fixpoint search
         //The order in which we iterate the preds_vector matters, since rules can depend on
         //deltas generated earlier in the same iteration.
-        compile_preds(head_preds, widened_preds, &all_tail_deltas, all_head_deltas, *loop_body);
+        instruction_block & rules = begin_rule_evaluations(*loop_body);
+        compile_preds(head_preds, widened_preds, &all_tail_deltas, all_head_deltas, rules);
+        end_rule_evaluations(rules, *loop_body);
 
         svector<reg_idx> loop_control_regs; //loop is controlled by global src regs
         collect_map_range(loop_control_regs, global_tail_deltas);
@@ -1177,7 +1373,9 @@ namespace datalog {
 
         //generate code for the initial run
         // compile_preds(preds_vector, empty_func_decl_set, input_deltas, d_global_src, acc);
-        compile_preds_init(preds_vector, empty_func_decl_set, input_deltas, d_global_src, acc);
+        instruction_block & rules = begin_rule_evaluations(acc);
+        compile_preds_init(preds_vector, empty_func_decl_set, input_deltas, d_global_src, rules);
+        end_rule_evaluations(rules, acc);
 
         if (compile_with_widening()) {
             compile_loop(preds_vector, global_deltas, d_global_tgt, d_global_src, d_local, acc);
@@ -1234,14 +1432,16 @@ namespace datalog {
             output_delta = execution_context::void_register;
         }
 
+        instruction_block & rule_acc = begin_rule_evaluations(acc);
         rule_vector::const_iterator it = rules.begin();
         rule_vector::const_iterator end = rules.end();
         for (; it != end; ++it) {
             rule * r = *it;
             SASSERT(r->get_decl()==head_pred);
 
-            compile_rule_evaluation(r, input_deltas, output_delta, false, acc);
+            compile_rule_evaluation(r, input_deltas, output_delta, false, rule_acc);
         }
+        end_rule_evaluations(rule_acc, acc);
 
         if (add_saturation_marks) {
             //now the predicate is saturated, so we may mark it as such
@@ -1297,7 +1497,7 @@ namespace datalog {
     }
 
     void compiler::do_compilation(instruction_block & execution_code, 
-            instruction_block & termination_code) {
+            instruction_block & termination_code, execution_context::pred2reg * pred_regs) {
 
         unsigned rule_cnt=m_rule_set.get_num_rules();
         if(rule_cnt==0) {
@@ -1334,6 +1534,9 @@ namespace datalog {
             func_decl * pred = e.m_key;
             reg_idx reg = e.m_value;
             termination_code.push_back(instruction::mk_store(m_context.get_manager(), pred, reg));
+            if (pred_regs) {
+                pred_regs->insert(pred, reg);
+            }
         }
 
         acc.set_observer(0);
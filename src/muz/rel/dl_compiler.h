@@ -131,6 +131,12 @@ namespace datalog {
         */
         bool compile_with_widening() const { return m_context.compile_with_widening(); }
 
+        /**
+           If true, the rule evaluations of a stratum are compiled into a block that executes 
+           independent instructions on parallel threads.
+        */
+        bool parallel_rule_evaluation() const { return m_context.parallel_rule_evaluation(); }
+
         reg_idx get_fresh_register(const relation_signature & sig);
         reg_idx get_single_column_register(const relation_sort & s);
 
@@ -159,6 +165,22 @@ namespace datalog {
             reg_idx & result, instruction_block & acc);
         void make_clone(reg_idx src, reg_idx & result, instruction_block & acc);
 
+        /**
+           \brief Into \c acc add code that removes the constant and repeated arguments of the tail
+           \c a from the relation in \c src. Into \c result_expr the variables of the columns of
+           \c result are appended. \c dealloc is set to true if \c result is a fresh register.
+        */
+        void make_linear_tail(app * a, reg_idx src, reg_idx & result, expr_ref_vector & result_expr,
+            bool & dealloc, instruction_block & acc);
+
+        /**
+           \brief Into \c acc add code that joins all positive tails of \c r by a single n-ary join.
+           The \c result has a column for every variable of the positive tails that occurs also 
+           elsewhere in the rule; the variables of the columns are put into \c result_expr.
+        */
+        void make_nary_join(rule * r, const reg_idx * tail_regs, reg_idx & result, 
+            expr_ref_vector & result_expr, instruction_block & acc);
+
         /**
            \brief Into \c acc add code that will assemble columns of a relation according to description
            in \c acis0. The source for bound variables is the table in register \c src.
@@ -171,6 +193,14 @@ namespace datalog {
 
         void make_dealloc_non_void(reg_idx r, instruction_block & acc);
 
+        /**
+           \brief Return the block into which the rule evaluations of a stratum are compiled. 
+           It is either \c acc, or a block that \c end_rule_evaluations adds to \c acc as
+           a parallel instruction.
+        */
+        instruction_block & begin_rule_evaluations(instruction_block & acc);
+        void end_rule_evaluations(instruction_block & rules, instruction_block & acc);
+
         void make_add_constant_column(func_decl* pred, reg_idx src, const relation_sort & s, const relation_element & val,
             reg_idx & result, bool & dealloc, instruction_block & acc);
 
@@ -263,14 +293,18 @@ namespace datalog {
            Instructions to load data and perform computations put into \c execution_code
         */
         void do_compilation(instruction_block & execution_code, 
-            instruction_block & termination_code);
+            instruction_block & termination_code, execution_context::pred2reg * pred_regs);
 
     public:
 
+        /**
+           \brief If \c pred_regs is not zero, the registers that hold the relations of the 
+           predicates are stored in it.
+        */
         static void compile(context & ctx, rule_set const & rules, instruction_block & execution_code, 
-                instruction_block & termination_code) {
+                instruction_block & termination_code, execution_context::pred2reg * pred_regs = 0) {
             compiler(ctx, rules, execution_code)
-                .do_compilation(execution_code, termination_code);
+                .do_compilation(execution_code, termination_code, pred_regs);
         }
 
     };
@@ -23,6 +23,10 @@ Revision History:
 #include"dl_util.h"
 #include"dl_instruction.h"
 #include"rel_context.h"
+#include"dl_table_relation.h"
+#include"task_pool.h"
+#include"scoped_ptr_vector.h"
+#include"error_codes.h"
 #include"debug.h"
 #include"warning.h"
 
@@ -38,6 +42,9 @@ namespace datalog {
         : m_context(context),
         m_stopwatch(0),
         m_timelimit_ms(0),
+        m_replan_factor(0),
+        m_replan_requested(false),
+        m_num_parallel_instrs(0),
         m_eager_emptiness_checking(context.eager_emptiness_checking()) {}
 
     execution_context::~execution_context() {
@@ -55,8 +62,11 @@ namespace datalog {
             }
         }
         m_registers.reset();
+        m_pred_regs.reset();
         m_reg_annotation.reset();
         reset_timelimit();
+        m_replan_factor = 0;
+        m_replan_requested = false;
     }
 
     rel_context& execution_context::get_rel_context() { 
@@ -122,6 +132,31 @@ namespace datalog {
              m_timelimit_ms < static_cast<unsigned>(1000*m_stopwatch->get_current_seconds()));
     }
 
+    /**
+       \brief Relations smaller than this are never worth a new join plan.
+    */
+    #define REPLAN_MIN_ROWS 1000
+
+    bool execution_context::should_replan() {
+        if (m_replan_requested || m_replan_factor == 0) {
+            return m_replan_requested;
+        }
+        relation_manager & rmgr = get_rel_context().get_rmanager();
+        pred2reg::iterator it = m_pred_regs.begin(), end = m_pred_regs.end();
+        for (; it != end; ++it) {
+            reg_type r = reg(it->m_value);
+            if (!r) {
+                continue;
+            }
+            unsigned rows = r->get_size_estimate_rows();
+            if (rows >= REPLAN_MIN_ROWS && rmgr.exceeds_size_estimate(it->m_key, rows, m_replan_factor)) {
+                m_replan_requested = true;
+                break;
+            }
+        }
+        return m_replan_requested;
+    }
+
 
     // -----------------------------------
     //
@@ -217,6 +252,10 @@ namespace datalog {
             ctx.make_empty(m_reg);
             return true;
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_reg);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             ctx.set_register_annotation(m_reg, "alloc");
         }
@@ -246,6 +285,11 @@ namespace datalog {
             }
             return true;
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_src);
+            regs.push_back(m_tgt);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::string str;
             if (ctx.get_register_annotation(m_src, str)) {
@@ -304,6 +348,10 @@ namespace datalog {
                     TRACE("dl", tout << "while loop terminated before completion\n";);
                     return false;
                 }
+                if (ctx.should_replan()) {
+                    TRACE("dl", tout << "while loop terminated for a new join plan\n";);
+                    return false;
+                }
             }
             TRACE("dl", tout << "while loop exited\n";);
             return true;
@@ -326,6 +374,197 @@ namespace datalog {
     }
 
 
+    /**
+       \brief The instructions of the body are scheduled in waves. The instructions of a wave 
+       access disjoint registers, and they are executed on parallel threads. An instruction
+       is placed in the first wave that follows the waves of all preceding instructions that 
+       access one of its registers. Instructions that only read a common register are not 
+       independent, since relations may update internal data in read-only operations (e.g., 
+       sparse tables build their indexes on demand).
+
+       A wave is executed sequentially if it contains relations whose plugins are not thread safe.
+    */
+    class instr_parallel : public instruction {
+        typedef svector<reg_idx> reg_vector;
+        instruction_block * m_body;
+        vector<unsigned_vector> m_waves;      // indices of the instructions of each wave
+        vector<reg_vector>      m_wave_regs;  // registers accessed by each wave
+        unsigned                m_num_regs;   // the registers accessed by the body are less than m_num_regs
+
+        class task : public task_pool::task {
+            instruction &       m_instr;
+            execution_context & m_ctx;
+        public:
+            bool                m_ok;
+            bool                m_failed;
+            unsigned            m_error_code;
+            std::string         m_msg;
+            task(instruction & instr, execution_context & ctx):
+                m_instr(instr), m_ctx(ctx), m_ok(false), m_failed(false), m_error_code(0) {}
+            virtual void run() {
+                cost_recorder crec;
+                crec.start(&m_instr);
+                try {
+                    m_ok = m_instr.perform(m_ctx);
+                }
+                catch (z3_error & ex) {
+                    m_failed     = true;
+                    m_error_code = ex.error_code();
+                }
+                catch (z3_exception & ex) {
+                    m_failed = true;
+                    m_msg    = ex.msg();
+                }
+                catch (...) {
+                    // an exception must not leave a worker thread, it is thrown again by the calling thread.
+                    m_failed = true;
+                    m_msg    = "unexpected exception in parallel instruction";
+                }
+            }
+        };
+
+        void init() {
+            unsigned_vector last;  // register -> 1 + the last wave that accesses it
+            unsigned first = 0;    // first wave available to the next instruction
+            reg_vector regs;
+            for (unsigned i = 0; i < m_body->size(); ++i) {
+                regs.reset();
+                unsigned w;
+                if ((*m_body)[i]->get_registers(regs)) {
+                    w = first;
+                    for (unsigned j = 0; j < regs.size(); ++j) {
+                        reg_idx r = regs[j];
+                        if (r == execution_context::void_register) {
+                            continue;
+                        }
+                        if (r >= last.size()) {
+                            last.resize(r + 1, 0);
+                        }
+                        w = std::max(w, last[r]);
+                    }
+                    for (unsigned j = 0; j < regs.size(); ++j) {
+                        if (regs[j] != execution_context::void_register) {
+                            last[regs[j]] = w + 1;
+                        }
+                    }
+                }
+                else {
+                    // the instruction is executed alone, after all preceding instructions
+                    w     = m_waves.size();
+                    first = w + 1;
+                }
+                if (w == m_waves.size()) {
+                    m_waves.push_back(unsigned_vector());
+                    m_wave_regs.push_back(reg_vector());
+                }
+                m_waves[w].push_back(i);
+                for (unsigned j = 0; j < regs.size(); ++j) {
+                    if (regs[j] != execution_context::void_register) {
+                        m_wave_regs[w].push_back(regs[j]);
+                    }
+                }
+            }
+            m_num_regs = last.size();
+        }
+
+        static bool is_thread_safe(execution_context & ctx, reg_vector const & regs) {
+            for (unsigned i = 0; i < regs.size(); ++i) {
+                relation_base * r = ctx.reg(regs[i]);
+                if (r && !(r->from_table() && 
+                           static_cast<table_relation*>(r)->get_table().get_plugin().is_thread_safe())) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool perform_sequential(execution_context & ctx, unsigned_vector const & wave) {
+            cost_recorder crec;
+            for (unsigned i = 0; i < wave.size(); ++i) {
+                instruction * instr = (*m_body)[wave[i]];
+                crec.start(instr);
+                if (ctx.should_terminate() || !instr->perform(ctx)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool perform_parallel(execution_context & ctx, unsigned_vector const & wave) {
+            scoped_ptr_vector<task>     tasks;
+            ptr_buffer<task_pool::task> ts;
+            for (unsigned i = 0; i < wave.size(); ++i) {
+                tasks.push_back(alloc(task, *(*m_body)[wave[i]], ctx));
+                ts.push_back(tasks[i]);
+            }
+            task_pool::execute(ts.size(), ts.c_ptr());
+            bool ok = true;
+            for (unsigned i = 0; i < tasks.size(); ++i) {
+                task & t = *tasks[i];
+                if (t.m_failed) {
+                    if (t.m_error_code == ERR_MEMOUT) {
+                        throw out_of_memory_error();
+                    }
+                    if (t.m_msg.empty()) {
+                        throw z3_error(t.m_error_code);
+                    }
+                    throw default_exception(t.m_msg);
+                }
+                ok = ok && t.m_ok;
+            }
+            return ok;
+        }
+
+    protected:
+        virtual void process_all_costs() {
+            instruction::process_all_costs();
+            m_body->process_all_costs();
+        }
+    public:
+        instr_parallel(instruction_block * body) : m_body(body), m_num_regs(0) { 
+            init(); 
+        }
+        virtual ~instr_parallel() {
+            dealloc(m_body);
+        }
+        virtual bool perform(execution_context & ctx) {
+            if (task_pool::get_max_threads() <= 1) {
+                return m_body->perform(ctx);
+            }
+            ctx.reserve_registers(m_num_regs);
+            for (unsigned w = 0; w < m_waves.size(); ++w) {
+                unsigned_vector const & wave = m_waves[w];
+                bool ok;
+                if (wave.size() == 1 || !is_thread_safe(ctx, m_wave_regs[w])) {
+                    ok = perform_sequential(ctx, wave);
+                }
+                else {
+                    ctx.inc_parallel_instructions(wave.size());
+                    ok = !ctx.should_terminate() && perform_parallel(ctx, wave);
+                }
+                if (!ok) {
+                    TRACE("dl", tout << "parallel block terminated before completion\n";);
+                    return false;
+                }
+            }
+            return true;
+        }
+        virtual void make_annotations(execution_context & ctx) {
+            m_body->make_annotations(ctx);
+        }
+        virtual void display_head_impl(rel_context const & ctx, std::ostream & out) const {
+            out << "parallel " << m_waves.size() << " waves";
+        }
+        virtual void display_body_impl(rel_context const & ctx, std::ostream & out, std::string indentation) const {
+            m_body->display_indented(ctx, out, indentation+"    ");
+        }
+    };
+
+    instruction * instruction::mk_parallel(instruction_block * body) {
+        return alloc(instr_parallel, body);
+    }
+
+
     class instr_join : public instruction {
         typedef unsigned_vector column_vector;
         reg_idx m_rel1;
@@ -372,6 +611,12 @@ namespace datalog {
             }
             return true;
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_rel1);
+            regs.push_back(m_rel2);
+            regs.push_back(m_res);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::string a1 = "rel1", a2 = "rel2";
             ctx.get_register_annotation(m_rel1, a1);
@@ -422,6 +667,10 @@ namespace datalog {
             }
             return true;
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_reg);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::stringstream a;
             a << "filter_equal " << m_col << " val: " << ctx.get_rel_context().get_rmanager().to_nice_string(m_value);
@@ -473,6 +722,10 @@ namespace datalog {
             out << "filter_identical " << m_reg << " ";
             print_container(m_cols, out);
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_reg);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             ctx.set_register_annotation(m_reg, "filter_identical");
         }
@@ -675,6 +928,12 @@ namespace datalog {
 
             return true;
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_src);
+            regs.push_back(m_tgt);
+            regs.push_back(m_delta);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::string str = "union";
             if (!ctx.get_register_annotation(m_tgt, str)) {
@@ -744,6 +1003,11 @@ namespace datalog {
             out << (m_projection ? " deleting columns " : " with cycle ");
             print_container(m_cols, out);
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_src);
+            regs.push_back(m_tgt);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::stringstream s;
             std::string a = "rel_src";
@@ -809,6 +1073,12 @@ namespace datalog {
             out << " into " << m_res << " removing columns ";
             print_container(m_removed_cols, out);
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_rel1);
+            regs.push_back(m_rel2);
+            regs.push_back(m_res);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::string s1 = "rel1", s2 = "rel2";
             ctx.get_register_annotation(m_rel1, s1);
@@ -825,6 +1095,180 @@ namespace datalog {
     }
 
 
+    class instr_nary_join : public instruction {
+        svector<reg_idx> m_rels;
+        unsigned_vector m_col_vars;
+        unsigned_vector m_result_vars;
+        reg_idx m_res;
+        scoped_ptr<table_nary_join_fn> m_table_fn;
+        ptr_vector<table_plugin> m_table_fn_plugins;
+
+        bool occurs_from(unsigned var, unsigned ofs) const {
+            for (unsigned i=ofs; i<m_col_vars.size(); i++) {
+                if (m_col_vars[i]==var) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void get_result_signature(const ptr_vector<relation_base> & rels, relation_signature & sig) const {
+            for (unsigned k=0; k<m_result_vars.size(); k++) {
+                unsigned ofs = 0;
+                bool found = false;
+                for (unsigned i=0; !found && i<rels.size(); i++) {
+                    const relation_signature & rsig = rels[i]->get_signature();
+                    for (unsigned j=0; !found && j<rsig.size(); j++) {
+                        if (m_col_vars[ofs+j]==m_result_vars[k]) {
+                            sig.push_back(rsig[j]);
+                            found = true;
+                        }
+                    }
+                    ofs += rsig.size();
+                }
+                SASSERT(found);
+            }
+        }
+
+        table_nary_join_fn * get_table_fn(relation_manager & rmgr, const ptr_vector<const table_base> & tables) {
+            bool cached = m_table_fn && m_table_fn_plugins.size()==tables.size();
+            for (unsigned i=0; cached && i<tables.size(); i++) {
+                cached = &tables[i]->get_plugin()==m_table_fn_plugins[i];
+            }
+            if (!cached) {
+                m_table_fn = rmgr.mk_nary_join_fn(tables.size(), tables.c_ptr(), m_col_vars, m_result_vars);
+                m_table_fn_plugins.reset();
+                for (unsigned i=0; i<tables.size(); i++) {
+                    m_table_fn_plugins.push_back(&tables[i]->get_plugin());
+                }
+            }
+            return m_table_fn.get();
+        }
+
+        /**
+           Join the relations one by one from the left, keeping in each intermediate result only 
+           one column for every variable that is in the result or occurs in the relations still 
+           to be joined.
+        */
+        relation_base * join_pairwise(relation_manager & rmgr, const ptr_vector<relation_base> & rels) {
+            SASSERT(rels.size()>=2);
+            unsigned ofs = rels[0]->get_signature().size();
+            unsigned_vector cur_vars(ofs, m_col_vars.c_ptr());
+            scoped_rel<relation_base> cur;
+            for (unsigned i=1; i<rels.size(); i++) {
+                const relation_base & r1 = cur ? *cur : *rels[0];
+                const relation_base & r2 = *rels[i];
+                unsigned sz = r2.get_signature().size();
+                unsigned_vector cols1, cols2, removed_cols, joined_vars(cur_vars), new_vars;
+                for (unsigned j=0; j<sz; j++) {
+                    unsigned var = m_col_vars[ofs+j];
+                    for (unsigned k=0; k<cur_vars.size(); k++) {
+                        if (cur_vars[k]==var) {
+                            cols1.push_back(k);
+                            cols2.push_back(j);
+                        }
+                    }
+                    joined_vars.push_back(var);
+                }
+                ofs += sz;
+                for (unsigned k=0; k<joined_vars.size(); k++) {
+                    unsigned var = joined_vars[k];
+                    bool duplicate = k>=cur_vars.size() && cur_vars.contains(var);
+                    if (duplicate || (!m_result_vars.contains(var) && !occurs_from(var, ofs))) {
+                        removed_cols.push_back(k);
+                    }
+                    else {
+                        new_vars.push_back(var);
+                    }
+                }
+                scoped_ptr<relation_join_fn> fn;
+                if (removed_cols.empty()) {
+                    fn = rmgr.mk_join_fn(r1, r2, cols1, cols2);
+                }
+                else {
+                    fn = rmgr.mk_join_project_fn(r1, r2, cols1, cols2, removed_cols);
+                }
+                if (!fn) {
+                    throw default_exception("trying to perform unsupported join operation on relations of kinds %s and %s",
+                        r1.get_plugin().get_name().bare_str(), r2.get_plugin().get_name().bare_str());
+                }
+                cur = (*fn)(r1, r2);
+                cur_vars.swap(new_vars);
+            }
+            SASSERT(cur_vars.size()==m_result_vars.size());
+            return cur.release();
+        }
+
+    public:
+        instr_nary_join(unsigned rel_cnt, const reg_idx * rels, const unsigned_vector & col_vars, 
+            const unsigned_vector & result_vars, reg_idx result)
+            : m_rels(rel_cnt, rels), m_col_vars(col_vars), m_result_vars(result_vars), m_res(result) {
+        }
+        virtual bool perform(execution_context & ctx) {
+            ctx.make_empty(m_res);
+            ptr_vector<relation_base> rels;
+            bool all_tables = true;
+            for (unsigned i=0; i<m_rels.size(); i++) {
+                relation_base * r = ctx.reg(m_rels[i]);
+                if (!r) {
+                    return true;
+                }
+                rels.push_back(r);
+                all_tables &= r->from_table();
+            }
+            relation_manager & rmgr = rels[0]->get_manager();
+            relation_base * res = 0;
+            if (all_tables) {
+                ptr_vector<const table_base> tables;
+                for (unsigned i=0; i<rels.size(); i++) {
+                    tables.push_back(&static_cast<table_relation *>(rels[i])->get_table());
+                }
+                table_nary_join_fn * fn = get_table_fn(rmgr, tables);
+                if (fn) {
+                    relation_signature sig;
+                    get_result_signature(rels, sig);
+                    res = rmgr.mk_table_relation(sig, (*fn)(tables.size(), tables.c_ptr()));
+                }
+            }
+            if (!res) {
+                res = join_pairwise(rmgr, rels);
+            }
+            ctx.set_reg(m_res, res);
+            if (ctx.eager_emptiness_checking() && res->empty()) {
+                ctx.make_empty(m_res);
+            }
+            return true;
+        }
+        virtual void display_head_impl(rel_context const& ctx, std::ostream & out) const {
+            out << "nary_join ";
+            print_container(m_rels, out);
+            out << " on variables ";
+            print_container(m_col_vars, out);
+            out << " into " << m_res << " keeping ";
+            print_container(m_result_vars, out);
+        }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.append(m_rels);
+            regs.push_back(m_res);
+            return true;
+        }
+        virtual void make_annotations(execution_context & ctx) {
+            std::string a = "nary join";
+            for (unsigned i=0; i<m_rels.size(); i++) {
+                std::string s = "rel";
+                ctx.get_register_annotation(m_rels[i], s);
+                a += " " + s;
+            }
+            ctx.set_register_annotation(m_res, a);
+        }
+    };
+
+    instruction * instruction::mk_nary_join(unsigned rel_cnt, const reg_idx * rels, 
+        const unsigned_vector & col_vars, const unsigned_vector & result_vars, reg_idx result) {
+            return alloc(instr_nary_join, rel_cnt, rels, col_vars, result_vars, result);
+    }
+
+
     class instr_select_equal_and_project : public instruction {
         reg_idx m_src;
         reg_idx m_result;
@@ -866,6 +1310,11 @@ namespace datalog {
             out << "select_equal_and_project " << m_src <<" into " << m_result << " col: " << m_col 
                 << " val: " << ctx.get_rmanager().to_nice_string(m_value);
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_src);
+            regs.push_back(m_result);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::stringstream s;
             std::string s1 = "src";
@@ -923,6 +1372,11 @@ namespace datalog {
             print_container(m_cols2, out);
             out << " as the negated table";
         }
+        virtual bool get_registers(svector<reg_idx> & regs) const {
+            regs.push_back(m_tgt);
+            regs.push_back(m_neg_rel);
+            return true;
+        }
         virtual void make_annotations(execution_context & ctx) {
             std::string s = "negated relation";
             ctx.get_register_annotation(m_neg_rel, s);
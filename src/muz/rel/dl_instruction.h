@@ -51,6 +51,7 @@ namespace datalog {
         typedef relation_base * reg_type;
         typedef vector<reg_type> reg_vector;
         typedef unsigned reg_idx;
+        typedef obj_map<func_decl, reg_idx> pred2reg;
 
         /**
            \brief A register number that should never be referenced to. Can stand e.g. for a tail 
@@ -62,10 +63,14 @@ namespace datalog {
 
         context &           m_context;
         reg_vector          m_registers;
+        pred2reg            m_pred_regs; //registers holding the relations of the predicates
 
         reg_annotations     m_reg_annotation;
         stopwatch *         m_stopwatch;
         unsigned            m_timelimit_ms; //zero means no limit
+        unsigned            m_replan_factor; //zero means no re-planning
+        bool                m_replan_requested;
+        unsigned            m_num_parallel_instrs; //instructions performed in parallel waves, kept by reset()
         /**
            \brief If true, after every operation that may result in an empty relation, a check
            for emptiness will be performed, and if a relation is empty, it will be deleted
@@ -86,6 +91,28 @@ namespace datalog {
         void reset_timelimit();
         bool should_terminate();
 
+        /**
+           \brief Registers that hold the relations of the predicates while the code is performed.
+           The relations stored in the relation manager are only updated when the evaluation ends.
+        */
+        pred2reg & get_pred_regs() { return m_pred_regs; }
+
+        /**
+           \brief Request a new join plan if the register of some predicate outgrew the size 
+           estimated by the join planner \c factor times (see \c relation_manager::exceeds_size_estimate).
+        */
+        void set_replan_factor(unsigned factor) { m_replan_factor = factor; }
+        /**
+           \brief Return true if the evaluation should be restarted with a new join plan. It is 
+           checked between iterations of fixpoint loops.
+        */
+        bool should_replan();
+        bool replan_requested() const { return m_replan_requested; }
+
+        void inc_parallel_instructions(unsigned n) { m_num_parallel_instrs += n; }
+        unsigned get_num_parallel_instructions() const { return m_num_parallel_instrs; }
+        void reset_parallel_instructions() { m_num_parallel_instrs = 0; }
+
         bool eager_emptiness_checking() const { return m_eager_emptiness_checking; }
 
         /**
@@ -134,6 +161,16 @@ namespace datalog {
             return m_registers.size();
         }
 
+        /**
+           \brief Make sure that registers 0, ..., num-1 exist, so that instructions executed
+           on parallel threads do not resize the register vector.
+        */
+        void reserve_registers(unsigned num) {
+            if (num > m_registers.size()) {
+                m_registers.resize(num, 0);
+            }
+        }
+
         bool get_register_annotation(reg_idx reg, std::string & res) const {
             return m_reg_annotation.find(reg, res);
         }
@@ -232,6 +269,13 @@ namespace datalog {
 
         virtual void make_annotations(execution_context & ctx)  = 0;
 
+        /**
+           \brief Append to \c regs the registers read or written by the instruction, and return 
+           true if the instruction accesses no other data that may be shared with other instructions. 
+           An instruction that returns false is never executed in parallel with other instructions.
+        */
+        virtual bool get_registers(svector<reg_idx> & regs) const { return false; }
+
         void display(rel_context_base const& ctx, std::ostream & out) const {
             display_indented(ctx, out, "");
         }
@@ -256,6 +300,15 @@ namespace datalog {
         static instruction * mk_while_loop(unsigned control_reg_cnt, const reg_idx * control_regs, 
             instruction_block * body);
 
+        /**
+           \brief Return instruction that performs \c body, executing instructions that access
+           disjoint registers on parallel threads. The effect is the same as the one of executing 
+           \c body sequentially.
+
+           The instruction object takes over the ownership of the \c body object.
+        */
+        static instruction * mk_parallel(instruction_block * body);
+
         static instruction * mk_join(reg_idx rel1, reg_idx rel2, unsigned col_cnt,
             const unsigned * cols1, const unsigned * cols2, reg_idx result);
         static instruction * mk_filter_equal(ast_manager & m, reg_idx reg, const relation_element & value, unsigned col);
@@ -270,6 +323,16 @@ namespace datalog {
         static instruction * mk_join_project(reg_idx rel1, reg_idx rel2, unsigned joined_col_cnt,
             const unsigned * cols1, const unsigned * cols2, unsigned removed_col_cnt, 
             const unsigned * removed_cols, reg_idx result);
+        /**
+           \brief Join the \c rel_cnt relations in \c rels in a single operation.
+
+           \c col_vars assigns a join variable to each column of the relations, taken one after 
+           another. A variable may occur at most once in each relation. The columns of \c result 
+           are the variables in \c result_vars, which must list them in the order of their first 
+           occurrence in \c col_vars.
+        */
+        static instruction * mk_nary_join(unsigned rel_cnt, const reg_idx * rels, 
+            const unsigned_vector & col_vars, const unsigned_vector & result_vars, reg_idx result);
         static instruction * mk_rename(reg_idx src, unsigned cycle_len, const unsigned * permutation_cycle, 
             reg_idx tgt);
         static instruction * mk_filter_by_negation(reg_idx tgt, reg_idx neg_rel, unsigned col_cnt,
@@ -323,6 +386,9 @@ namespace datalog {
             m_observer = o;
         }
 
+        unsigned size() const { return m_data.size(); }
+        instruction * operator[](unsigned i) const { return m_data[i]; }
+
         /**
            \brief Perform instructions in the block. If the run was interrupted before completion,
            return false; otherwise return true.
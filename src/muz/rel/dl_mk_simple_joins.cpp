@@ -22,6 +22,7 @@ Revision History:
 #include<limits>
 #include"dl_mk_simple_joins.h"
 #include"dl_relation_manager.h"
+#include"dl_table_relation.h"
 #include"ast_pp.h"
 #include"trace.h"
 
@@ -34,8 +35,14 @@ namespace datalog {
         rm(ctx.get_rule_manager()) {
     }
 
+    /**
+       \brief Maximal number of rows of a table that are scanned to estimate the number
+       of distinct values in its columns.
+    */
+    #define COLUMN_SAMPLE_SIZE 4096
+
     class join_planner {
-        typedef float cost;
+        typedef double cost;
 
         class pair_info {
             cost m_total_cost;
@@ -60,11 +67,16 @@ namespace datalog {
                 return m_consumers > 0;
             }
 
+            /**
+               \brief Estimated number of rows of the join of the pair.
+            */
+            cost get_size_estimate() const { return m_total_cost; }
+
             cost get_cost() const { 
                 SASSERT(m_consumers > 0);
                 cost amortized = m_total_cost/m_consumers;
                 if (m_stratified) {
-                    return amortized * ( (amortized>0) ? (1/16.0f) : 16.0f);
+                    return amortized * ( (amortized>0) ? (1/16.0) : 16.0);
                 }
                 else {
                     return amortized;
@@ -118,6 +130,16 @@ namespace datalog {
             pair_hash<obj_ptr_hash<app>, obj_ptr_hash<app> >, default_eq<app_pair> > cost_map;
         typedef map<rule *, ptr_vector<app>, ptr_hash<rule>, ptr_eq<rule> > rule_pred_map;
 
+        /**
+           \brief Number of rows of a populated relation, and estimated number of distinct 
+           values in each of its columns.
+        */
+        struct relation_stats {
+            cost          m_rows;
+            svector<cost> m_column_sizes;
+        };
+        typedef obj_map<func_decl, relation_stats *> relation_stats_map;
+
         context & m_context;
         ast_manager & m;
         rule_manager & rm;
@@ -133,6 +155,8 @@ namespace datalog {
         ast_ref_vector m_pinned;
         mutable ptr_vector<sort> m_vars;
 
+        relation_stats_map m_relation_stats; // zero for predicates without a populated relation
+
     public:
         join_planner(context & ctx, rule_set & rs_aux_copy)
             : m_context(ctx), m(ctx.get_manager()), 
@@ -152,6 +176,12 @@ namespace datalog {
                 dealloc(it->m_value);
             }
             m_costs.reset();
+            relation_stats_map::iterator sit  = m_relation_stats.begin();
+            relation_stats_map::iterator send = m_relation_stats.end();
+            for (; sit != send; ++sit) {
+                dealloc(sit->m_value);
+            }
+            m_relation_stats.reset();
         }
     private:
 
@@ -326,6 +356,10 @@ namespace datalog {
             for(unsigned i=0; i<pos_tail_size; i++) {
                 rule_content.push_back(r->get_tail(i));
             }
+            if (pos_tail_size>2 && m_context.leapfrog_join()) {
+                //the rule is left to the n-ary join of the compiler
+                return;
+            }
             for(unsigned i=0; i<pos_tail_size; i++) {
                 app * t1 = r->get_tail(i);
                 var_idx_set t1_vars = rm.collect_vars(t1);
@@ -401,6 +435,14 @@ namespace datalog {
                 symbol(parent_name.c_str()), symbol("split"), 
                 arity, domain.c_ptr(), parent_head);
 
+            IF_VERBOSE(10, verbose_stream() << "(join-plan " << decl->get_name() << " :estimated-rows " 
+                       << inf.get_size_estimate() << " " << mk_pp(t1, m) << " " << mk_pp(t2, m) << ")\n";);
+            // estimates that use the domain sizes of unpopulated relations are upper bounds,
+            // so only the ones computed from the contents of both relations can be exceeded.
+            if (m_context.get_rel_context() && get_relation_stats(t1->get_decl()) && get_relation_stats(t2->get_decl())) {
+                m_context.get_rel_context()->get_rmanager().set_size_estimate(decl, inf.get_size_estimate());
+            }
+
             app_ref head(m.mk_app(decl, arity, args.c_ptr()), m);
 
             app * tail[] = {t1, t2};
@@ -569,28 +611,89 @@ namespace datalog {
             return m_rs_aux_copy.get_predicate_strat(pred);
         }
 
-        cost estimate_size(app * t) const {
+        /**
+           \brief Return the statistics of the relation of \c pred, or zero if the relation is
+           empty or does not exist yet, in which case the sizes of the domains are used instead.
+
+           The relations of predicates that are not computed by the rules contain their final
+           contents. For the other predicates the size is a lower bound that was computed 
+           by an earlier query or by an interrupted saturation.
+        */
+        relation_stats * get_relation_stats(func_decl * pred) {
+            relation_stats * st = 0;
+            if (m_relation_stats.find(pred, st)) {
+                return st;
+            }
+            rel_context_base * rel = m_context.get_rel_context();
+            relation_base * r = rel ? rel->get_rmanager().try_get_relation(pred) : 0;
+            unsigned rows = r ? r->get_size_estimate_rows() : 0;
+            if (rows != 0) {
+                st = alloc(relation_stats);
+                st->m_rows = static_cast<cost>(rows);
+                unsigned n = pred->get_arity();
+                for (unsigned i = 0; i < n; i++) {
+                    st->m_column_sizes.push_back(std::min(st->m_rows, get_domain_size(pred, i)));
+                }
+                if (r->from_table()) {
+                    estimate_column_sizes(static_cast<table_relation *>(r)->get_table(), *st);
+                }
+                rel->get_rmanager().set_size_estimate(pred, st->m_rows);
+            }
+            m_relation_stats.insert(pred, st);
+            return st;
+        }
+
+        /**
+           \brief Estimate the number of distinct values in the columns of \c t from a sample 
+           of its rows. A column with many repeated values in the sample is assumed to have 
+           no other values.
+        */
+        void estimate_column_sizes(table_base const & t, relation_stats & st) {
+            typedef hashtable<table_element, table_element_hash, default_eq<table_element> > value_set;
+            unsigned n = st.m_column_sizes.size();
+            SASSERT(t.get_signature().size() == n);
+            vector<value_set> values;
+            values.resize(n);
+            unsigned sampled = 0;
+            table_base::iterator it = t.begin(), end = t.end();
+            for (; it != end && sampled < COLUMN_SAMPLE_SIZE; ++it, ++sampled) {
+                for (unsigned i = 0; i < n; i++) {
+                    values[i].insert((*it)[i]);
+                }
+            }
+            if (sampled == 0) {
+                return;
+            }
+            for (unsigned i = 0; i < n; i++) {
+                cost distinct = static_cast<cost>(values[i].size());
+                if (2*values[i].size() > sampled) {
+                    distinct = distinct * st.m_rows / sampled;
+                }
+                st.m_column_sizes[i] = std::min(st.m_column_sizes[i], distinct);
+            }
+        }
+
+        /**
+           \brief Estimated number of distinct values in the \c arg_index-th column of \c pred.
+        */
+        cost get_column_size(func_decl * pred, unsigned arg_index) {
+            relation_stats * st = get_relation_stats(pred);
+            return st ? st->m_column_sizes[arg_index] : get_domain_size(pred, arg_index);
+        }
+
+        cost estimate_size(app * t) {
             func_decl * pred = t->get_decl();
             unsigned n=pred->get_arity();
-            rel_context_base* rel = m_context.get_rel_context();
-            if (!rel) {
-                return cost(1);
-            }
-            relation_manager& rm = rel->get_rmanager();
-            if ( (m_context.saturation_was_run() && rm.try_get_relation(pred))
-                || rm.is_saturated(pred)) {
-                SASSERT(rm.try_get_relation(pred)); //if it is saturated, it should exist
-                unsigned rel_size_int = rel->get_relation(pred).get_size_estimate_rows();
-                if (rel_size_int!=0) {
-                    cost rel_size = static_cast<cost>(rel_size_int);
-                    cost curr_size = rel_size;
-                    for(unsigned i=0; i<n; i++) {
-                        if (!is_var(t->get_arg(i))) {
-                            curr_size /= get_domain_size(pred, i);
-                        }
+            relation_stats * st = get_relation_stats(pred);
+            if (st) {
+                // each column bound to a constant keeps one of its values.
+                cost curr_size = st->m_rows;
+                for(unsigned i=0; i<n; i++) {
+                    if (!is_var(t->get_arg(i))) {
+                        curr_size /= st->m_column_sizes[i];
                     }
-                    return curr_size;
                 }
+                return curr_size;
             }
             cost res = 1;
             for(unsigned i=0; i<n; i++) {
@@ -601,67 +704,68 @@ namespace datalog {
             return res;
         }
 
-        cost compute_cost(app * t1, app * t2, const var_idx_set & non_local_vars) const {
+        /**
+           \brief Store in \c var_sizes the estimated number of distinct values of the variables of \c t.
+        */
+        void collect_var_sizes(app * t, u_map<cost> & var_sizes) {
+            for (unsigned i = 0; i < t->get_num_args(); ++i) {
+                if (!is_var(t->get_arg(i))) {
+                    continue;
+                }
+                unsigned var_idx = to_var(t->get_arg(i))->get_idx();
+                cost sz = get_column_size(t->get_decl(), i);
+                u_map<cost>::entry * e = var_sizes.insert_if_not_there2(var_idx, sz);
+                e->get_data().m_value = std::min(e->get_data().m_value, sz);
+            }
+        }
+
+        /**
+           \brief Estimate the number of rows of the join of \c t1 and \c t2 projected on \c non_local_vars.
+
+           Every joined column keeps the rows of the other relation whose value is among the 
+           distinct values of the column, and the projection has at most as many rows as there 
+           are combinations of the values of the remaining variables. Joins that amount to a 
+           cross product are therefore only cheap when they are projected to few rows.
+        */
+        cost compute_cost(app * t1, app * t2, const var_idx_set & non_local_vars) {
             func_decl * t1_pred = t1->get_decl();
             func_decl * t2_pred = t2->get_decl();
-            cost inters_size = 1;
+            cost join_size = estimate_size(t1)*estimate_size(t2);
             variable_intersection vi(m_context.get_manager());
             vi.populate(t1, t2);
             unsigned n = vi.size();
-            // remove contributions from joined columns.
             for(unsigned i=0; i<n; i++) {
                 unsigned arg_index1, arg_index2;
                 vi.get(i, arg_index1, arg_index2);
                 SASSERT(is_var(t1->get_arg(arg_index1)));
-                if (non_local_vars.contains(to_var(t1->get_arg(arg_index1))->get_idx())) {
-                    inters_size *= get_domain_size(t1_pred, arg_index1);
-                }
                 //joined arguments must have the same domain
                 SASSERT(get_domain_size(t1_pred, arg_index1)==get_domain_size(t2_pred, arg_index2));
-            }
-            // remove contributions from projected columns.
-            for (unsigned i = 0; i < t1->get_num_args(); ++i) {
-                if (is_var(t1->get_arg(i)) && 
-                    !non_local_vars.contains(to_var(t1->get_arg(i))->get_idx())) {
-                    inters_size *= get_domain_size(t1_pred, i);
+                cost sz = std::max(get_column_size(t1_pred, arg_index1), get_column_size(t2_pred, arg_index2));
+                if (sz > 0) {
+                    join_size /= sz;
                 }
             }
-            for (unsigned i = 0; i < t2->get_num_args(); ++i) {
-                if (is_var(t2->get_arg(i)) && 
-                    !non_local_vars.contains(to_var(t2->get_arg(i))->get_idx())) {
-                    inters_size *= get_domain_size(t2_pred, i);
+
+            u_map<cost> var_sizes;
+            collect_var_sizes(t1, var_sizes);
+            collect_var_sizes(t2, var_sizes);
+            cost proj_size = 1;
+            u_map<cost>::iterator it = var_sizes.begin(), end = var_sizes.end();
+            for (; it != end; ++it) {
+                if (non_local_vars.contains(it->m_key)) {
+                    proj_size *= it->m_value;
                 }
             }
 
-            cost res = estimate_size(t1)*estimate_size(t2)/ inters_size; // (inters_size*inters_size);
-            //cost res = -inters_size;
-
-            /*unsigned t1_strat = get_stratum(t1_pred);
-            SASSERT(t1_strat<=m_head_stratum);
-            if (t1_strat<m_head_stratum) {
-                unsigned t2_strat = get_stratum(t2_pred);
-                SASSERT(t2_strat<=m_head_stratum);
-                if (t2_strat<m_head_stratum) {
-                    //the rule of this predicates would depend on predicates 
-                    //in lower stratum than the head, which is a good thing, since
-                    //then the rule code will not need to appear in a loop
-                    if (res>0) {
-                        res /= 2;
-                    }
-                    else {
-                        res *= 2;
-                    }
-                }
-            }*/
+            cost res = std::min(join_size, proj_size);
 
             TRACE("report_costs",                  
                   display_predicate(m_context, t1, tout);
                   display_predicate(m_context, t2, tout);
-                  tout << res << "\n";);
+                  tout << "join: " << join_size << " projection: " << proj_size << " cost: " << res << "\n";);
             return res;
         }
 
-
         bool pick_best_pair(app_pair & p) {
             app_pair best;
             bool found = false;
@@ -712,7 +816,7 @@ namespace datalog {
             for(; rcit!=rcend; ++rcit) {
                 rule * orig_r = rcit->m_key;
                 ptr_vector<app> content = rcit->m_value;
-                SASSERT(content.size()<=2);
+                SASSERT(content.size()<=2 || content.size()==orig_r->get_positive_tail_size());
                 if (content.size()==orig_r->get_positive_tail_size()) {
                     //rule did not change
                     result->add_rule(orig_r);
@@ -751,6 +855,9 @@ namespace datalog {
             rs_aux_copy.close();
         }
 
+        if (m_context.get_rel_context()) {
+            m_context.get_rel_context()->get_rmanager().reset_size_estimates();
+        }
         join_planner planner(m_context, rs_aux_copy);
 
         return planner.run(source);
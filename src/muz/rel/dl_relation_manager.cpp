@@ -49,6 +49,7 @@ namespace datalog {
 
     void relation_manager::reset() {
         reset_relations();
+        reset_size_estimates();
 
         m_favourite_table_plugin   = static_cast<table_plugin *>(0);
         m_favourite_relation_plugin = static_cast<relation_plugin *>(0);
@@ -118,6 +119,63 @@ namespace datalog {
         e->get_data().m_value = rel;
     }
 
+    void relation_manager::set_size_estimate(func_decl * pred, double rows) {
+        size_estimate_map::obj_map_entry * e = m_size_estimates.find_core(pred);
+        if (e) {
+            e->get_data().m_value = size_estimate(rows);
+            return;
+        }
+        get_context().get_manager().inc_ref(pred); //dec_ref in reset_size_estimates
+        m_size_estimates.insert(pred, size_estimate(rows));
+    }
+
+    void relation_manager::reset_size_estimates() {
+        size_estimate_map::iterator it = m_size_estimates.begin();
+        size_estimate_map::iterator end = m_size_estimates.end();
+        for(; it!=end; ++it) {
+            get_context().get_manager().dec_ref(it->m_key);
+        }
+        m_size_estimates.reset();
+    }
+
+    void relation_manager::update_actual_sizes() {
+        size_estimate_map::iterator it = m_size_estimates.begin();
+        size_estimate_map::iterator end = m_size_estimates.end();
+        for(; it!=end; ++it) {
+            relation_base * rel = try_get_relation(it->m_key);
+            if (rel) {
+                it->m_value.m_actual = static_cast<double>(rel->get_size_estimate_rows());
+            }
+        }
+    }
+
+    bool relation_manager::exceeds_size_estimate(func_decl * pred, unsigned rows, unsigned factor) const {
+        size_estimate est;
+        if (!m_size_estimates.find(pred, est) || rows <= factor*est.m_estimated) {
+            return false;
+        }
+        TRACE("dl", tout << pred->get_name() << " has " << rows << " rows, estimated " << est.m_estimated << "\n";);
+        return true;
+    }
+
+    void relation_manager::collect_statistics(statistics & st) const {
+        unsigned num_larger = 0;
+        double estimated = 0, actual = 0;
+        size_estimate_map::iterator it = m_size_estimates.begin();
+        size_estimate_map::iterator end = m_size_estimates.end();
+        for(; it!=end; ++it) {
+            estimated += it->m_value.m_estimated;
+            actual    += it->m_value.m_actual;
+            if (it->m_value.m_actual > it->m_value.m_estimated) {
+                num_larger++;
+            }
+        }
+        st.update("datalog estimated relations", m_size_estimates.size());
+        st.update("datalog underestimated relations", num_larger);
+        st.update("datalog estimated rows", estimated);
+        st.update("datalog actual rows", actual);
+    }
+
     void relation_manager::collect_non_empty_predicates(decl_set & res) const {
         relation_map::iterator it = m_relations.begin();
         relation_map::iterator end = m_relations.end();
@@ -530,6 +588,15 @@ namespace datalog {
         }
     }
 
+    void relation_manager::display_size_estimates(std::ostream & out) const {
+        size_estimate_map::iterator it = m_size_estimates.begin();
+        size_estimate_map::iterator end = m_size_estimates.end();
+        for(; it!=end; ++it) {
+            out << "Relation " << it->m_key->get_name() << " has estimated size " 
+                << it->m_value.m_estimated << " and actual size " << it->m_value.m_actual << "\n";
+        }
+    }
+
     void relation_manager::display_output_tables(rule_set const& rules, std::ostream & out) const {
         const decl_set & output_preds = rules.get_output_predicates();
         decl_set::iterator it=output_preds.begin();
@@ -1718,5 +1785,11 @@ namespace datalog {
         return res;
     }
 
+    table_nary_join_fn * relation_manager::mk_nary_join_fn(unsigned n, const table_base * const * tables, 
+            const unsigned_vector & col_vars, const unsigned_vector & result_vars) {
+        SASSERT(n>0);
+        return tables[0]->get_plugin().mk_nary_join_fn(n, tables, col_vars, result_vars);
+    }
+
 };
 
@@ -22,6 +22,7 @@ Revision History:
 
 #include"map.h"
 #include"vector.h"
+#include"statistics.h"
 #include"dl_base.h"
 
 namespace datalog {
@@ -73,6 +74,13 @@ namespace datalog {
             ptr_eq<const relation_plugin> > rp2fprp_map;
 
         typedef map<func_decl *, relation_base *, ptr_hash<func_decl>, ptr_eq<func_decl> > relation_map;
+
+        struct size_estimate {
+            double m_estimated;
+            double m_actual;
+            size_estimate(double est = 0) : m_estimated(est), m_actual(0) {}
+        };
+        typedef obj_map<func_decl, size_estimate> size_estimate_map;
         typedef ptr_vector<table_plugin> table_plugin_vector;
         typedef ptr_vector<relation_plugin> relation_plugin_vector;
 
@@ -93,6 +101,12 @@ namespace datalog {
 
         decl_set m_saturated_rels;
 
+        /**
+           Number of rows of relations as estimated by the join planner (see \c mk_simple_joins), 
+           and their actual number of rows at the time of the last call to \c update_actual_sizes.
+        */
+        size_estimate_map m_size_estimates;
+
         family_id m_next_table_fid;
         family_id m_next_relation_fid;
 
@@ -154,6 +168,23 @@ namespace datalog {
             }
         }
 
+        void set_size_estimate(func_decl * pred, double rows);
+        void reset_size_estimates();
+        /**
+           \brief Record the current sizes of the relations with an estimated size.
+        */
+        void update_actual_sizes();
+        /**
+           \brief Return true if the join planner estimated the size of \c pred, and \c rows is
+           more than \c factor times the estimate.
+        */
+        bool exceeds_size_estimate(func_decl * pred, unsigned rows, unsigned factor) const;
+        /**
+           \brief Update \c st with the number of relations with an estimated size, their estimated 
+           and actual number of rows, and the number of relations that are larger than estimated.
+        */
+        void collect_statistics(statistics & st) const;
+
         void collect_non_empty_predicates(decl_set & res) const;
         void restrict_predicates(const decl_set & preds);
 
@@ -592,6 +623,13 @@ namespace datalog {
         virtual table_transformer_fn * mk_project_with_reduce_fn(const table_base & t, unsigned col_cnt, 
             const unsigned * removed_cols, table_row_pair_reduce_fn * reducer);
 
+        /**
+            \brief Return a functor joining \c n tables in one pass, or zero if the plugin of 
+            the first table does not provide one. See \c table_plugin::mk_nary_join_fn.
+        */
+        table_nary_join_fn * mk_nary_join_fn(unsigned n, const table_base * const * tables, 
+            const unsigned_vector & col_vars, const unsigned_vector & result_vars);
+
 
 
 
@@ -614,6 +652,7 @@ namespace datalog {
 
         void display(std::ostream & out) const;
         void display_relation_sizes(std::ostream & out) const;
+        void display_size_estimates(std::ostream & out) const;
         void display_output_tables(rule_set const& rules, std::ostream & out) const;
 
     private:
@@ -17,6 +17,7 @@ Revision History:
 
 --*/
 
+#include<algorithm>
 #include<utility>
 #include"dl_context.h"
 #include"dl_util.h"
@@ -427,6 +428,64 @@ namespace datalog {
         }
     };
 
+    /**
+       Offsets of the table rows sorted lexicographically by the key columns. The rows that agree 
+       on a prefix of the key form a contiguous range, so the index can be traversed as a trie 
+       whose i-th level are the values of the i-th key column.
+    */
+    class sparse_table::trie_index {
+        typedef svector<store_offset> offset_vector;
+
+        class row_lt {
+            const sparse_table & m_table;
+            const key_spec & m_key_cols;
+        public:
+            row_lt(const sparse_table & t, const key_spec & key_cols) 
+                : m_table(t), m_key_cols(key_cols) {}
+            bool operator()(store_offset a, store_offset b) const {
+                unsigned key_len = m_key_cols.size();
+                for (unsigned i=0; i<key_len; i++) {
+                    table_element va = m_table.get_cell(a, m_key_cols[i]);
+                    table_element vb = m_table.get_cell(b, m_key_cols[i]);
+                    if (va!=vb) {
+                        return va<vb;
+                    }
+                }
+                return false;
+            }
+        };
+
+        key_spec m_key_cols;
+        offset_vector m_rows;
+        store_offset m_first_nonindexed;
+    public:
+        trie_index(unsigned key_len, const unsigned * key_cols) 
+            : m_key_cols(key_len, key_cols), 
+            m_first_nonindexed(0) {}
+
+        void update(const sparse_table & t) {
+            store_offset after_last = t.m_data.after_last_offset();
+            if (m_first_nonindexed == after_last) {
+                return;
+            }
+            SASSERT(m_first_nonindexed<after_last);
+            //the new facts are sorted separately and merged into the sorted ones
+            unsigned old_size = m_rows.size();
+            for (store_offset ofs = m_first_nonindexed; ofs!=after_last; ofs+=t.m_fact_size) {
+                m_rows.push_back(ofs);
+            }
+            row_lt lt(t, m_key_cols);
+            std::sort(m_rows.begin()+old_size, m_rows.end(), lt);
+            std::inplace_merge(m_rows.begin(), m_rows.begin()+old_size, m_rows.end(), lt);
+            m_first_nonindexed = after_last;
+        }
+
+        unsigned size() const { return m_rows.size(); }
+        store_offset operator[](unsigned i) const { return m_rows[i]; }
+        unsigned key_len() const { return m_key_cols.size(); }
+        unsigned key_col(unsigned level) const { return m_key_cols[level]; }
+    };
+
     sparse_table::sparse_table(sparse_table_plugin & p, const table_signature & sig, unsigned init_capacity)
             : table_base(p, sig), 
             m_column_layout(sig),
@@ -488,6 +547,21 @@ namespace datalog {
         return indexer;
     }
 
+    const sparse_table::trie_index& sparse_table::get_trie_index(unsigned key_len, 
+            const unsigned * key_cols) const {
+        verbose_action  _va("get_trie_index");
+        SASSERT(get_signature().functional_columns()==0);
+        key_spec kspec;
+        kspec.append(key_len, key_cols);
+        trie_index_map::entry * e = m_trie_indexes.insert_if_not_there2(kspec, 0);
+        if (!e->get_data().m_value) {
+            e->get_data().m_value = alloc(trie_index, key_len, key_cols);
+        }
+        trie_index & index = *e->get_data().m_value;
+        index.update(*this);
+        return index;
+    }
+
     void sparse_table::reset_indexes() {
         key_index_map::iterator kmit = m_key_indexes.begin();
         key_index_map::iterator kmend = m_key_indexes.end();
@@ -495,6 +569,12 @@ namespace datalog {
             dealloc((*kmit).m_value);
         }
         m_key_indexes.reset();
+        trie_index_map::iterator tit = m_trie_indexes.begin();
+        trie_index_map::iterator tend = m_trie_indexes.end();
+        for (; tit!=tend; ++tit) {
+            dealloc((*tit).m_value);
+        }
+        m_trie_indexes.reset();
     }
 
     void sparse_table::write_into_reserve(const table_element* f) {
@@ -769,7 +849,10 @@ namespace datalog {
 
     void sparse_table_plugin::garbage_collect() {
         IF_VERBOSE(2, verbose_stream() << "garbage collecting "<< memory::get_allocation_size() << " bytes down to ";);
-        reset();
+        {
+            task_pool::scoped_lock lock(m_pool_mutex);
+            reset();
+        }
         IF_VERBOSE(2, verbose_stream() << memory::get_allocation_size() << " bytes\n";);
     }
 
@@ -778,6 +861,7 @@ namespace datalog {
         const table_signature & sig = t->get_signature();
         t->reset();
 
+        task_pool::scoped_lock lock(m_pool_mutex);
         table_pool::entry * e = m_pool.insert_if_not_there2(sig, 0);
         sp_table_vector * & vect = e->get_data().m_value;
         if (vect == 0) {
@@ -791,13 +875,16 @@ namespace datalog {
     table_base * sparse_table_plugin::mk_empty(const table_signature & s) {
         SASSERT(can_handle_signature(s));
 
-        sp_table_vector * vect;
-        if (!m_pool.find(s, vect) || vect->empty()) {
-            return alloc(sparse_table, *this, s);
+        {
+            task_pool::scoped_lock lock(m_pool_mutex);
+            sp_table_vector * vect;
+            if (m_pool.find(s, vect) && !vect->empty()) {
+                sparse_table * res = vect->back();
+                vect->pop_back();
+                return res;
+            }
         }
-        sparse_table * res = vect->back();
-        vect->pop_back();
-        return res;
+        return alloc(sparse_table, *this, s);
     }
 
     sparse_table * sparse_table_plugin::mk_clone(const sparse_table & t) {
@@ -1401,6 +1488,264 @@ namespace datalog {
     }
 
 
+    /**
+       Leapfrog triejoin [Veldhuizen, ICDT 2014]: the join variables are bound one at a time in 
+       the order of their numbers. Every table is traversed through a trie index whose levels are 
+       its columns ordered by their variables, so when a variable is bound, the tables containing 
+       it are positioned at the level of that variable, and the values common to all of them are 
+       enumerated by alternately seeking each table to the largest value seen so far.
+
+       Once no remaining variable is a result column, only the existence of a binding is checked.
+    */
+    class sparse_table_plugin::leapfrog_join_fn : public table_nary_join_fn {
+        typedef sparse_table::store_offset store_offset;
+        typedef sparse_table::trie_index trie_index;
+
+        class trie_cursor {
+            const sparse_table * m_table;
+            const trie_index * m_index;
+            unsigned_vector m_begin;
+            unsigned_vector m_end;
+            unsigned_vector m_pos;
+            unsigned m_depth;
+
+            table_element get(unsigned i, unsigned level) const {
+                return m_table->get_cell((*m_index)[i], m_index->key_col(level));
+            }
+
+            /**
+               Return the first position in [lo, hi) on the level whose value is not smaller 
+               (or, if \c strict, greater) than \c v, or \c hi if there is none. The search 
+               gallops from \c lo, since seeks tend to move the cursor only a little.
+            */
+            unsigned search(unsigned level, table_element v, bool strict, unsigned lo, unsigned hi) const {
+                if (lo==hi || !before(level, lo, v, strict)) {
+                    return lo;
+                }
+                unsigned step = 1;
+                while (lo+step<hi && before(level, lo+step, v, strict)) {
+                    lo += step;
+                    step *= 2;
+                }
+                if (lo+step<hi) {
+                    hi = lo+step;
+                }
+                while (hi-lo>1) {
+                    unsigned mid = lo+(hi-lo)/2;
+                    if (before(level, mid, v, strict)) {
+                        lo = mid;
+                    }
+                    else {
+                        hi = mid;
+                    }
+                }
+                return hi;
+            }
+
+            bool before(unsigned level, unsigned i, table_element v, bool strict) const {
+                table_element val = get(i, level);
+                return strict ? val<=v : val<v;
+            }
+        public:
+            void init(const sparse_table & t, const trie_index & index) {
+                m_table = &t;
+                m_index = &index;
+                unsigned levels = index.key_len();
+                m_begin.resize(levels);
+                m_end.resize(levels);
+                m_pos.resize(levels);
+                m_depth = 0;
+            }
+            unsigned depth() const { return m_depth; }
+            bool at_end() const { return m_pos[m_depth-1]==m_end[m_depth-1]; }
+            table_element key() const { return get(m_pos[m_depth-1], m_depth-1); }
+
+            void open() {
+                unsigned d = m_depth;
+                if (d==0) {
+                    m_begin[0] = 0;
+                    m_end[0] = m_index->size();
+                }
+                else {
+                    //the children of the current value are the rows that share it
+                    m_begin[d] = m_pos[d-1];
+                    m_end[d] = search(d-1, get(m_pos[d-1], d-1), true, m_pos[d-1], m_end[d-1]);
+                }
+                m_pos[d] = m_begin[d];
+                m_depth++;
+            }
+            void up() {
+                SASSERT(m_depth>0);
+                m_depth--;
+            }
+            void next() {
+                unsigned d = m_depth-1;
+                m_pos[d] = search(d, key(), true, m_pos[d], m_end[d]);
+            }
+            void seek(table_element v) {
+                unsigned d = m_depth-1;
+                m_pos[d] = search(d, v, false, m_pos[d], m_end[d]);
+            }
+        };
+
+        class cursor_lt {
+            const svector<trie_cursor*> & m_cursors;
+        public:
+            cursor_lt(const svector<trie_cursor*> & cursors) : m_cursors(cursors) {}
+            bool operator()(unsigned a, unsigned b) const {
+                return m_cursors[a]->key()<m_cursors[b]->key();
+            }
+        };
+
+        table_signature m_result_sig;
+        unsigned_vector m_result_vars;
+        vector<unsigned_vector> m_key_cols;      //columns of each table ordered by their variables
+        vector<unsigned_vector> m_participants;  //tables containing each variable
+        vector<unsigned_vector> m_order;
+        svector<bool> m_exists_only;             //no variable from this one on is in the result
+        svector<trie_cursor*> m_cursors;
+        svector<table_element> m_binding;
+        table_fact m_fact;
+        sparse_table * m_result;
+
+        bool join(unsigned v) {
+            if (v==m_binding.size()) {
+                unsigned res_len = m_result_vars.size();
+                for (unsigned i=0; i<res_len; i++) {
+                    m_fact[i] = m_binding[m_result_vars[i]];
+                }
+                m_result->add_fact(m_fact);
+                return true;
+            }
+            unsigned_vector & parts = m_participants[v];
+            unsigned part_cnt = parts.size();
+            bool found = false;
+            bool exhausted = false;
+            for (unsigned i=0; i<part_cnt; i++) {
+                trie_cursor & c = *m_cursors[parts[i]];
+                c.open();
+                exhausted |= c.at_end();
+            }
+            if (!exhausted) {
+                unsigned_vector & order = m_order[v];
+                order.reset();
+                order.append(parts);
+                std::sort(order.begin(), order.end(), cursor_lt(m_cursors));
+                table_element max_key = m_cursors[order.back()]->key();
+                unsigned idx = 0;
+                while (true) {
+                    trie_cursor & c = *m_cursors[order[idx]];
+                    if (c.key()==max_key) {
+                        //the cursors are sorted cyclically from idx, so all of them are at max_key
+                        m_binding[v] = max_key;
+                        if (join(v+1)) {
+                            found = true;
+                            if (m_exists_only[v]) {
+                                break;
+                            }
+                        }
+                        c.next();
+                    }
+                    else {
+                        c.seek(max_key);
+                    }
+                    if (c.at_end()) {
+                        break;
+                    }
+                    max_key = c.key();
+                    idx = (idx+1)%part_cnt;
+                }
+            }
+            for (unsigned i=0; i<part_cnt; i++) {
+                m_cursors[parts[i]]->up();
+            }
+            return found;
+        }
+
+    public:
+        leapfrog_join_fn(unsigned n, const table_base * const * tables, const unsigned_vector & col_vars, 
+                const unsigned_vector & result_vars) 
+                : m_result_vars(result_vars), m_result(0) {
+            unsigned var_cnt = 0;
+            for (unsigned i=0; i<col_vars.size(); i++) {
+                var_cnt = std::max(var_cnt, col_vars[i]+1);
+            }
+            svector<table_sort> var_sorts;
+            var_sorts.resize(var_cnt, 0);
+            m_key_cols.resize(n);
+            m_participants.resize(var_cnt);
+            m_order.resize(var_cnt);
+            unsigned ofs = 0;
+            for (unsigned i=0; i<n; i++) {
+                const table_signature & sig = tables[i]->get_signature();
+                unsigned sz = sig.size();
+                //columns in the order of their variables
+                for (unsigned v=0; v<var_cnt; v++) {
+                    for (unsigned j=0; j<sz; j++) {
+                        if (col_vars[ofs+j]==v) {
+                            m_key_cols[i].push_back(j);
+                            m_participants[v].push_back(i);
+                            var_sorts[v] = sig[j];
+                        }
+                    }
+                }
+                SASSERT(m_key_cols[i].size()==sz);
+                ofs += sz;
+            }
+            SASSERT(ofs==col_vars.size());
+            m_exists_only.resize(var_cnt+1, true);
+            for (unsigned i=0; i<result_vars.size(); i++) {
+                m_result_sig.push_back(var_sorts[result_vars[i]]);
+                for (unsigned v=0; v<=result_vars[i]; v++) {
+                    m_exists_only[v] = false;
+                }
+            }
+            m_binding.resize(var_cnt);
+            m_fact.resize(result_vars.size());
+            for (unsigned i=0; i<n; i++) {
+                m_cursors.push_back(alloc(trie_cursor));
+            }
+        }
+
+        virtual ~leapfrog_join_fn() {
+            for (unsigned i=0; i<m_cursors.size(); i++) {
+                dealloc(m_cursors[i]);
+            }
+        }
+
+        virtual table_base * operator()(unsigned n, const table_base * const * tables) {
+            verbose_action  _va("leapfrog_join");
+            SASSERT(n==m_cursors.size());
+            sparse_table_plugin & plugin = get(tables[0])->get_plugin();
+            m_result = get(plugin.mk_empty(m_result_sig));
+            for (unsigned i=0; i<n; i++) {
+                if (tables[i]->empty()) {
+                    return m_result;
+                }
+            }
+            for (unsigned i=0; i<n; i++) {
+                const sparse_table & t = *get(tables[i]);
+                const unsigned_vector & key = m_key_cols[i];
+                m_cursors[i]->init(t, t.get_trie_index(key.size(), key.c_ptr()));
+            }
+            join(0);
+            sparse_table * res = m_result;
+            m_result = 0;
+            return res;
+        }
+    };
+
+    table_nary_join_fn * sparse_table_plugin::mk_nary_join_fn(unsigned n, const table_base * const * tables, 
+            const unsigned_vector & col_vars, const unsigned_vector & result_vars) {
+        for (unsigned i=0; i<n; i++) {
+            if (!check_kind(*tables[i]) || tables[i]->get_signature().functional_columns()>0) {
+                return 0;
+            }
+        }
+        return alloc(leapfrog_join_fn, n, tables, col_vars, result_vars);
+    }
+
+
     unsigned sparse_table::get_size_estimate_bytes() const {
         unsigned sz = 0;
         sz += m_data.get_size_estimate_bytes();
@@ -31,6 +31,7 @@ Revision History:
 #include "map.h"
 #include "ref_vector.h"
 #include "vector.h"
+#include "task_pool.h"
 
 #include "dl_base.h"
 
@@ -49,12 +50,14 @@ namespace datalog {
         class negation_filter_fn;
         class select_equal_and_project_fn;
         class negated_join_fn;
+        class leapfrog_join_fn;
 
         typedef ptr_vector<sparse_table> sp_table_vector;
         typedef map<table_signature, sp_table_vector *, 
             table_signature::hash, table_signature::eq > table_pool;
 
         table_pool m_pool;
+        task_pool::mutex m_pool_mutex;   // tables of the pool are shared by parallel threads
 
         void recycle(sparse_table * t);
 
@@ -74,6 +77,8 @@ namespace datalog {
         virtual bool can_handle_signature(const table_signature & s) 
         { return s.size()>0; }
 
+        virtual bool is_thread_safe() const { return true; }
+
         virtual table_base * mk_empty(const table_signature & s);
         sparse_table * mk_clone(const sparse_table & t);
 
@@ -102,6 +107,8 @@ namespace datalog {
             unsigned_vector const& src_cols,
             unsigned_vector const& src1_cols,
             unsigned_vector const& src2_cols);
+        virtual table_nary_join_fn * mk_nary_join_fn(unsigned n, const table_base * const * tables, 
+            const unsigned_vector & col_vars, const unsigned_vector & result_vars);
 
         static sparse_table const& get(table_base const&);
         static sparse_table& get(table_base&);
@@ -310,11 +317,13 @@ namespace datalog {
         friend class sparse_table_plugin::project_fn;
         friend class sparse_table_plugin::negation_filter_fn;
         friend class sparse_table_plugin::select_equal_and_project_fn;
+        friend class sparse_table_plugin::leapfrog_join_fn;
 
         class our_iterator_core;
         class key_indexer;
         class general_key_indexer;
         class full_signature_key_indexer;
+        class trie_index;
         typedef entry_storage::store_offset store_offset;
 
         
@@ -379,6 +388,8 @@ namespace datalog {
         typedef svector<table_element> key_value;  //values of key columns
         typedef map<key_spec, key_indexer*, svector_hash_proc<unsigned_hash>,
             vector_eq_proc<key_spec> > key_index_map;
+        typedef map<key_spec, trie_index*, svector_hash_proc<unsigned_hash>,
+            vector_eq_proc<key_spec> > trie_index_map;
 
         static const store_offset NO_RESERVE = UINT_MAX;
 
@@ -386,6 +397,7 @@ namespace datalog {
         unsigned m_fact_size;
         entry_storage m_data;
         mutable key_index_map m_key_indexes;
+        mutable trie_index_map m_trie_indexes;
 
 
         const char * get_at_offset(store_offset i) const {
@@ -416,6 +428,15 @@ namespace datalog {
         */
         key_indexer& get_key_indexer(unsigned key_len, const unsigned * key_cols) const;
 
+        /**
+           \brief Return reference to the rows of the table sorted lexicographically by the 
+           \c key_cols columns.
+
+           Trie indexes are populated lazily and destroyed on fact removal in the same way as
+           the indexers returned by \c get_key_indexer.
+        */
+        const trie_index& get_trie_index(unsigned key_len, const unsigned * key_cols) const;
+
         void reset_indexes();
 
         static void copy_columns(const column_layout & src_layout, const column_layout & dest_layout, 
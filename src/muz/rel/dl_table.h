@@ -61,6 +61,8 @@ namespace datalog {
         hashtable_table_plugin(relation_manager & manager) 
             : table_plugin(symbol("hashtable"), manager) {}
 
+        virtual bool is_thread_safe() const { return true; }
+
         virtual table_base * mk_empty(const table_signature & s);
 
         virtual table_join_fn * mk_join_fn(const table_base & t1, const table_base & t2,
@@ -33,6 +33,7 @@ Revision History:
 #include"dl_finite_product_relation.h"
 #include"dl_lazy_table.h"
 #include"dl_sparse_table.h"
+#include"dl_bdd_table.h"
 #include"dl_table.h"
 #include"dl_table_relation.h"
 #include"aig_exporter.h"
@@ -48,6 +49,7 @@ Revision History:
 #include"dl_mk_bit_blast.h"
 #include"dl_mk_separate_negated_tails.h"
 #include"fixedpoint_params.hpp"
+#include"stopwatch.h"
 
 
 namespace datalog {
@@ -105,6 +107,7 @@ namespace datalog {
         rm.register_plugin(alloc(hashtable_table_plugin, rm));
         rm.register_plugin(alloc(bitvector_table_plugin, rm));
         rm.register_plugin(alloc(equivalence_table_plugin, rm));
+        rm.register_plugin(alloc(bdd_table_plugin, rm));
         rm.register_plugin(lazy_table_plugin::mk_sparse(rm));
 
         // register plugins for builtin relations
@@ -134,6 +137,10 @@ namespace datalog {
                         
         instruction_block termination_code;
 
+        // a new join plan is made for the rules of this saturation, including the query rules.
+        rule_set replan_rules(m_context.get_rules());
+        decl_set replan_preds(m_context.get_predicates());
+        unsigned num_replans = 0;
         lbool result;
 
         TRACE("dl", m_context.display(tout););
@@ -158,7 +165,7 @@ namespace datalog {
                 exit(0);
             }
 
-            compiler::compile(m_context, m_context.get_rules(), m_code, termination_code);
+            compiler::compile(m_context, m_context.get_rules(), m_code, termination_code, &m_ectx.get_pred_regs());
 
             TRACE("dl", m_code.display(*this, tout); );
 
@@ -170,12 +177,18 @@ namespace datalog {
                     : remaining_time_limit : restart_time;
                 m_ectx.set_timelimit(timeout);
             }
+            if (num_replans < m_context.max_join_replans()) {
+                m_ectx.set_replan_factor(m_context.join_replan_factor());
+            }
 
+            ::stopwatch round_watch;
+            round_watch.start();
             bool early_termination = !m_code.perform(m_ectx);
             m_ectx.reset_timelimit();
             VERIFY( termination_code.perform(m_ectx) || m_context.canceled());
 
             m_code.process_all_costs();
+            get_rmanager().update_actual_sizes();
 
             IF_VERBOSE(10, m_ectx.report_big_relations(1000, verbose_stream()););
 
@@ -193,6 +206,26 @@ namespace datalog {
                 result = l_undef;
                 break;
             }
+            if (m_ectx.replan_requested()) {
+                // the relations computed so far are kept, and the join planner uses their sizes.
+                unsigned elapsed = static_cast<unsigned>(1000*round_watch.get_current_seconds());
+                IF_VERBOSE(1, verbose_stream() << "(datalog :replan-joins :after " << elapsed << "ms)\n";);
+                if (time_limit && remaining_time_limit <= elapsed) {
+                    m_context.set_status(TIMEOUT);
+                    result = l_undef;
+                    break;
+                }
+                if (time_limit) {
+                    remaining_time_limit -= elapsed;
+                }
+                num_replans++;
+                m_stats.m_num_replans++;
+                m_context.reopen();
+                m_context.restrict_predicates(replan_preds);
+                m_context.replace_rules(replan_rules);
+                m_context.close();
+                continue;
+            }
             if (timeout_after_this_round) {
                 m_context.set_status(TIMEOUT);
                 result = l_undef;
@@ -593,6 +626,21 @@ namespace datalog {
         m_ectx.report_big_relations(1000, out);
 
         get_rmanager().display_relation_sizes(out);
+
+        out << "\n--------------\n";
+        out << "Join plan estimates\n";
+        get_rmanager().display_size_estimates(out);
+    }
+
+    void rel_context::collect_statistics(statistics& st) const {
+        st.update("datalog join replans", m_stats.m_num_replans);
+        st.update("datalog parallel instructions", m_ectx.get_num_parallel_instructions());
+        get_rmanager().collect_statistics(st);
+    }
+
+    void rel_context::reset_statistics() {
+        m_stats.reset();
+        m_ectx.reset_parallel_instructions();
     }
 
 
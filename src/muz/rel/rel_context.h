@@ -33,6 +33,12 @@ namespace datalog {
     typedef vector<std::pair<func_decl*,relation_fact> > fact_vector;
 
     class rel_context : public rel_context_base {
+        struct stats {
+            stats() { reset(); }
+            void reset() { memset(this, 0, sizeof(*this)); }
+            unsigned m_num_replans;
+        };
+
         context&           m_context;
         ast_manager&       m;
         relation_manager   m_rmanager;
@@ -41,6 +47,7 @@ namespace datalog {
         fact_vector        m_table_facts;
         execution_context  m_ectx;
         instruction_block  m_code;
+        stats              m_stats;
 
         class scoped_query;
 
@@ -122,6 +129,9 @@ namespace datalog {
 
         virtual void display_profile(std::ostream& out);
 
+        virtual void collect_statistics(statistics& st) const;
+        virtual void reset_statistics();
+
         virtual lbool saturate();
 
     };
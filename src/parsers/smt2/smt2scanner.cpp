@@ -16,35 +16,26 @@ Author:
 Revision History:
 
 --*/
+#include<string.h>
 #include"smt2scanner.h"
 #include"parser_params.hpp"
 
 namespace smt2 {
 
-    void scanner::next() {
-        if (m_cache_input)
+    /**
+       \brief Consume the current character and the buffered characters in [m_stream.pos(), p).
+    */
+    void scanner::advance(char const * p) {
+        char const * b = m_stream.pos();
+        SASSERT(b <= p && p <= m_stream.end());
+        if (m_cache_input) {
             m_cache.push_back(m_curr);
-        SASSERT(m_curr != EOF);
-        if (m_interactive) {
-            m_curr = m_stream.get();
-        }
-        else if (m_bpos < m_bend) {
-            m_curr = m_buffer[m_bpos];
-            m_bpos++;
-        }
-        else {
-            m_stream.read(m_buffer, SCANNER_BUFFER_SIZE);
-            m_bend = static_cast<unsigned>(m_stream.gcount());
-            m_bpos = 0;
-            if (m_bpos == m_bend) {
-                m_curr = EOF;
-            }
-            else {
-                m_curr = m_buffer[m_bpos];
-                m_bpos++;
-            }
+            m_cache.append(static_cast<unsigned>(p - b), b);
         }
-        m_spos++;
+        SASSERT(m_curr != EOF);
+        m_stream.advance(p);
+        m_curr = *m_stream;
+        m_spos += static_cast<int>(p - b) + 1;
     }
     
     void scanner::read_comment() {
@@ -54,6 +45,13 @@ namespace smt2 {
             char c = curr();
             if (c == EOF)
                 return;
+            if (c != '\n') {
+                // skip the buffered part of the comment
+                char const * b = m_stream.pos();
+                char const * p = static_cast<char const *>(memchr(b, '\n', m_stream.end() - b));
+                advance(p ? p : m_stream.end());
+                continue;
+            }
             if (c == '\n') {
                 new_line();
                 next();
@@ -95,7 +93,17 @@ namespace smt2 {
             char n = m_normalized[static_cast<unsigned char>(c)];
             if (n == 'a' || n == '0' || n == '-') {
                 m_string.push_back(c);
-                next();
+                // copy the buffered part of the symbol
+                char const * b = m_stream.pos();
+                char const * e = m_stream.end();
+                char const * p = b;
+                for (; p < e; ++p) {
+                    n = m_normalized[static_cast<unsigned char>(*p)];
+                    if (n != 'a' && n != '0' && n != '-')
+                        break;
+                }
+                m_string.append(static_cast<unsigned>(p - b), b);
+                advance(p);
             }
             else {
                 m_string.push_back(0);
@@ -114,24 +122,37 @@ namespace smt2 {
         return read_symbol_core();
     }
     
+    void scanner::flush_digits(unsigned & digits, unsigned & scale, bool is_float, rational & q) {
+        if (scale == 1)
+            return;
+        m_number = rational(scale)*m_number + rational(digits);
+        if (is_float)
+            q *= rational(scale);
+        digits = 0;
+        scale  = 1;
+    }
+
     scanner::token scanner::read_number() {
         SASSERT('0' <= curr() && curr() <= '9');
         rational q(1);
-        m_number = rational(curr() - '0');
-        next();
+        m_number = rational(0);
         bool is_float = false;
-        
+        // digits are accumulated in a machine word, and added to m_number in blocks of 9.
+        unsigned digits = 0;
+        unsigned scale  = 1;
         while (true) {
             char c = curr();
             if ('0' <= c && c <= '9') {
-                m_number = rational(10)*m_number + rational(c - '0');
-                if (is_float)
-                    q *= rational(10);
+                digits = 10*digits + (c - '0');
+                scale *= 10;
+                if (scale == 1000000000) 
+                    flush_digits(digits, scale, is_float, q);
                 next();
             }
             else if (c == '.') {
                 if (is_float)
                     break;
+                flush_digits(digits, scale, is_float, q);
                 is_float = true;
                 next();
             }
@@ -139,6 +160,7 @@ namespace smt2 {
                 break;
             }
         }
+        flush_digits(digits, scale, is_float, q);
         if (is_float) 
             m_number /= q;
         TRACE("scanner", tout << "new number: " << m_number << "\n";);
@@ -243,15 +265,12 @@ namespace smt2 {
     }
     
     scanner::scanner(cmd_context & ctx, std::istream& stream, bool interactive):
-        m_interactive(interactive), 
         m_spos(0),
         m_curr(0), // avoid Valgrind warning
         m_line(1),
         m_pos(0),
         m_bv_size(UINT_MAX),
-        m_bpos(0),
-        m_bend(0),
-        m_stream(stream),
+        m_stream(stream, interactive),
         m_cache_input(false) {
         
         m_smtlib2_compliant = ctx.params().m_smtlib2_compliant;
@@ -290,7 +309,9 @@ namespace smt2 {
         m_normalized[static_cast<int>('.')] = 'a';
         m_normalized[static_cast<int>('?')] = 'a';
         m_normalized[static_cast<int>('/')] = 'a';
-        next();
+        // the first character was already read by m_stream
+        m_curr = *m_stream;
+        m_spos++;
     }
     
     scanner::token scanner::scan() {
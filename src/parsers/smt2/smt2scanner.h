@@ -24,6 +24,7 @@ Revision History:
 #include"vector.h"
 #include"rational.h"
 #include"cmd_context.h"
+#include"stream_buffer.h"
 
 namespace smt2 {
 
@@ -31,7 +32,6 @@ namespace smt2 {
     
     class scanner {
     private:
-        bool               m_interactive;
         int                m_spos; // position in the current line of the stream
         char               m_curr;  // current char;
         
@@ -43,12 +43,8 @@ namespace smt2 {
         unsigned           m_bv_size;
         // end of data
         char               m_normalized[256];
-#define SCANNER_BUFFER_SIZE 1024
-        char               m_buffer[SCANNER_BUFFER_SIZE];
-        unsigned           m_bpos;
-        unsigned           m_bend;
         svector<char>      m_string;
-        std::istream&      m_stream;
+        stream_buffer      m_stream;
         
         bool               m_cache_input;
         svector<char>      m_cache;
@@ -58,7 +54,16 @@ namespace smt2 {
         
         char curr() const { return m_curr; }
         void new_line() { m_line++; m_spos = 0; }
-        void next();
+        void next() {
+            if (m_cache_input)
+                m_cache.push_back(m_curr);
+            SASSERT(m_curr != EOF);
+            ++m_stream;
+            m_curr = *m_stream;
+            m_spos++;
+        }
+        void advance(char const * p);
+        void flush_digits(unsigned & digits, unsigned & scale, bool is_float, rational & q);
         
     public:
         
@@ -20,25 +20,7 @@ Revision History:
 #undef max
 #undef min
 #include"sat_solver.h"
-
-class stream_buffer {
-    std::istream & m_stream;
-    int            m_val;
-public:
-    
-    stream_buffer(std::istream & s):
-        m_stream(s) {
-        m_val = m_stream.get();
-    }
-
-    int  operator *() const { 
-        return m_val;
-    }
-
-    void operator ++() { 
-        m_val = m_stream.get();
-    }
-};
+#include"stream_buffer.h"
 
 template<typename Buffer>
 void skip_whitespace(Buffer & in) {
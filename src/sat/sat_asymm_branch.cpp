@@ -165,7 +165,8 @@ namespace sat {
             literal l = c[i];
             switch (s.value(l)) {
             case l_undef:
-                c[j] = l;
+                // swap: c[0..sz) still contains the original clause (for DRAT).
+                std::swap(c[j], c[i]);
                 j++;
                 break;
             case l_false:
@@ -177,6 +178,8 @@ namespace sat {
         }
         new_sz = j;
         m_elim_literals += sz - new_sz;
+        if (s.m_config.m_drat)
+            s.m_drat.add(new_sz, c.begin());
         switch(new_sz) {
         case 0:
             s.set_conflict(justification());
@@ -195,6 +198,8 @@ namespace sat {
             SASSERT(s.m_qhead == s.m_trail.size());
             return false;
         default:
+            if (s.m_config.m_drat)
+                s.m_drat.del(c);
             c.shrink(new_sz);
             s.attach_clause(c);
             SASSERT(s.m_qhead == s.m_trail.size());
@@ -99,7 +99,9 @@ namespace sat {
                     m_elim_literals++;
                     break;
                 case l_undef:
-                    c[j] = c[i];
+                    // swap instead of overwrite: c[0..sz) still contains the original 
+                    // clause, which is used to delete it from the DRAT proof.
+                    std::swap(c[j], c[i]);
                     j++;
                     break;
                 }
@@ -116,6 +118,8 @@ namespace sat {
                 unsigned new_sz = j;
                 CTRACE("sat_cleaner_bug", new_sz < 2, tout << "new_sz: " << new_sz << "\n";
                        if (c.size() > 0) tout << "unit: " << c[0] << "\n";);
+                if (s.m_config.m_drat && new_sz < sz)
+                    s.m_drat.add(new_sz, c.begin());
                 SASSERT(c.frozen() || new_sz >= 2);
                 if (new_sz == 0) {
                     // It can only happen with frozen clauses.
@@ -139,6 +143,8 @@ namespace sat {
                         s.del_clause(c);
                     }
                     else {
+                        if (s.m_config.m_drat && new_sz < sz)
+                            s.m_drat.del(c);
                         c.shrink(new_sz);
                         *it2 = *it;
                         it2++;
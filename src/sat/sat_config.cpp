@@ -108,6 +108,14 @@ namespace sat {
         }
         m_minimize_lemmas = p.minimize_lemmas();
         m_dyn_sub_res     = p.dyn_sub_res();
+
+        m_num_threads     = p.threads();
+        m_par_max_size    = p.threads_share_max_size();
+        m_par_max_glue    = p.threads_share_max_glue();
+
+        m_drat_file       = p.drat_file();
+        m_drat            = m_drat_file != symbol("");
+        m_drat_binary     = p.drat_binary();
     }
 
     void config::collect_param_descrs(param_descrs & r) {
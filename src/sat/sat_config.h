@@ -70,6 +70,14 @@ namespace sat {
         bool               m_minimize_lemmas;
         bool               m_dyn_sub_res;
 
+        unsigned           m_num_threads;
+        unsigned           m_par_max_size;
+        unsigned           m_par_max_glue;
+
+        bool               m_drat;
+        symbol             m_drat_file;
+        bool               m_drat_binary;
+
         symbol             m_always_true;
         symbol             m_always_false;
         symbol             m_caching;
@@ -0,0 +1,172 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    sat_drat.cpp
+
+Abstract:
+
+    Produce DRAT proofs.
+
+Author:
+
+Revision History:
+
+--*/
+#include"sat_drat.h"
+#include"sat_types.h"
+
+namespace sat {
+
+    // size of the output buffer before it is written to the file.
+    const unsigned DRAT_BUFFER_SIZE = 1 << 20;
+
+    drat::drat():
+        m_out(0),
+        m_binary(false),
+        m_num_add(0),
+        m_num_del(0) {
+    }
+
+    drat::~drat() {
+        if (m_out) {
+            flush();
+            m_out->close();
+            dealloc(m_out);
+        }
+    }
+
+    void drat::open(char const * file_name, bool binary) {
+        SASSERT(m_out == 0);
+        m_binary = binary;
+        m_out    = alloc(std::ofstream, file_name, binary ? std::ios::out | std::ios::binary : std::ios::out);
+        if (m_out->bad() || m_out->fail()) {
+            dealloc(m_out);
+            m_out = 0;
+            throw sat_param_exception("failed to open DRAT proof file");
+        }
+    }
+
+    void drat::flush() {
+        if (!m_buffer.empty()) {
+            m_out->write(m_buffer.c_ptr(), m_buffer.size());
+            m_buffer.reset();
+        }
+    }
+
+    void drat::begin(bool add) {
+        if (add) {
+            m_num_add++;
+            if (m_binary)
+                m_buffer.push_back('a');
+        }
+        else {
+            m_num_del++;
+            m_buffer.push_back('d');
+            if (!m_binary)
+                m_buffer.push_back(' ');
+        }
+    }
+
+    void drat::lit(literal l) {
+        unsigned v = l.var();
+        if (m_binary) {
+            // variable length encoding of 2*v + sign
+            unsigned u = 2 * v + (l.sign() ? 1 : 0);
+            while (u > 127) {
+                m_buffer.push_back(static_cast<char>(128 | (u & 127)));
+                u >>= 7;
+            }
+            m_buffer.push_back(static_cast<char>(u));
+        }
+        else {
+            char digits[16];
+            unsigned n = 0;
+            do {
+                digits[n++] = static_cast<char>('0' + v % 10);
+                v /= 10;
+            }
+            while (v > 0);
+            if (l.sign())
+                m_buffer.push_back('-');
+            while (n > 0)
+                m_buffer.push_back(digits[--n]);
+            m_buffer.push_back(' ');
+        }
+    }
+
+    void drat::end() {
+        if (m_binary) {
+            m_buffer.push_back(0);
+        }
+        else {
+            m_buffer.push_back('0');
+            m_buffer.push_back('\n');
+        }
+        if (m_buffer.size() >= DRAT_BUFFER_SIZE)
+            flush();
+    }
+
+    void drat::dump(bool add, unsigned num_lits, literal const * lits) {
+        if (!m_out)
+            return;
+        begin(add);
+        for (unsigned i = 0; i < num_lits; i++)
+            lit(lits[i]);
+        end();
+    }
+
+    void drat::add() {
+        dump(true, 0, 0);
+    }
+
+    void drat::add(literal l) {
+        dump(true, 1, &l);
+    }
+
+    void drat::add(literal l1, literal l2) {
+        literal ls[2] = { l1, l2 };
+        dump(true, 2, ls);
+    }
+
+    void drat::add(unsigned num_lits, literal const * lits) {
+        dump(true, num_lits, lits);
+    }
+
+    void drat::add(clause const & c) {
+        dump(true, c.size(), c.begin());
+    }
+
+    void drat::del(literal l1, literal l2) {
+        literal ls[2] = { l1, l2 };
+        dump(false, 2, ls);
+    }
+
+    void drat::del(unsigned num_lits, literal const * lits) {
+        dump(false, num_lits, lits);
+    }
+
+    void drat::del(clause const & c) {
+        dump(false, c.size(), c.begin());
+    }
+
+    void drat::del(clause const & c, literal l) {
+        if (!m_out)
+            return;
+        begin(false);
+        unsigned sz = c.size();
+        for (unsigned i = 0; i < sz; i++)
+            lit(c[i]);
+        lit(l);
+        end();
+    }
+
+    void drat::collect_statistics(statistics & st) const {
+        if (m_out) {
+            st.update("drat added clauses", m_num_add);
+            st.update("drat deleted clauses", m_num_del);
+        }
+    }
+
+};
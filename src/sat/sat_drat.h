@@ -0,0 +1,79 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    sat_drat.h
+
+Abstract:
+
+    Produce DRAT proofs.
+    The proof is a sequence of clause additions and deletions.
+    Additions are clauses that are RUP with respect to the current 
+    clause database of the checker. Deletions are always allowed.
+    The literals of Boolean variable v are written as v, which is
+    the numbering used by the DIMACS frontend. Proofs are only
+    supported for DIMACS input: goal2sat rejects solvers that
+    produce them, since its variables have no CNF a checker could use.
+
+    Output is buffered and written in large blocks.
+
+Author:
+
+Revision History:
+
+--*/
+#ifndef _SAT_DRAT_H_
+#define _SAT_DRAT_H_
+
+#include<fstream>
+#include"sat_types.h"
+#include"sat_clause.h"
+#include"statistics.h"
+
+namespace sat {
+
+    class drat {
+        std::ofstream * m_out;
+        bool            m_binary;
+        char_vector     m_buffer;
+        unsigned        m_num_add;
+        unsigned        m_num_del;
+
+        void flush();
+        void begin(bool add);
+        void lit(literal l);
+        void end();
+        void dump(bool add, unsigned num_lits, literal const * lits);
+    public:
+        drat();
+        ~drat();
+
+        /**
+           \brief Start writing the proof to the given file.
+        */
+        void open(char const * file_name, bool binary);
+        bool enabled() const { return m_out != 0; }
+
+        void add();
+        void add(literal l);
+        void add(literal l1, literal l2);
+        void add(unsigned num_lits, literal const * lits);
+        void add(literal_vector const & lits) { add(lits.size(), lits.c_ptr()); }
+        void add(clause const & c);
+
+        void del(literal l1, literal l2);
+        void del(unsigned num_lits, literal const * lits);
+        void del(literal_vector const & lits) { del(lits.size(), lits.c_ptr()); }
+        void del(clause const & c);
+        /**
+           \brief Delete the clause c \\/ l.
+        */
+        void del(clause const & c, literal l);
+
+        void collect_statistics(statistics & st) const;
+    };
+
+};
+
+#endif
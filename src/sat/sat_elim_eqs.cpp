@@ -47,6 +47,14 @@ namespace sat {
                 if (it2->is_binary_clause()) {
                     literal l2 = it2->get_literal();
                     literal r2 = norm(roots, l2);
+                    if (m_solver.m_config.m_drat && l1.index() < l2.index() && (l1 != r1 || l2 != r2)) {
+                        // log each binary clause once. The old clause is not deleted from the proof, 
+                        // since the equivalences used by cleanup_clauses may be among them.
+                        if (r1 == r2)
+                            m_solver.m_drat.add(r1);
+                        else if (r1 != ~r2)
+                            m_solver.m_drat.add(r1, r2);
+                    }
                     if (r1 == r2) {
                         m_solver.assign(r1, justification());
                         if (m_solver.inconsistent())
@@ -76,6 +84,7 @@ namespace sat {
         clause_vector::iterator it  = cs.begin();
         clause_vector::iterator it2 = it;
         clause_vector::iterator end = cs.end();
+        literal_vector old_lits;
         for (; it != end; ++it) {
             clause & c     = *(*it);
             TRACE("elim_eqs", tout << "processing: " << c << "\n";);
@@ -95,6 +104,10 @@ namespace sat {
             }
             if (!c.frozen())
                 m_solver.dettach_clause(c);
+            if (m_solver.m_config.m_drat) {
+                old_lits.reset();
+                old_lits.append(sz, c.begin());
+            }
             // apply substitution
             for (i = 0; i < sz; i++) {
                 SASSERT(!m_solver.was_eliminated(c[i].var()));
@@ -122,11 +135,18 @@ namespace sat {
             }
             if (i < sz) {
                 // clause is a tautology or was simplified
+                if (m_solver.m_config.m_drat) {
+                    // restore the original literals, they are logged as deleted.
+                    for (unsigned k = 0; k < sz; k++)
+                        c[k] = old_lits[k];
+                }
                 m_solver.del_clause(c);
                 continue; 
             }
             if (j == 0) {
                 // empty clause
+                if (m_solver.m_config.m_drat)
+                    m_solver.m_drat.add();
                 m_solver.set_conflict(justification());
                 for (; it != end; ++it) {
                     *it2 = *it;
@@ -136,6 +156,14 @@ namespace sat {
                 return;
             }
             TRACE("elim_eqs", tout << "after removing duplicates: " << c << " j: " << j << "\n";);
+            if (m_solver.m_config.m_drat) {
+                m_solver.m_drat.add(j, c.begin());
+                m_solver.m_drat.del(old_lits);
+                if (j <= 2) {
+                    // c is deleted below, and the unit/binary clause replacing it must survive.
+                    m_solver.m_drat.add(j, c.begin());
+                }
+            }
             if (j < sz)
                 c.shrink(j);
             else
@@ -0,0 +1,92 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    sat_parallel.cpp
+
+Abstract:
+
+    Portfolio mode for the SAT solver.
+
+Author:
+
+Revision History:
+
+--*/
+#include"sat_parallel.h"
+#include"sat_solver.h"
+
+namespace sat {
+
+    parallel::parallel(unsigned max_entries):
+        m_max_entries(max_entries),
+        m_num_added(0) {
+        m_entries.resize(max_entries);
+        m_owners.resize(max_entries, UINT_MAX);
+    }
+
+    void parallel::add_solver(solver * s) {
+        m_solvers.push_back(s);
+        m_heads.push_back(0);
+    }
+
+    void parallel::init_solver_params(unsigned id, params_ref & p) {
+        // the first solver uses the given configuration, 
+        // the others diversify the search.
+        p.set_uint("random_seed", p.get_uint("random_seed", 0) + id);
+        switch (id % 4) {
+        case 1:
+            p.set_sym("restart", symbol("geometric"));
+            p.set_sym("gc", symbol("glue"));
+            break;
+        case 2:
+            p.set_sym("phase", symbol("always_false"));
+            p.set_sym("gc", symbol("psm"));
+            break;
+        case 3:
+            p.set_double("random_freq", 0.05);
+            p.set_uint("restart.initial", 50);
+            p.set_sym("gc", symbol("dyn_psm"));
+            break;
+        default:
+            break;
+        }
+    }
+
+    void parallel::set_cancel(bool f) {
+        for (unsigned i = 1; i < m_solvers.size(); i++)
+            m_solvers[i]->set_cancel(f);
+    }
+
+    void parallel::share_clause(unsigned owner, unsigned num_lits, literal const * lits) {
+        #pragma omp critical (sat_parallel)
+        {
+            unsigned idx = static_cast<unsigned>(m_num_added % m_max_entries);
+            literal_vector & e = m_entries[idx];
+            e.reset();
+            e.append(num_lits, lits);
+            m_owners[idx] = owner;
+            m_num_added++;
+        }
+    }
+
+    void parallel::get_clauses(unsigned owner, literal_vector & lits) {
+        lits.reset();
+        #pragma omp critical (sat_parallel)
+        {
+            uint64 head = m_heads[owner];
+            if (m_num_added - head > m_max_entries)
+                head = m_num_added - m_max_entries; // older clauses were overwritten
+            for (; head < m_num_added; head++) {
+                unsigned idx = static_cast<unsigned>(head % m_max_entries);
+                if (m_owners[idx] == owner)
+                    continue;
+                lits.append(m_entries[idx]);
+                lits.push_back(null_literal);
+            }
+            m_heads[owner] = m_num_added;
+        }
+    }
+
+};
@@ -0,0 +1,71 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    sat_parallel.h
+
+Abstract:
+
+    Portfolio mode for the SAT solver.
+    A set of differently configured solvers runs in parallel on
+    copies of the same clause database. Short and low glue learned
+    clauses are exchanged using a bounded shared buffer.
+
+Author:
+
+Revision History:
+
+--*/
+#ifndef _SAT_PARALLEL_H_
+#define _SAT_PARALLEL_H_
+
+#include"sat_types.h"
+#include"params.h"
+
+namespace sat {
+    class solver;
+
+    class parallel {
+        ptr_vector<solver>     m_solvers;
+        // shared clauses are stored in a ring buffer of m_max_entries slots.
+        vector<literal_vector> m_entries;
+        unsigned_vector        m_owners;
+        unsigned               m_max_entries;
+        uint64                 m_num_added;
+        svector<uint64>        m_heads;    // next entry to be read by each solver.
+    public:
+        parallel(unsigned max_entries = 4096);
+
+        /**
+           \brief Register s as the solver with the given id.
+        */
+        void add_solver(solver * s);
+        unsigned num_solvers() const { return m_solvers.size(); }
+        solver & get_solver(unsigned id) const { return *(m_solvers[id]); }
+
+        /**
+           \brief Parameters for the id-th solver of the portfolio.
+        */
+        static void init_solver_params(unsigned id, params_ref & p);
+
+        /**
+           \brief Cancel all solvers but the first one.
+        */
+        void set_cancel(bool f);
+
+        /**
+           \brief Make the clause lits available to the other solvers.
+        */
+        void share_clause(unsigned owner, unsigned num_lits, literal const * lits);
+
+        /**
+           \brief Store in lits the clauses shared by other solvers since the last call.
+           The clauses are separated by null_literal.
+           Clauses are lost if the owner does not consume them fast enough.
+        */
+        void get_clauses(unsigned owner, literal_vector & lits);
+    };
+};
+
+#endif
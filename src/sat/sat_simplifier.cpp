@@ -261,11 +261,13 @@ namespace sat {
                 return;
             }
             if (sz == 1) {
+                if (s.m_config.m_drat) s.m_drat.add(c);
                 s.assign(c[0], justification());
                 s.del_clause(c);
                 continue;
             }
             if (sz == 2) {
+                if (s.m_config.m_drat) s.m_drat.add(c);
                 s.mk_bin_clause(c[0], c[1], c.is_learned());
                 s.del_clause(c);
                 continue;
@@ -530,7 +532,8 @@ namespace sat {
             literal l = c[i];
             switch (value(l)) {
             case l_undef:
-                c[j] = l;
+                // swap: c[0..sz) still contains the original clause (for DRAT).
+                std::swap(c[j], c[i]);
                 j++;
                 break;
             case l_false:
@@ -543,11 +546,15 @@ namespace sat {
                 break;
             case l_true:
                 r = true;
-                c[j] = l;
+                std::swap(c[j], c[i]);
                 j++;
                 break;
             }
         }
+        if (s.m_config.m_drat && j < sz) {
+            s.m_drat.add(j, c.begin());
+            s.m_drat.del(c);
+        }
         c.shrink(j);
         return r;
     }
@@ -618,6 +625,10 @@ namespace sat {
         m_num_elim_lits++;
         insert_todo(l.var());
         c.elim(l);
+        if (s.m_config.m_drat) {
+            s.m_drat.add(c);
+            s.m_drat.del(c, l);
+        }
         clause_use_list & occurs = m_use_list.get(l);
         occurs.erase_not_removed(c);
         m_sub_counter -= occurs.size()/2;
@@ -634,12 +645,14 @@ namespace sat {
             return;
         case 1:
             TRACE("elim_lit", tout << "clause became unit: " << c[0] << "\n";);
+            if (s.m_config.m_drat) s.m_drat.add(c);
             propagate_unit(c[0]);
             // propagate_unit will delete c.
             // remove_clause(c);
             return;
         case 2:
             TRACE("elim_lit", tout << "clause became binary: " << c[0] << " " << c[1] << "\n";);
+            if (s.m_config.m_drat) s.m_drat.add(c);
             s.mk_bin_clause(c[0], c[1], c.is_learned());
             m_sub_bin_todo.push_back(bin_clause(c[0], c[1], c.is_learned()));
             remove_clause(c);
@@ -826,6 +839,7 @@ namespace sat {
                     return;
                 }
                 if (sz == 1) {
+                    if (s.m_config.m_drat) s.m_drat.add(c);
                     propagate_unit(c[0]);
                     // propagate_unit will delete c.
                     // remove_clause(c);
@@ -833,6 +847,7 @@ namespace sat {
                 }
                 if (sz == 2) {
                     TRACE("subsumption", tout << "clause became binary: " << c << "\n";);
+                    if (s.m_config.m_drat) s.m_drat.add(c);
                     s.mk_bin_clause(c[0], c[1], c.is_learned());
                     m_sub_bin_todo.push_back(bin_clause(c[0], c[1], c.is_learned()));
                     remove_clause(c);
@@ -1371,6 +1386,8 @@ namespace sat {
                 TRACE("resolution_new_cls", tout << *it1 << "\n" << *it2 << "\n-->\n" << m_new_cls << "\n";);
                 if (cleanup_clause(m_new_cls))
                     continue; // clause is already satisfied.
+                if (s.m_config.m_drat)
+                    s.m_drat.add(m_new_cls);
                 switch (m_new_cls.size()) {
                 case 0:
                     s.set_conflict(justification());
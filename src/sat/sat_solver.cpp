@@ -20,6 +20,8 @@ Revision History:
 #include"sat_integrity_checker.h"
 #include"luby.h"
 #include"trace.h"
+#include"z3_omp.h"
+#include"scoped_ptr_vector.h"
 
 // define to update glue during propagation
 #define UPDATE_GLUE
@@ -45,8 +47,12 @@ namespace sat {
         m_case_split_queue(m_activity),
         m_qhead(0),
         m_scope_lvl(0),
-        m_params(p) {
+        m_params(p),
+        m_par(0),
+        m_par_id(0) {
         updt_params(p);
+        if (m_config.m_drat)
+            m_drat.open(m_config.m_drat_file.bare_str(), m_config.m_drat_binary);
     }
 
     solver::~solver() {
@@ -78,7 +84,7 @@ namespace sat {
         {
             // copy binary clauses
             vector<watch_list>::const_iterator it  = src.m_watches.begin();
-            vector<watch_list>::const_iterator end = src.m_watches.begin();
+            vector<watch_list>::const_iterator end = src.m_watches.end();
             for (unsigned l_idx = 0; it != end; ++it, ++l_idx) {
                 watch_list const & wlist = *it;
                 literal l = ~to_literal(l_idx);
@@ -88,10 +94,25 @@ namespace sat {
                     if (!it2->is_binary_non_learned_clause())
                         continue;
                     literal l2 = it2->get_literal();
+                    // each binary clause is stored in two watch lists
+                    if (l.index() > l2.index())
+                        continue;
                     mk_clause(l, l2);
                 }
             }
         }
+        {
+            // copy units
+            literal_vector::const_iterator it  = src.m_trail.begin();
+            literal_vector::const_iterator end = src.m_trail.end();
+            for (; it != end; ++it) {
+                literal l = *it;
+                if (src.lvl(l) == 0)
+                    mk_clause(1, &l);
+            }
+            if (src.inconsistent())
+                set_conflict(justification());
+        }
         {
             literal_vector buffer;
             // copy clause
@@ -143,6 +164,9 @@ namespace sat {
             for (unsigned i = 0; i < num_lits; i++)
                 SASSERT(m_eliminated[lits[i].var()] == false);
         });
+        // the search state of a previous check is discarded,
+        // new clauses are asserted at the base level.
+        pop(scope_lvl());
         mk_clause_core(num_lits, lits, false);
     }
 
@@ -159,11 +183,14 @@ namespace sat {
     clause * solver::mk_clause_core(unsigned num_lits, literal * lits, bool learned) {
         if (!learned) {
             TRACE("sat_mk_clause", tout << "mk_clause: " << mk_lits_pp(num_lits, lits) << "\n";);
+            unsigned old_num_lits = num_lits;
             bool keep = simplify_clause(num_lits, lits);
             TRACE("sat_mk_clause", tout << "mk_clause (after simp), keep: " << keep << "\n" << mk_lits_pp(num_lits, lits) << "\n";);
             if (!keep) {
                 return 0; // clause is equivalent to true.
             }
+            if (m_config.m_drat && num_lits < old_num_lits)
+                m_drat.add(num_lits, lits);
         }
 
         switch (num_lits) {
@@ -685,8 +712,43 @@ namespace sat {
     // Search
     //
     // -----------------------
-    lbool solver::check() {
-        SASSERT(scope_lvl() == 0);
+    /**
+       \brief Check satisfiability of the clause database under the
+       given assumptions. Learned clauses are kept between calls.
+       If the result is l_false, then get_core() contains a subset of
+       the assumptions that is sufficient for unsatisfiability.
+       The core is empty if the clauses are unsatisfiable without
+       any assumption.
+    */
+    lbool solver::check(unsigned num_lits, literal const * lits) {
+        lbool r = check_core(num_lits, lits);
+        if (r == l_false && m_config.m_drat)
+            drat_unsat();
+        return r;
+    }
+
+    /**
+       \brief Close the DRAT proof of an unsatisfiable check. Without a core the proof
+       ends with the empty clause, otherwise with the clause refuting the core.
+    */
+    void solver::drat_unsat() {
+        literal_vector lits;
+        literal_vector::const_iterator it  = m_core.begin();
+        literal_vector::const_iterator end = m_core.end();
+        for (; it != end; ++it)
+            lits.push_back(~(*it));
+        m_drat.add(lits);
+    }
+
+    lbool solver::check_core(unsigned num_lits, literal const * lits) {
+        pop(scope_lvl());
+        for (unsigned i = 0; i < num_lits; i++) {
+            bool_var v = lits[i].var();
+            if (v >= num_vars() || was_eliminated(v))
+                throw solver_exception("assumption on a variable that does not exist or was eliminated");
+        }
+        if (m_config.m_num_threads > 1 && !m_par && !m_ext && !m_config.m_drat && m_mc.empty() && !omp_in_parallel())
+            return check_par(num_lits, lits);
 #ifdef CLONE_BEFORE_SOLVING
         if (m_mc.empty()) {
             m_clone = alloc(solver, m_params, 0 /* do not clone extension */);
@@ -694,6 +756,7 @@ namespace sat {
         }
 #endif
         try {
+            init_assumptions(num_lits, lits);
             if (inconsistent()) return l_false;
             init_search();
             propagate(false);
@@ -733,6 +796,8 @@ namespace sat {
                 }
 
                 restart();
+                import_shared_clauses();
+                if (inconsistent()) return l_false;
                 if (m_conflicts >= m_next_simplify) {
                     simplify_problem();
                     m_next_simplify = static_cast<unsigned>(m_conflicts * m_config.m_simplify_mult2);
@@ -830,6 +895,12 @@ namespace sat {
 
             gc();
 
+            if (scope_lvl() < m_assumptions.size()) {
+                if (!decide_assumption())
+                    return l_false;
+                continue;
+            }
+
             if (!decide()) {
                 if (m_ext) {
                     switch (m_ext->check()) {
@@ -850,6 +921,178 @@ namespace sat {
         }
     }
 
+    /**
+       \brief Portfolio mode: run m_config.m_num_threads differently configured
+       copies of this solver in parallel. The first solver to produce
+       an answer cancels the others. Copies are only created before
+       the first simplification, i.e., when the model converter is empty.
+    */
+    lbool solver::check_par(unsigned num_lits, literal const * lits) {
+        SASSERT(m_mc.empty());
+        SASSERT(scope_lvl() == 0);
+        int num_threads = static_cast<int>(m_config.m_num_threads);
+        parallel par;
+        scoped_ptr_vector<solver> solvers;
+        m_par    = &par;
+        m_par_id = 0;
+        par.add_solver(this);
+        for (int i = 1; i < num_threads; i++) {
+            params_ref p(m_params);
+            parallel::init_solver_params(i, p);
+            solver * s = alloc(solver, p, 0);
+            s->copy(*this);
+            s->m_par    = &par;
+            s->m_par_id = i;
+            solvers.push_back(s);
+            par.add_solver(s);
+        }
+        IF_VERBOSE(SAT_VB_LVL, verbose_stream() << "(sat-parallel :threads " << num_threads << ")\n";);
+
+        int         finished_id = -1;
+        lbool       result      = l_undef;
+        bool        has_ex      = false;
+        std::string ex_msg;
+        #pragma omp parallel for num_threads(num_threads)
+        for (int i = 0; i < num_threads; i++) {
+            solver & s = par.get_solver(i);
+            try {
+                lbool r = s.check(num_lits, lits);
+                if (r != l_undef) {
+                    bool first = false;
+                    #pragma omp critical (sat_parallel)
+                    {
+                        if (finished_id == -1) {
+                            finished_id = i;
+                            result      = r;
+                            first       = true;
+                        }
+                    }
+                    if (first) {
+                        if (i == 0) 
+                            par.set_cancel(true);
+                        else
+                            set_cancel(true);
+                    }
+                }
+            }
+            catch (z3_exception & ex) {
+                if (i == 0) {
+                    has_ex = true;
+                    ex_msg = ex.msg();
+                }
+            }
+        }
+        m_par = 0;
+        if (finished_id == -1) {
+            if (has_ex)
+                throw solver_exception(ex_msg.c_str());
+            return l_undef;
+        }
+        m_cancel = false;
+        IF_VERBOSE(SAT_VB_LVL, verbose_stream() << "(sat-parallel :winner " << finished_id << ")\n";);
+        if (finished_id != 0) {
+            solver & s = par.get_solver(finished_id);
+            m_model.reset();
+            m_model.append(s.m_model);
+            m_core.reset();
+            m_core.append(s.m_core);
+            m_stats.m_par_import += s.m_stats.m_par_import;
+            m_stats.m_par_export += s.m_stats.m_par_export;
+        }
+        return result;
+    }
+
+    /**
+       \brief Make the last lemma available to the other solvers of the portfolio.
+    */
+    void solver::share_lemma(unsigned glue) {
+        SASSERT(m_par);
+        if (m_lemma.size() <= m_config.m_par_max_size || glue <= m_config.m_par_max_glue) {
+            m_par->share_clause(m_par_id, m_lemma.size(), m_lemma.c_ptr());
+            m_stats.m_par_export++;
+        }
+    }
+
+    /**
+       \brief Add the clauses learned by the other solvers of the portfolio.
+       Clauses containing variables that were eliminated or that are used by 
+       the model converter are ignored.
+    */
+    void solver::import_shared_clauses() {
+        if (!m_par)
+            return;
+        SASSERT(scope_lvl() == 0);
+        m_par->get_clauses(m_par_id, m_par_lits);
+        if (m_par_lits.empty())
+            return;
+        bool_var_set mc_vars;
+        m_mc.collect_vars(mc_vars);
+        unsigned sz  = m_par_lits.size();
+        unsigned beg = 0;
+        for (unsigned i = 0; i < sz && !inconsistent(); i++) {
+            if (m_par_lits[i] != null_literal)
+                continue;
+            literal * lits    = m_par_lits.c_ptr() + beg;
+            unsigned num_lits = i - beg;
+            beg = i + 1;
+            bool ok = true;
+            for (unsigned j = 0; ok && j < num_lits; j++) {
+                bool_var v = lits[j].var();
+                ok = v < num_vars() && !was_eliminated(v) && !mc_vars.contains(v);
+            }
+            if (ok && simplify_clause(num_lits, lits)) {
+                m_stats.m_par_import++;
+                mk_clause_core(num_lits, lits, true);
+            }
+        }
+        if (!inconsistent())
+            propagate(false);
+        TRACE("sat_parallel", tout << "imported clauses: " << m_stats.m_par_import << "\n";);
+    }
+
+    /**
+       \brief Store the assumptions for the next search.
+       The i-th assumption is asserted at scope level i+1, so restarts
+       and backjumps re-establish them using decide_assumption.
+       Assumption variables are marked as external to prevent the
+       simplifier from eliminating them.
+    */
+    void solver::init_assumptions(unsigned num_lits, literal const * lits) {
+        m_assumptions.reset();
+        m_core.reset();
+        for (unsigned i = 0; i < num_lits; i++) {
+            literal l = lits[i];
+            SASSERT(l.var() < num_vars());
+            SASSERT(!was_eliminated(l.var()));
+            m_external[l.var()] = true;
+            m_assumptions.push_back(l);
+        }
+        TRACE("sat_assumptions", tout << "assumptions: " << m_assumptions << "\n";);
+    }
+
+    /**
+       \brief Open a new scope for the next assumption.
+       If the assumption is already true, the scope is empty.
+       Return false if the assumption is false. In this case,
+       the unsatisfiable core is stored in m_core.
+    */
+    bool solver::decide_assumption() {
+        literal l = m_assumptions[scope_lvl()];
+        switch (value(l)) {
+        case l_false:
+            analyze_final(l);
+            return false;
+        case l_true:
+            push();
+            return true;
+        default:
+            push();
+            assign(l, justification());
+            TRACE("sat_assumptions", tout << "assumption: " << l << " lvl: " << scope_lvl() << "\n";);
+            return true;
+        }
+    }
+
     void solver::init_search() {
         m_phase_counter           = 0;
         m_phase_cache_on          = false;
@@ -1433,6 +1676,10 @@ namespace sat {
 
         pop(m_scope_lvl - new_scope_lvl);
         TRACE("sat_conflict_detail", display(tout); tout << "assignment:\n"; display_assignment(tout););
+        if (m_config.m_drat)
+            m_drat.add(m_lemma);
+        if (m_par)
+            share_lemma(glue);
         clause * lemma = mk_clause_core(m_lemma.size(), m_lemma.c_ptr(), true);
         if (lemma) {
             lemma->set_glue(glue);
@@ -1540,6 +1787,72 @@ namespace sat {
         m_ext->get_antecedents(consequent, js.get_ext_justification_idx(), m_ext_antecedents);
     }
 
+    void solver::process_antecedent_for_core(literal antecedent) {
+        bool_var var = antecedent.var();
+        if (!is_marked(var) && lvl(var) > 0)
+            mark(var);
+    }
+
+    /**
+       \brief The assumption lit is false in the current assignment.
+       Collect in m_core lit and the assumptions that imply ~lit.
+       All literals above the base level were either asserted as
+       assumptions (justification NONE) or propagated from them.
+    */
+    void solver::analyze_final(literal lit) {
+        m_core.reset();
+        m_core.push_back(lit);
+        if (lvl(lit) == 0)
+            return;
+        SASSERT(scope_lvl() > 0);
+        mark(lit.var());
+        unsigned base = m_scopes[0].m_trail_lim;
+        unsigned idx  = m_trail.size();
+        while (idx > base) {
+            --idx;
+            literal consequent = m_trail[idx];
+            bool_var c_var     = consequent.var();
+            if (!is_marked(c_var))
+                continue;
+            reset_mark(c_var);
+            justification js   = m_justification[c_var];
+            switch (js.get_kind()) {
+            case justification::NONE:
+                m_core.push_back(consequent);
+                break;
+            case justification::BINARY:
+                process_antecedent_for_core(js.get_literal());
+                break;
+            case justification::TERNARY:
+                process_antecedent_for_core(js.get_literal1());
+                process_antecedent_for_core(js.get_literal2());
+                break;
+            case justification::CLAUSE: {
+                clause & c = *(m_cls_allocator.get_clause(js.get_clause_offset()));
+                unsigned sz = c.size();
+                for (unsigned i = 0; i < sz; i++) {
+                    if (c[i] != consequent)
+                        process_antecedent_for_core(c[i]);
+                }
+                break;
+            }
+            case justification::EXT_JUSTIFICATION: {
+                fill_ext_antecedents(consequent, js);
+                literal_vector::iterator it  = m_ext_antecedents.begin();
+                literal_vector::iterator end = m_ext_antecedents.end();
+                for (; it != end; ++it)
+                    process_antecedent_for_core(*it);
+                break;
+            }
+            default:
+                UNREACHABLE();
+                break;
+            }
+        }
+        TRACE("sat_core", tout << "core: " << m_core << "\n";);
+        CASSERT("sat_check_marks", check_marks());
+    }
+
     void solver::forget_phase_of_vars(unsigned from_lvl) {
         unsigned head = from_lvl == 0 ? 0 : m_scopes[from_lvl - 1].m_trail_lim;
         unsigned sz   = m_trail.size();
@@ -1988,6 +2301,8 @@ namespace sat {
 
     void solver::set_cancel(bool f) {
         m_cancel = f;
+        if (m_par && m_par_id == 0)
+            m_par->set_cancel(f);
     }
 
     void solver::collect_statistics(statistics & st) {
@@ -1997,6 +2312,7 @@ namespace sat {
         m_scc.collect_statistics(st);
         m_asymm_branch.collect_statistics(st);
         m_probing.collect_statistics(st);
+        m_drat.collect_statistics(st);
     }
 
     void solver::reset_statistics() {
@@ -2357,6 +2673,8 @@ namespace sat {
         st.update("restarts", m_restart);
         st.update("minimized lits", m_minimized_lits);
         st.update("dyn subsumption resolution", m_dyn_sub_res);
+        st.update("shared clauses exported", m_par_export);
+        st.update("shared clauses imported", m_par_import);
     }
 
     void stats::reset() {
@@ -2374,6 +2692,8 @@ namespace sat {
         m_del_clause = 0;
         m_minimized_lits = 0;
         m_dyn_sub_res = 0;
+        m_par_export = 0;
+        m_par_import = 0;
     }
 
     void mk_stat::display(std::ostream & out) const {
@@ -32,6 +32,8 @@ Revision History:
 #include"sat_asymm_branch.h"
 #include"sat_iff3_finder.h"
 #include"sat_probing.h"
+#include"sat_parallel.h"
+#include"sat_drat.h"
 #include"params.h"
 #include"statistics.h"
 #include"stopwatch.h"
@@ -57,6 +59,8 @@ namespace sat {
         unsigned m_del_clause;
         unsigned m_minimized_lits;
         unsigned m_dyn_sub_res;
+        unsigned m_par_export;
+        unsigned m_par_import;
         stats() { reset(); }
         void reset();
         void collect_statistics(statistics & st) const;
@@ -118,6 +122,10 @@ namespace sat {
         stopwatch               m_stopwatch;
         params_ref              m_params;
         scoped_ptr<solver>      m_clone; // for debugging purposes
+        drat                    m_drat;  // DRAT proof, enabled by m_config.m_drat
+        parallel *              m_par;   // not 0 if the solver is part of a portfolio
+        unsigned                m_par_id;
+        literal_vector          m_par_lits;
 
         void del_clauses(clause * const * begin, clause * const * end);
 
@@ -129,6 +137,7 @@ namespace sat {
         friend class asymm_branch;
         friend class probing;
         friend class iff3_finder;
+        friend class parallel;
         friend struct mk_stat;
     public:
         solver(params_ref const & p, extension * ext);
@@ -166,7 +175,11 @@ namespace sat {
         void mk_clause(literal l1, literal l2, literal l3);
 
     protected:
-        void del_clause(clause & c) { m_cls_allocator.del_clause(&c); m_stats.m_del_clause++; }
+        void del_clause(clause & c) { 
+            if (m_config.m_drat) m_drat.del(c);
+            m_cls_allocator.del_clause(&c); 
+            m_stats.m_del_clause++; 
+        }
         clause * mk_clause_core(unsigned num_lits, literal * lits, bool learned);
         void mk_bin_clause(literal l1, literal l2, bool learned);
         bool propagate_bin_clause(literal l1, literal l2);
@@ -199,6 +212,7 @@ namespace sat {
         unsigned num_vars() const { return m_level.size(); }
         bool is_external(bool_var v) const { return m_external[v] != 0; }
         bool was_eliminated(bool_var v) const { return m_eliminated[v] != 0; }
+        bool produces_drat() const { return m_config.m_drat; }
         unsigned scope_lvl() const { return m_scope_lvl; }
         lbool value(literal l) const { return static_cast<lbool>(m_assignment[l.index()]); }
         lbool value(bool_var v) const { return static_cast<lbool>(m_assignment[literal(v, false).index()]); }
@@ -250,11 +264,16 @@ namespace sat {
         //
         // -----------------------
     public:
-        lbool check();
+        // The assumptions may not use variables eliminated by previous checks, solver_exception is thrown otherwise.
+        // Variables created with mk_var(true) are never eliminated.
+        lbool check(unsigned num_lits = 0, literal const * lits = 0);
         model const & get_model() const { return m_model; }
         model_converter const & get_model_converter() const { return m_mc; }
+        literal_vector const & get_core() const { return m_core; }
 
     protected:
+        literal_vector m_assumptions;
+        literal_vector m_core;
         unsigned m_conflicts;
         unsigned m_conflicts_since_restart;
         unsigned m_restart_threshold;
@@ -266,6 +285,13 @@ namespace sat {
         bool decide();
         bool_var next_var();
         lbool bounded_search();
+        lbool check_core(unsigned num_lits, literal const * lits);
+        lbool check_par(unsigned num_lits, literal const * lits);
+        void drat_unsat();
+        void share_lemma(unsigned glue);
+        void import_shared_clauses();
+        void init_assumptions(unsigned num_lits, literal const * lits);
+        bool decide_assumption();
         void init_search();
         void simplify_problem();
         void mk_model();
@@ -315,6 +341,8 @@ namespace sat {
         unsigned get_max_lvl(literal consequent, justification js);
         void process_antecedent(literal antecedent, unsigned & num_marks);
         void fill_ext_antecedents(literal consequent, justification js);
+        void analyze_final(literal lit);
+        void process_antecedent_for_core(literal antecedent);
         unsigned skip_literals_above_conflict_level();
         void forget_phase_of_vars(unsigned from_lvl);
         void updt_phase_counters();
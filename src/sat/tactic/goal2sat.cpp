@@ -440,6 +440,9 @@ struct goal2sat::scoped_set_imp {
 };
 
 void goal2sat::operator()(goal const & g, params_ref const & p, sat::solver & t, atom2bool_var & m) {
+    // the proof would use the variables created by the conversion, and no CNF with them is available.
+    if (t.produces_drat())
+        throw tactic_exception("DRAT proofs are only supported for DIMACS input");
     imp proc(g.m(), p, t, m);
     scoped_set_imp set(this, &proc);
     proc(g);
@@ -54,6 +54,7 @@ public:
     
        \warning conversion throws a tactic_exception, if it is interrupted (by set_cancel),
        an unsupported operator is found, or memory consumption limit is reached (set with param :max-memory).
+       It also throws if \c t produces a DRAT proof, since they are only supported for DIMACS input.
     */
     void operator()(goal const & g, params_ref const & p, sat::solver & t, atom2bool_var & m);
 
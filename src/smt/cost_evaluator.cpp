@@ -68,10 +68,28 @@ float cost_evaluator::eval(expr * f) const {
             case OP_GE:       return E(0) >= E(1) ? 1.0f : 0.0f;
             case OP_LT:       return E(0) <  E(1) ? 1.0f : 0.0f;
             case OP_GT:       return E(0) >  E(1) ? 1.0f : 0.0f;
-            case OP_ADD:      return E(0) + E(1);
-            case OP_SUB:      return E(0) - E(1);
+            case OP_ADD: {
+                float r = E(0);
+                num_args = to_app(f)->get_num_args();
+                for (unsigned i = 1; i < num_args; i++)
+                    r += E(i);
+                return r;
+            }
+            case OP_SUB: {
+                float r = E(0);
+                num_args = to_app(f)->get_num_args();
+                for (unsigned i = 1; i < num_args; i++)
+                    r -= E(i);
+                return r;
+            }
             case OP_UMINUS:   return - E(0);
-            case OP_MUL:      return E(0) * E(1);
+            case OP_MUL: {
+                float r = E(0);
+                num_args = to_app(f)->get_num_args();
+                for (unsigned i = 1; i < num_args; i++)
+                    r *= E(i);
+                return r;
+            }
             case OP_DIV: {     
                 float q = E(1);
                 if (q == 0.0f) {
@@ -100,5 +118,245 @@ float cost_evaluator::operator()(expr * f, unsigned num_args, float const * args
     return eval(f);
 }
 
+void cost_program::reset() {
+    m_code.reset();
+    m_regs.reset();
+    m_arg_regs.reset();
+    m_arg_idxs.reset();
+    m_num_args = 0;
+    m_result   = 0;
+}
+
+float cost_program::operator()(unsigned num_args, float const * args) {
+    SASSERT(num_args == m_num_args);
+    float * regs   = m_regs.c_ptr();
+    unsigned num_used_args = m_arg_regs.size();
+    for (unsigned j = 0; j < num_used_args; j++)
+        regs[m_arg_regs[j]] = args[m_arg_idxs[j]];
+    unsigned pc    = 0;
+    unsigned sz    = m_code.size();
+    while (pc < sz) {
+        instruction const & i = m_code[pc];
+        pc++;
+        switch (i.m_opcode) {
+        case OPC_CONST:  regs[i.m_dst] = i.m_val; break;
+        case OPC_ERROR:
+            warning_msg("cost function evaluation error");
+            regs[i.m_dst] = 1.0f;
+            break;
+        case OPC_MOV:    regs[i.m_dst] = regs[i.m_arg1]; break;
+        case OPC_BOOL:   regs[i.m_dst] = regs[i.m_arg1] != 0.0f ? 1.0f : 0.0f; break;
+        case OPC_NOT:    regs[i.m_dst] = regs[i.m_arg1] == 0.0f ? 1.0f : 0.0f; break;
+        case OPC_EQ:     regs[i.m_dst] = regs[i.m_arg1] == regs[i.m_arg2] ? 1.0f : 0.0f; break;
+        case OPC_NEQ:    regs[i.m_dst] = regs[i.m_arg1] != regs[i.m_arg2] ? 1.0f : 0.0f; break;
+        case OPC_LE:     regs[i.m_dst] = regs[i.m_arg1] <= regs[i.m_arg2] ? 1.0f : 0.0f; break;
+        case OPC_GE:     regs[i.m_dst] = regs[i.m_arg1] >= regs[i.m_arg2] ? 1.0f : 0.0f; break;
+        case OPC_LT:     regs[i.m_dst] = regs[i.m_arg1] <  regs[i.m_arg2] ? 1.0f : 0.0f; break;
+        case OPC_GT:     regs[i.m_dst] = regs[i.m_arg1] >  regs[i.m_arg2] ? 1.0f : 0.0f; break;
+        case OPC_ADD:    regs[i.m_dst] = regs[i.m_arg1] + regs[i.m_arg2]; break;
+        case OPC_SUB:    regs[i.m_dst] = regs[i.m_arg1] - regs[i.m_arg2]; break;
+        case OPC_UMINUS: regs[i.m_dst] = - regs[i.m_arg1]; break;
+        case OPC_MUL:    regs[i.m_dst] = regs[i.m_arg1] * regs[i.m_arg2]; break;
+        case OPC_DIV:
+            if (regs[i.m_arg2] == 0.0f) {
+                warning_msg("cost function division by zero");
+                regs[i.m_dst] = 1.0f;
+            }
+            else {
+                regs[i.m_dst] = regs[i.m_arg1] / regs[i.m_arg2];
+            }
+            break;
+        case OPC_JMP:
+            pc = i.m_arg1;
+            break;
+        case OPC_JMP_IF_ZERO:
+            if (regs[i.m_arg1] == 0.0f)
+                pc = i.m_arg2;
+            break;
+        case OPC_JMP_IF_NOT_ZERO:
+            if (regs[i.m_arg1] != 0.0f)
+                pc = i.m_arg2;
+            break;
+        }
+    }
+    return regs[m_result];
+}
+
+void cost_program::display(std::ostream & out) const {
+    for (unsigned j = 0; j < m_arg_regs.size(); j++)
+        out << "r" << m_arg_regs[j] << " := arg " << m_arg_idxs[j] << "\n";
+    static char const * names[] = { "const", "error", "mov", "bool", "not", "eq", "neq", "le", "ge", "lt", "gt",
+                                    "add", "sub", "uminus", "mul", "div", "jmp", "jz", "jnz" };
+    for (unsigned pc = 0; pc < m_code.size(); pc++) {
+        instruction const & i = m_code[pc];
+        out << pc << ": " << names[i.m_opcode] << " r" << i.m_dst << " " << i.m_arg1 << " " << i.m_arg2;
+        if (i.m_opcode == OPC_CONST)
+            out << " " << i.m_val;
+        out << "\n";
+    }
+    out << "result: r" << m_result << "\n";
+}
+
+unsigned cost_evaluator::mk_reg(cost_program & p, float val) const {
+    p.m_regs.push_back(val);
+    return p.m_regs.size() - 1;
+}
+
+/**
+   \brief Append an instruction to p, and return its position.
+*/
+unsigned cost_evaluator::emit(cost_program & p, cost_program::opcode op, unsigned dst, unsigned arg1, unsigned arg2, float val) const {
+    cost_program::instruction i;
+    i.m_opcode = op;
+    i.m_dst    = dst;
+    i.m_arg1   = arg1;
+    i.m_arg2   = arg2;
+    i.m_val    = val;
+    p.m_code.push_back(i);
+    return p.m_code.size() - 1;
+}
 
+/**
+   \brief Set the target of the jump at position pc to the end of the program.
+*/
+void cost_evaluator::patch(cost_program & p, unsigned pc) const {
+    cost_program::instruction & i = p.m_code[pc];
+    if (i.m_opcode == cost_program::OPC_JMP)
+        i.m_arg1 = p.m_code.size();
+    else
+        i.m_arg2 = p.m_code.size();
+}
+
+/**
+   \brief Emit the code for f, and return the register that contains its value.
+   The code mirrors cost_evaluator::eval.
+*/
+unsigned cost_evaluator::compile(expr * f, cost_program & p) const {
+#define C(IDX) compile(to_app(f)->get_arg(IDX), p)
+    if (is_app(f)) {
+        unsigned num_args = to_app(f)->get_num_args();
+        family_id fid     = to_app(f)->get_family_id();
+        unsigned dst, r;
+        unsigned_vector jmps;
+        if (fid == m_manager.get_basic_family_id()) {
+            switch (to_app(f)->get_decl_kind()) {
+            case OP_TRUE:  
+                return mk_reg(p, 1.0f);
+            case OP_FALSE:
+                return mk_reg(p, 0.0f);
+            case OP_NOT:
+                r   = C(0);
+                dst = mk_reg(p);
+                emit(p, cost_program::OPC_NOT, dst, r);
+                return dst;
+            case OP_AND:
+            case OP_OR: {
+                bool is_and = to_app(f)->get_decl_kind() == OP_AND;
+                dst = mk_reg(p);
+                // value when the evaluation is short-circuited
+                emit(p, cost_program::OPC_CONST, dst, 0, 0, is_and ? 0.0f : 1.0f);
+                for (unsigned i = 0; i < num_args; i++) {
+                    r = C(i);
+                    jmps.push_back(emit(p, is_and ? cost_program::OPC_JMP_IF_ZERO : cost_program::OPC_JMP_IF_NOT_ZERO, 0, r));
+                }
+                emit(p, cost_program::OPC_CONST, dst, 0, 0, is_and ? 1.0f : 0.0f);
+                for (unsigned i = 0; i < jmps.size(); i++)
+                    patch(p, jmps[i]);
+                return dst;
+            }
+            case OP_ITE: {
+                r   = C(0);
+                dst = mk_reg(p);
+                unsigned jmp_else = emit(p, cost_program::OPC_JMP_IF_ZERO, 0, r);
+                emit(p, cost_program::OPC_MOV, dst, C(1));
+                unsigned jmp_end  = emit(p, cost_program::OPC_JMP, 0);
+                patch(p, jmp_else);
+                emit(p, cost_program::OPC_MOV, dst, C(2));
+                patch(p, jmp_end);
+                return dst;
+            }
+            case OP_EQ:
+            case OP_IFF:
+            case OP_XOR: {
+                unsigned r1 = C(0);
+                unsigned r2 = C(1);
+                dst = mk_reg(p);
+                emit(p, to_app(f)->get_decl_kind() == OP_XOR ? cost_program::OPC_NEQ : cost_program::OPC_EQ, dst, r1, r2);
+                return dst;
+            }
+            case OP_IMPLIES: {
+                dst = mk_reg(p);
+                emit(p, cost_program::OPC_CONST, dst, 0, 0, 1.0f);
+                r   = C(0);
+                unsigned jmp_end = emit(p, cost_program::OPC_JMP_IF_ZERO, 0, r);
+                emit(p, cost_program::OPC_BOOL, dst, C(1));
+                patch(p, jmp_end);
+                return dst;
+            }
+            default:
+                ;
+            }
+        }
+        else if (fid == m_util.get_family_id()) {
+            cost_program::opcode op;
+            switch (to_app(f)->get_decl_kind()) {
+            case OP_NUM: {
+                rational val = to_app(f)->get_decl()->get_parameter(0).get_rational();
+                return mk_reg(p, static_cast<float>(numerator(val).get_int64())/static_cast<float>(denominator(val).get_int64()));
+            }
+            case OP_LE:     op = cost_program::OPC_LE; break;
+            case OP_GE:     op = cost_program::OPC_GE; break;
+            case OP_LT:     op = cost_program::OPC_LT; break;
+            case OP_GT:     op = cost_program::OPC_GT; break;
+            case OP_ADD:    op = cost_program::OPC_ADD; break;
+            case OP_SUB:    op = cost_program::OPC_SUB; break;
+            case OP_MUL:    op = cost_program::OPC_MUL; break;
+            case OP_DIV:    op = cost_program::OPC_DIV; break;
+            case OP_UMINUS: 
+                r   = C(0);
+                dst = mk_reg(p);
+                emit(p, cost_program::OPC_UMINUS, dst, r);
+                return dst;
+            default:
+                op = cost_program::OPC_ERROR;
+                break;
+            }
+            if (op != cost_program::OPC_ERROR) {
+                // binary operators, +, - and * are folded from the left.
+                r = C(0);
+                for (unsigned i = 1; i < num_args; i++) {
+                    unsigned r2 = C(i);
+                    dst = mk_reg(p);
+                    emit(p, op, dst, r, r2);
+                    r = dst;
+                }
+                return r;
+            }
+        }
+    }
+    else if (is_var(f)) {
+        unsigned idx = to_var(f)->get_idx();
+        if (idx < m_num_args) {
+            unsigned arg_idx = m_num_args - idx - 1;
+            for (unsigned i = 0; i < p.m_arg_idxs.size(); i++) {
+                if (p.m_arg_idxs[i] == arg_idx)
+                    return p.m_arg_regs[i];
+            }
+            unsigned dst = mk_reg(p);
+            p.m_arg_regs.push_back(dst);
+            p.m_arg_idxs.push_back(arg_idx);
+            return dst;
+        }
+    }
+    unsigned dst = mk_reg(p);
+    emit(p, cost_program::OPC_ERROR, dst);
+    return dst;
+}
 
+void cost_evaluator::compile(expr * f, unsigned num_args, cost_program & r) {
+    r.reset();
+    m_num_args   = num_args;
+    r.m_num_args = num_args;
+    r.m_result   = compile(f, r);
+    TRACE("cost_program", r.display(tout););
+}
@@ -22,12 +22,73 @@ Revision History:
 #include"ast.h"
 #include"arith_decl_plugin.h"
 
+/**
+   \brief Cost function compiled into a sequence of instructions over a
+   register file. It produces the same values (and warnings) as
+   cost_evaluator, but it does not traverse the expression, and numerals
+   are converted only once.
+   Numerals are stored in registers when the program is compiled, and the
+   arguments used by the program are copied to registers before the
+   instructions are executed. So, (+ weight generation) is a single instruction.
+*/
+class cost_program {
+    friend class cost_evaluator;
+    enum opcode {
+        OPC_CONST,               // dst := val
+        OPC_ERROR,               // dst := 1, and report an evaluation error
+        OPC_MOV,                 // dst := arg1
+        OPC_BOOL,                // dst := arg1 != 0
+        OPC_NOT,                 // dst := arg1 == 0
+        OPC_EQ,
+        OPC_NEQ,
+        OPC_LE,
+        OPC_GE,
+        OPC_LT,
+        OPC_GT,
+        OPC_ADD,
+        OPC_SUB,
+        OPC_UMINUS,
+        OPC_MUL,
+        OPC_DIV,
+        OPC_JMP,                 // goto arg1
+        OPC_JMP_IF_ZERO,         // if arg1 == 0 goto arg2
+        OPC_JMP_IF_NOT_ZERO      // if arg1 != 0 goto arg2
+    };
+    struct instruction {
+        opcode   m_opcode;
+        unsigned m_dst;
+        unsigned m_arg1;
+        unsigned m_arg2;
+        float    m_val;
+    };
+    svector<instruction> m_code;
+    svector<float>       m_regs;
+    unsigned_vector      m_arg_regs;  // m_regs[m_arg_regs[i]] := args[m_arg_idxs[i]] before the code is executed.
+    unsigned_vector      m_arg_idxs;
+    unsigned             m_num_args;
+    unsigned             m_result;
+public:
+    cost_program():m_num_args(0), m_result(0) {}
+    void reset();
+    bool empty() const { return m_code.empty(); }
+    /**
+       \brief Evaluate the program. The arguments are stored as in cost_evaluator::operator(), 
+       and num_args must be the value used to compile the program.
+    */
+    float operator()(unsigned num_args, float const * args);
+    void display(std::ostream & out) const;
+};
+
 class cost_evaluator {
     ast_manager &   m_manager;
     arith_util      m_util;
     unsigned        m_num_args;
     float const *   m_args;
     float eval(expr * f) const;
+    unsigned mk_reg(cost_program & p, float val = 0.0f) const;
+    unsigned emit(cost_program & p, cost_program::opcode op, unsigned dst, unsigned arg1 = 0, unsigned arg2 = 0, float val = 0.0f) const;
+    void patch(cost_program & p, unsigned pc) const;
+    unsigned compile(expr * f, cost_program & p) const;
 public:
     cost_evaluator(ast_manager & m);
     /**
@@ -37,6 +98,12 @@ public:
        (VAR (num_args - 1)) is stored in the first position of the array.
     */
     float operator()(expr * f, unsigned num_args, float const * args);
+
+    /**
+       \brief Compile f into r. The resulting program is evaluated over
+       arrays of num_args arguments.
+    */
+    void compile(expr * f, unsigned num_args, cost_program & r);
 };
 
 #endif /* _COST_EVALUATOR_H_ */
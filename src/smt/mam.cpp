@@ -24,6 +24,8 @@ Revision History:
 #include"trail.h"
 #include"stopwatch.h"
 #include"ast_smt2_pp.h"
+#include"task_pool.h"
+#include"scoped_ptr_vector.h"
 #include<algorithm>
 
 // #define _PROFILE_MAM
@@ -552,6 +554,24 @@ namespace smt {
             return m_candidates;
         }
 
+        /**
+           \brief Remove duplicate candidates, keeping the first occurrence of each one.
+        */
+        void remove_duplicate_candidates() {
+            unsigned j = 0;
+            unsigned sz = m_candidates.size();
+            for (unsigned i = 0; i < sz; i++) {
+                enode * n = m_candidates[i];
+                if (!n->is_marked()) {
+                    n->set_mark();
+                    m_candidates[j++] = n;
+                }
+            }
+            m_candidates.shrink(j);
+            for (unsigned i = 0; i < j; i++)
+                m_candidates[i]->unset_mark();
+        }
+
 #ifdef Z3DEBUG
         void set_context(context * ctx) {
             SASSERT(m_context == 0);
@@ -1859,6 +1879,53 @@ namespace smt {
 
         pool<enode_vector>  m_pool;
 
+        // When m_deferred is true, the interpreter runs on a worker thread (see mam_impl::match_parallel).
+        // Matches are then recorded in m_matches, and only reported to m_mam by flush_matches.
+        struct deferred_match {
+            quantifier * m_qa;
+            app *        m_pat;
+            unsigned     m_num_bindings;
+            unsigned     m_bindings_idx;   // position of the bindings in m_match_bindings
+            unsigned     m_max_generation;
+            unsigned     m_min_top_generation;
+            unsigned     m_max_top_generation;
+        };
+        bool                     m_deferred;
+        task_pool::mutex *       m_cgr_mutex;  // protects the congruence table of m_context when m_deferred is true.
+        svector<deferred_match>  m_matches;
+        enode_vector             m_match_bindings;
+
+        enode * get_enode_eq_to(func_decl * f, unsigned num_args, enode * const * args) {
+            if (!m_deferred)
+                return m_context.get_enode_eq_to(f, num_args, args);
+            task_pool::scoped_lock lock(*m_cgr_mutex);
+            return m_context.get_enode_eq_to(f, num_args, args);
+        }
+
+        bool resource_limits_exceeded() {
+            // resource_limits_exceeded() updates the state of m_context, a worker only checks the cancel flag.
+            if (m_deferred)
+                return m_context.get_cancel_flag();
+            return m_context.resource_limits_exceeded();
+        }
+
+        void on_match(quantifier * qa, app * pat, unsigned num_bindings, enode * const * bindings) {
+            if (!m_deferred) {
+                m_mam.on_match(qa, pat, num_bindings, bindings, m_max_generation, m_used_enodes);
+                return;
+            }
+            deferred_match d;
+            d.m_qa                 = qa;
+            d.m_pat                = pat;
+            d.m_num_bindings       = num_bindings;
+            d.m_bindings_idx       = m_match_bindings.size();
+            d.m_max_generation     = m_max_generation;
+            d.m_min_top_generation = get_min_top_generation();
+            d.m_max_top_generation = get_max_top_generation();
+            m_matches.push_back(d);
+            m_match_bindings.append(num_bindings, bindings);
+        }
+
         enode_vector * mk_enode_vector() {
             enode_vector * r = m_pool.mk();
             r->reset();
@@ -1984,10 +2051,57 @@ namespace smt {
             m_context(ctx),
             m_ast_manager(ctx.get_manager()),
             m_mam(m), 
-            m_use_filters(use_filters) {
+            m_use_filters(use_filters),
+            m_deferred(false),
+            m_cgr_mutex(0) {
             m_args.resize(INIT_ARGS_SIZE, 0);
         }
 
+        /**
+           \brief Record matches instead of reporting them, and serialize the accesses
+           to the congruence table using cgr_mutex. In this mode, the interpreter
+           can be executed concurrently with other interpreters on code trees with
+           different root labels, as long as the E-graph is not modified.
+        */
+        void set_deferred(task_pool::mutex * cgr_mutex) {
+            m_deferred  = true;
+            m_cgr_mutex = cgr_mutex;
+        }
+
+        /**
+           \brief Add the instances for the matches recorded in deferred mode to ctx.
+        */
+        void flush_matches(context & ctx) {
+            svector<deferred_match>::const_iterator it  = m_matches.begin();
+            svector<deferred_match>::const_iterator end = m_matches.end();
+            for (; it != end; ++it) {
+                deferred_match const & d = *it;
+                ctx.add_instance(d.m_qa, d.m_pat, d.m_num_bindings, m_match_bindings.c_ptr() + d.m_bindings_idx, 
+                                 d.m_max_generation, d.m_min_top_generation, d.m_max_top_generation, m_used_enodes);
+            }
+            reset_matches();
+        }
+
+        void reset_matches() {
+            m_matches.reset();
+            m_match_bindings.reset();
+        }
+
+        /**
+           \brief Similar to execute, but the candidates of t must not contain duplicates.
+           It does not use the marks of the enodes.
+        */
+        void execute_unique(code_tree * t) {
+            init(t);
+            enode_vector::const_iterator it  = t->get_candidates().begin();
+            enode_vector::const_iterator end = t->get_candidates().end();
+            for (; it != end; ++it) {
+                enode * app = *it;
+                if (app->is_cgr())
+                    execute_core(t, app);
+            }
+        }
+
         ~interpreter() {
         }
 
@@ -2499,11 +2613,10 @@ namespace smt {
             m_bindings[0] = m_registers[static_cast<const yield *>(m_pc)->m_bindings[0]];
 #define ON_MATCH(NUM)                                                                                   \
             m_max_generation = std::max(m_max_generation, get_max_generation(NUM, m_bindings.begin())); \
-            m_mam.on_match(static_cast<const yield *>(m_pc)->m_qa,                                      \
-                           static_cast<const yield *>(m_pc)->m_pat,                                     \
-                           NUM,                                                                         \
-                           m_bindings.begin(),                                                          \
-                           m_max_generation, m_used_enodes)
+            on_match(static_cast<const yield *>(m_pc)->m_qa,                                            \
+                     static_cast<const yield *>(m_pc)->m_pat,                                           \
+                     NUM,                                                                               \
+                     m_bindings.begin())
             ON_MATCH(1);
             goto backtrack;
             
@@ -2561,7 +2674,7 @@ namespace smt {
 
         case GET_CGR1:
 #define GET_CGR_COMMON()                                                                                                                                                \
-            m_n1 = m_context.get_enode_eq_to(static_cast<const get_cgr *>(m_pc)->m_label, static_cast<const get_cgr *>(m_pc)->m_num_args, m_args.c_ptr());              \
+            m_n1 = get_enode_eq_to(static_cast<const get_cgr *>(m_pc)->m_label, static_cast<const get_cgr *>(m_pc)->m_num_args, m_args.c_ptr());                        \
             if (m_n1 == 0 || !m_context.is_relevant(m_n1))                                                                                                              \
                 goto backtrack;                                                                                                                                         \
             m_registers[static_cast<const get_cgr *>(m_pc)->m_oreg] = m_n1;                                                                                             \
@@ -2666,7 +2779,7 @@ namespace smt {
 
         if (since_last_check++ > 100) {
             since_last_check = 0;
-            if (m_context.resource_limits_exceeded()) {
+            if (resource_limits_exceeded()) {
                 // Soft timeout...
                 // Cleanup before exiting
                 while (m_top != 0) {
@@ -3078,6 +3191,31 @@ namespace smt {
 
         enode *                     m_r1; // temp field
         enode *                     m_r2; // temp field
+
+        // Interpreters used to match code trees in parallel (see match_parallel).
+        scoped_ptr_vector<interpreter> m_workers;
+        task_pool::mutex            m_cgr_mutex;
+
+        class match_task : public task_pool::task {
+            interpreter &          m_interpreter;
+            code_tree * const *    m_trees;
+            unsigned               m_num_trees;
+        public:
+            bool                   m_failed;
+            std::string            m_msg;
+            match_task(interpreter & i, code_tree * const * ts, unsigned num):
+                m_interpreter(i), m_trees(ts), m_num_trees(num), m_failed(false) {}
+            virtual void run() {
+                try {
+                    for (unsigned i = 0; i < m_num_trees; i++)
+                        m_interpreter.execute_unique(m_trees[i]);
+                }
+                catch (z3_exception & ex) {
+                    m_failed = true;
+                    m_msg    = ex.msg();
+                }
+            }
+        };
         
         class add_shared_enode_trail;
         friend class add_shared_enode_trail;
@@ -3859,15 +3997,98 @@ namespace smt {
             }
         }
         
-        virtual void match() { 
-            TRACE("trigger_bug", tout << "match\n"; display(tout););
+        /**
+           \brief Return the number of threads that should be used to match the trees in m_to_match.
+        */
+        unsigned get_num_match_threads() const {
+            if (!m_context.get_fparams().m_qi_parallel_matching || m_to_match.size() < 2)
+                return 1;
+            // The trace stream needs the used enodes of each match, and they are not recorded by deferred interpreters.
+            if (m_ast_manager.has_trace_stream())
+                return 1;
+            unsigned num_candidates = 0;
+            for (unsigned i = 0; i < m_to_match.size(); i++)
+                num_candidates += m_to_match[i]->get_candidates().size();
+            // Small batches are not worth the synchronization.
+            if (num_candidates < 64)
+                return 1;
+            return std::min(task_pool::get_max_threads(), m_to_match.size());
+        }
+
+        /**
+           \brief Match the trees in m_to_match using num_threads interpreters in parallel.
+           
+           The trees are split into num_threads contiguous chunks of similar number of candidates.
+           Trees in m_to_match have different root labels, so their candidates are different enodes.
+           The E-graph is not modified while the workers are running: the matches are recorded,
+           and the instances are only added to the qi_queue after all workers are done.
+           They are added in the same order used by the sequential loop.
+        */
+        void match_parallel(unsigned num_threads) {
+            unsigned num_candidates = 0;
             ptr_vector<code_tree>::iterator it  = m_to_match.begin();
             ptr_vector<code_tree>::iterator end = m_to_match.end();
             for (; it != end; ++it) {
                 code_tree * t = *it;
-                SASSERT(t->has_candidates());
-                m_interpreter.execute(t);
-                t->reset_candidates();
+                if (t->filter_candidates())
+                    t->remove_duplicate_candidates();
+                num_candidates += t->get_candidates().size();
+            }
+            while (m_workers.size() < num_threads) {
+                interpreter * i = alloc(interpreter, m_context, *this, m_use_filters);
+                i->set_deferred(&m_cgr_mutex);
+                m_workers.push_back(i);
+            }
+            scoped_ptr_vector<match_task> tasks;
+            ptr_buffer<task_pool::task>   ts;
+            unsigned sz    = m_to_match.size();
+            unsigned begin = 0;
+            unsigned found = 0;
+            for (unsigned i = 0; i < num_threads && begin < sz; i++) {
+                // chunks 0..i contain approximately (i+1)/num_threads of the candidates.
+                unsigned goal = static_cast<unsigned>((static_cast<uint64>(num_candidates) * (i + 1)) / num_threads);
+                unsigned chunk_end = begin;
+                do {
+                    found += m_to_match[chunk_end]->get_candidates().size();
+                    chunk_end++;
+                }
+                while (chunk_end < sz && found < goal);
+                if (i == num_threads - 1)
+                    chunk_end = sz;
+                match_task * t = alloc(match_task, *(m_workers[i]), m_to_match.c_ptr() + begin, chunk_end - begin);
+                tasks.push_back(t);
+                ts.push_back(t);
+                begin = chunk_end;
+            }
+            task_pool::execute(ts.size(), ts.c_ptr());
+            for (unsigned i = 0; i < tasks.size(); i++) {
+                if (tasks[i]->m_failed) {
+                    for (unsigned j = 0; j < tasks.size(); j++)
+                        m_workers[j]->reset_matches();
+                    throw default_exception(tasks[i]->m_msg.c_str());
+                }
+            }
+            for (unsigned i = 0; i < tasks.size(); i++)
+                m_workers[i]->flush_matches(m_context);
+            for (it = m_to_match.begin(); it != end; ++it)
+                (*it)->reset_candidates();
+        }
+
+        virtual void match() { 
+            TRACE("trigger_bug", tout << "match\n"; display(tout););
+            unsigned num_threads = get_num_match_threads();
+            if (num_threads > 1) {
+                match_parallel(num_threads);
+            }
+            else {
+                ptr_vector<code_tree>::iterator it  = m_to_match.begin();
+                ptr_vector<code_tree>::iterator end = m_to_match.end();
+                for (; it != end; ++it) {
+                    code_tree * t = *it;
+                    SASSERT(t->has_candidates());
+                    m_interpreter.execute(t);
+                    t->reset_candidates();
+                }
             }
             m_to_match.reset();
             if (!m_new_patterns.empty()) {
@@ -24,6 +24,9 @@ void preprocessor_params::updt_local_params(params_ref const & _p) {
     m_macro_finder            = p.macro_finder();
     m_pull_nested_quantifiers = p.pull_nested_quantifiers();
     m_refine_inj_axiom        = p.refine_inj_axioms();
+    m_bb_circuit_cache        = p.bv_circuit_cache();
+    m_bb_mul_encoding         = static_cast<bb_mul_encoding>(std::min(p.bv_mul_encoding(), static_cast<unsigned>(BB_MUL_KARATSUBA)));
+    m_bb_div_encoding         = static_cast<bb_div_encoding>(std::min(p.bv_div_encoding(), static_cast<unsigned>(BB_DIV_NON_RESTORING)));
 }
 
 void preprocessor_params::updt_params(params_ref const & p) {
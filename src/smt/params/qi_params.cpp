@@ -35,4 +35,7 @@ void qi_params::updt_params(params_ref const & _p) {
     m_qi_lazy_threshold = p.qi_lazy_threshold();
     m_qi_cost = p.qi_cost();
     m_qi_max_eager_multipatterns = p.qi_max_multi_patterns();
+    m_qi_parallel_matching = p.qi_parallel_matching();
+    m_qi_stats = p.qi_stats();
+    m_qi_stats_sample = p.qi_stats_sample();
 }
@@ -44,6 +44,9 @@ struct qi_params {
     unsigned           m_qi_max_instances;
     bool               m_qi_lazy_instantiation;
     bool               m_qi_conservative_final_check;
+    bool               m_qi_parallel_matching;
+    bool               m_qi_stats;
+    unsigned           m_qi_stats_sample;
 
     bool               m_mbqi;
     unsigned           m_mbqi_max_cexs;
@@ -93,6 +96,9 @@ struct qi_params {
         m_qi_max_instances(UINT_MAX),
         m_qi_lazy_instantiation(false),
         m_qi_conservative_final_check(false),
+        m_qi_parallel_matching(false),
+        m_qi_stats(false),
+        m_qi_stats_sample(1),
         m_mbqi(true), // enabled by default
         m_mbqi_max_cexs(1),
         m_mbqi_max_cexs_incr(1),
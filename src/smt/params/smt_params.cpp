@@ -33,6 +33,9 @@ void smt_params::updt_local_params(params_ref const & _p) {
     m_case_split_strategy = static_cast<case_split_strategy>(p.case_split());
     m_delay_units = p.delay_units();
     m_delay_units_threshold = p.delay_units_threshold();
+    m_lemma_gc_glue = p.lemma_gc_glue();
+    m_lemma_gc_core_glue = p.lemma_gc_core_glue();
+    m_lemma_gc_tier2_glue = p.lemma_gc_tier2_glue();
     m_preprocess = _p.get_bool("preprocess", true); // hidden parameter
     m_timeout = p.timeout();
     model_params mp(_p);
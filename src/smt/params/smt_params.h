@@ -145,6 +145,9 @@ struct smt_params : public preprocessor_params,
     unsigned          m_recent_lemmas_size;
     unsigned          m_lemma_gc_initial;
     double            m_lemma_gc_factor;
+    bool              m_lemma_gc_glue;        //!< select the lemmas to be deleted using their glue (LBD) instead of their activity.
+    unsigned          m_lemma_gc_core_glue;   //!< lemmas with glue <= m_lemma_gc_core_glue are never deleted.
+    unsigned          m_lemma_gc_tier2_glue;  //!< lemmas with glue <= m_lemma_gc_tier2_glue are kept while they are used in conflicts.
     unsigned          m_new_old_ratio;     //!< the ratio of new and old clauses.
     unsigned          m_new_clause_activity;  
     unsigned          m_old_clause_activity;
@@ -249,6 +252,9 @@ struct smt_params : public preprocessor_params,
         m_recent_lemmas_size(100),
         m_lemma_gc_initial(5000),
         m_lemma_gc_factor(1.1),
+        m_lemma_gc_glue(false),
+        m_lemma_gc_core_glue(2),
+        m_lemma_gc_tier2_glue(6),
         m_new_old_ratio(16),
         m_new_clause_activity(10),
         m_old_clause_activity(500),
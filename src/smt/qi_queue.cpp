@@ -37,6 +37,7 @@ namespace smt {
         m_parser(m_manager),
         m_evaluator(m_manager),
         m_subst(m_manager),
+        m_stats_sample_counter(0),
         m_instances(m_manager) {
         init_parser_vars();
         m_vals.resize(15, 0.0f);
@@ -62,6 +63,8 @@ namespace smt {
             warning_msg("invalid new_gen function '%s', switching to default one", m_params.m_qi_new_gen.c_str());
             VERIFY(m_parser.parse_string("cost", m_new_gen_function));
         }
+        m_evaluator.compile(m_cost_function, m_vals.size(), m_cost_program);
+        m_evaluator.compile(m_new_gen_function, m_vals.size(), m_new_gen_program);
         m_eager_cost_threshold = m_params.m_qi_eager_threshold;
     }
 
@@ -121,7 +124,7 @@ namespace smt {
     
     float qi_queue::get_cost(quantifier * q, app * pat, unsigned generation, unsigned min_top_generation, unsigned max_top_generation) {
         quantifier_stat * stat = set_values(q, pat, generation, min_top_generation, max_top_generation, 0);
-        float r = m_evaluator(m_cost_function, m_vals.size(), m_vals.c_ptr());
+        float r = m_cost_program(m_vals.size(), m_vals.c_ptr());
         stat->update_max_cost(r);
         return r;
     }
@@ -129,7 +132,7 @@ namespace smt {
     unsigned qi_queue::get_new_gen(quantifier * q, unsigned generation, float cost) {
         // max_top_generation and min_top_generation are not available for computing inc_gen
         set_values(q, 0, generation, 0, 0, cost);
-        float r = m_evaluator(m_new_gen_function, m_vals.size(), m_vals.c_ptr());
+        float r = m_new_gen_program(m_vals.size(), m_vals.c_ptr());
         return static_cast<unsigned>(r);
     }
     
@@ -144,9 +147,21 @@ namespace smt {
               }
               tout << "\n";);
         TRACE("new_entries_bug", tout << "[qi:insert]\n";);
+        if (m_params.m_qi_stats)
+            update_cost_histogram(cost);
         m_new_entries.push_back(entry(f, cost, generation));
     }
 
+    void qi_queue::update_cost_histogram(float cost) {
+        unsigned i     = 0;
+        float    bound = 1.0f;
+        while (i < QI_NUM_COST_BUCKETS - 1 && cost >= bound) {
+            i++;
+            bound *= 2.0f;
+        }
+        m_stats.m_cost_histogram[i]++;
+    }
+
     void qi_queue::instantiate() {
         svector<entry>::iterator it               = m_new_entries.begin();
         svector<entry>::iterator end              = m_new_entries.end();
@@ -291,7 +306,14 @@ namespace smt {
         m_stats.m_num_instances++;
         unsigned gen = get_new_gen(q, generation, ent.m_cost);
         display_instance_profile(f, q, num_bindings, bindings, proof_id, gen);
+        bool track_conflicts = m_params.m_qi_stats && ++m_stats_sample_counter >= m_params.m_qi_stats_sample;
+        if (track_conflicts) {
+            m_stats_sample_counter = 0;
+            m_context.set_instance_quantifier(q);
+        }
         m_context.internalize_instance(lemma, pr1, gen);
+        if (track_conflicts)
+            m_context.set_instance_quantifier(0);
         TRACE_CODE({
             static unsigned num_useless = 0;
             if (m_manager.is_or(lemma)) {
@@ -480,6 +502,14 @@ namespace smt {
         get_min_max_costs(min, max);
         st.update("min missed qa cost", min);
         st.update("max missed qa cost", max);
+        if (m_params.m_qi_stats) {
+            static char const * bucket_names[QI_NUM_COST_BUCKETS] = {
+                "qi cost 0-1", "qi cost 1-2", "qi cost 2-4", "qi cost 4-8", "qi cost 8-16",
+                "qi cost 16-32", "qi cost 32-64", "qi cost 64-128", "qi cost 128+"
+            };
+            for (unsigned i = 0; i < QI_NUM_COST_BUCKETS; i++)
+                st.update(bucket_names[i], m_stats.m_cost_histogram[i]);
+        }
 #if 0
         if (m_params.m_qi_profile) {
             out << "missed/delayed quantifier instances:\n";
@@ -33,8 +33,12 @@ Revision History:
 namespace smt {
     class context;
 
+    // Number of buckets of the cost histogram of qi_queue_stats: cost < 1, 1 <= cost < 2, 2 <= cost < 4, ..., 128 <= cost.
+    const unsigned QI_NUM_COST_BUCKETS = 9;
+
     struct qi_queue_stats {
         unsigned m_num_instances, m_num_lazy_instances;
+        unsigned m_cost_histogram[QI_NUM_COST_BUCKETS]; // only updated if qi.stats is true
         void reset() { memset(this, 0, sizeof(qi_queue_stats)); }
         qi_queue_stats() { reset(); }
     };
@@ -50,9 +54,12 @@ namespace smt {
         expr_ref                      m_new_gen_function;
         cost_parser                   m_parser;
         cost_evaluator                m_evaluator;
+        cost_program                  m_cost_program;
+        cost_program                  m_new_gen_program;
         cached_var_subst              m_subst;
         svector<float>                m_vals;
         double                        m_eager_cost_threshold;
+        unsigned                      m_stats_sample_counter;
         struct entry {
             fingerprint * m_qb;
             float         m_cost;
@@ -77,6 +84,7 @@ namespace smt {
         unsigned get_new_gen(quantifier * q, unsigned generation, float cost);
         void instantiate(entry & ent);
         void get_min_max_costs(float & min, float & max) const;
+        void update_cost_histogram(float cost);
         void display_instance_profile(fingerprint * f, quantifier * q, unsigned num_bindings, enode * const * bindings, unsigned proof_id, unsigned generation);
 
     public:
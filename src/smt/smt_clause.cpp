@@ -41,10 +41,14 @@ namespace smt {
         cls->m_has_del_eh          = del_eh != 0;
         cls->m_has_justification   = js != 0;
         cls->m_deleted             = false;
+        cls->m_used                = false;
         SASSERT(!m.proofs_enabled() || js != 0);
         memcpy(cls->m_lits, lits, sizeof(literal) * num_lits);
-        if (cls->is_lemma())
+        if (cls->is_lemma()) {
             cls->set_activity(1);
+            // the number of literals is an upper bound for the glue
+            cls->set_glue(num_lits);
+        }
         if (del_eh)
             *(const_cast<clause_del_eh **>(cls->get_del_eh_addr())) = del_eh;
         if (js)
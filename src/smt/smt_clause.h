@@ -50,7 +50,9 @@ namespace smt {
        A clause has several optional fields, I store space for them only if they are actually used.
     */
     class clause {
-        unsigned m_num_literals;
+        unsigned m_num_literals:24;       //!< at most m_capacity
+        unsigned m_glue:7;                //!< glue of a lemma, saturated at 127
+        unsigned m_used:1;                //!< true if the lemma was used in conflict resolution since the last lemma GC
         unsigned m_capacity:24;           //!< some of the clause literals can be simplified and removed, this field contains the original number of literals (used for GC).
         unsigned m_kind:2;                //!< kind
         unsigned m_reinit:1;              //!< true if the clause is in the reinit stack (only for learned clauses and aux_lemmas)
@@ -210,6 +212,33 @@ namespace smt {
             *(get_activity_addr()) = act;
         }
 
+        /**
+           \brief Return the glue (LBD) of a lemma, i.e., the smallest number of distinct
+           decision levels observed among its literals when it was learned or used in a conflict.
+        */
+        unsigned get_glue() const {
+            SASSERT(is_lemma());
+            return m_glue;
+        }
+
+        void set_glue(unsigned glue) {
+            SASSERT(is_lemma());
+            m_glue = glue > 127 ? 127 : glue;
+        }
+
+        /**
+           \brief Return true if the lemma was used in conflict resolution since the last lemma GC.
+        */
+        bool is_used() const {
+            SASSERT(is_lemma());
+            return m_used;
+        }
+
+        void set_used(bool used) {
+            SASSERT(is_lemma());
+            m_used = used;
+        }
+
         clause_del_eh * get_del_eh() const {
             return m_has_del_eh ? *(get_del_eh_addr()) : 0;
         }
@@ -30,6 +30,7 @@ Revision History:
 #include"smt_for_each_relevant_expr.h"
 #include"timeit.h"
 #include"well_sorted.h"
+#include"ast_translation.h"
 #include"union_find.h"
 #include"smt_model_generator.h"
 #include"smt_model_checker.h"
@@ -80,9 +81,11 @@ namespace smt {
         m_base_lvl(0),
         m_search_lvl(0),
         m_generation(0),
+        m_instance_qa(0),
         m_last_search_result(l_undef),
         m_last_search_failure(UNKNOWN),
-        m_searching(false) {
+        m_searching(false),
+        m_glue_stamp(0) {
 
         SASSERT(m_scope_lvl == 0);
         SASSERT(m_base_lvl == 0);
@@ -130,6 +133,115 @@ namespace smt {
         return new_ctx;
     }
 
+    template<typename T>
+    static T * translate_ast(ast_translation * tr, T * n) {
+        return (tr == 0 || n == 0) ? n : (*tr)(n);
+    }
+
+    void context::copy(context & src, context & dst, unsigned max_lemma_size) {
+        ast_manager & src_m = src.get_manager();
+        ast_manager & dst_m = dst.get_manager();
+        if (dst.get_num_asserted_formulas() != 0 || dst.m_setup.already_configured())
+            throw default_exception("the target of a context copy must be a fresh context");
+        src.pop_to_base_lvl();
+        scoped_ptr<ast_translation> tr;
+        if (&src_m != &dst_m)
+            tr = alloc(ast_translation, src_m, dst_m);
+        dst.set_logic(src.m_setup.get_logic());
+
+        asserted_formulas & src_af = src.m_asserted_formulas;
+        unsigned qhead = src.m_setup.already_configured() ? src_af.get_qhead() : 0;
+        if (qhead > 0) {
+            // the formulas [0, qhead) were preprocessed and internalized by src.
+            expr_ref_vector  fmls(dst_m);
+            proof_ref_vector prs(dst_m);
+            for (unsigned i = 0; i < qhead; i++) {
+                fmls.push_back(translate_ast(tr.get(), src_af.get_formula(i)));
+                prs.push_back(translate_ast(tr.get(), src_af.get_formula_proof(i)));
+            }
+            unsigned num_macros = src_af.get_num_macros();
+            for (unsigned i = 0; i < num_macros; i++) {
+                func_decl * f = src_af.get_macro_func_decl(i);
+                dst.insert_macro(translate_ast(tr.get(), f),
+                                 translate_ast(tr.get(), src_af.get_macro_quantifier(f)),
+                                 translate_ast(tr.get(), src_af.get_macro_proof(f)));
+            }
+            dst.m_asserted_formulas.init(fmls.size(), fmls.c_ptr(), prs.c_ptr());
+            dst.setup_context(dst.m_fparams.m_auto_config);
+            for (unsigned i = 0; i < qhead && !dst.inconsistent(); i++)
+                dst.internalize_assertion(fmls.get(i), prs.get(i), 0);
+            dst.m_asserted_formulas.commit();
+        }
+        for (unsigned i = qhead; i < src_af.get_num_formulas(); i++) {
+            expr * f   = translate_ast(tr.get(), src_af.get_formula(i));
+            proof * pr = translate_ast(tr.get(), src_af.get_formula_proof(i));
+            if (pr == 0)
+                dst.assert_expr(f);
+            else
+                dst.assert_expr(f, pr);
+        }
+        if (qhead == 0 || src_m.proofs_enabled() || dst.inconsistent())
+            return;
+
+        // base level units
+        expr_ref_vector atoms(dst_m);
+        unsigned num_units = src.m_assigned_literals.size();
+        for (unsigned i = 0; i < num_units && !dst.inconsistent(); i++) {
+            literal l = src.m_assigned_literals[i];
+            if (l.var() == true_bool_var)
+                continue;
+            expr * atom = translate_ast(tr.get(), src.bool_var2expr(l.var()));
+            atoms.push_back(atom);
+            dst.internalize(atom, true);
+            literal new_l = dst.get_literal(atom);
+            if (l.sign())
+                new_l = ~new_l;
+            if (new_l == false_literal) {
+                dst.set_conflict(b_justification::mk_axiom());
+                return;
+            }
+            dst.assign(new_l, b_justification::mk_axiom());
+            if (src.is_relevant(l))
+                dst.mark_as_relevant(new_l);
+        }
+
+        // short learned clauses
+        literal_buffer lits;
+        clause_vector::iterator it  = src.m_lemmas.begin();
+        clause_vector::iterator end = src.m_lemmas.end();
+        for (; it != end && !dst.inconsistent(); ++it) {
+            clause * cls = *it;
+            unsigned num_lits = cls->get_num_literals();
+            if (num_lits > max_lemma_size)
+                continue;
+            lits.reset();
+            for (unsigned j = 0; j < num_lits; j++) {
+                literal l   = cls->get_literal(j);
+                expr * atom = translate_ast(tr.get(), src.bool_var2expr(l.var()));
+                atoms.push_back(atom);
+                dst.internalize(atom, true);
+                literal new_l = dst.get_literal(atom);
+                lits.push_back(l.sign() ? ~new_l : new_l);
+            }
+            dst.mk_clause(lits.size(), lits.c_ptr(), 0, CLS_AUX_LEMMA);
+        }
+
+        // activity and phase of the boolean variables known to dst
+        unsigned num_vars = src.get_num_bool_vars();
+        for (bool_var v = 0; v < static_cast<bool_var>(num_vars); v++) {
+            expr * atom = translate_ast(tr.get(), src.bool_var2expr(v));
+            atoms.push_back(atom);
+            if (!dst.b_internalized(atom))
+                continue;
+            bool_var new_v = dst.get_bool_var(atom);
+            dst.m_activity[new_v] = src.m_activity[v];
+            dst.m_case_split_queue->activity_increased_eh(new_v);
+            bool_var_data const & d = src.get_bdata(v);
+            if (d.m_phase_available)
+                dst.force_phase(new_v, d.m_phase);
+        }
+    }
+
     void context::init() {
         app * t       = m_manager.mk_true();
         mk_bool_var(t);
@@ -2532,7 +2644,9 @@ namespace smt {
        \brief Delete low activity lemmas
     */
     inline void context::del_inactive_lemmas() {
-        if (m_fparams.m_lemma_gc_half)
+        if (m_fparams.m_lemma_gc_glue)
+            del_inactive_lemmas3();
+        else if (m_fparams.m_lemma_gc_half)
             del_inactive_lemmas1();
         else
             del_inactive_lemmas2();
@@ -2648,6 +2762,128 @@ namespace smt {
         IF_VERBOSE(2, verbose_stream() << " :num-deleted-clauses " << num_del_cls << ")" << std::endl;);
     }
 
+    /**
+       \brief Return the number of distinct scope levels of the given (assigned) literals.
+    */
+    unsigned context::get_glue(unsigned num_lits, literal const * lits) {
+        m_glue_stamp++;
+        if (m_glue_stamp == 0) {
+            m_glue_marks.reset();
+            m_glue_stamp = 1;
+        }
+        unsigned glue = 0;
+        for (unsigned i = 0; i < num_lits; i++) {
+            unsigned lvl = get_assign_level(lits[i]);
+            if (lvl >= m_glue_marks.size())
+                m_glue_marks.resize(lvl + 1, 0);
+            if (m_glue_marks[lvl] != m_glue_stamp) {
+                m_glue_marks[lvl] = m_glue_stamp;
+                glue++;
+            }
+        }
+        return glue;
+    }
+
+    /**
+       \brief Mark the lemma as used, and update its glue. 
+       It must be invoked when all literals of the lemma are assigned.
+    */
+    void context::update_lemma_glue(clause * cls) {
+        SASSERT(cls->is_lemma());
+        cls->set_used(true);
+        if (cls->get_glue() <= m_fparams.m_lemma_gc_core_glue)
+            return;
+        unsigned glue = get_glue(cls->get_num_literals(), cls->begin_literals());
+        if (glue < cls->get_glue())
+            cls->set_glue(glue);
+    }
+
+    struct clause_glue_lt {
+        bool operator()(clause * cls1, clause * cls2) const { 
+            if (cls1->get_glue() != cls2->get_glue())
+                return cls1->get_glue() < cls2->get_glue();
+            return cls1->get_activity() > cls2->get_activity(); 
+        }
+    };
+
+    /**
+       \brief Glue based version of del_inactive_lemmas. The lemmas are divided in three tiers:
+       core lemmas (glue <= m_lemma_gc_core_glue) are never deleted, tier2 lemmas 
+       (glue <= m_lemma_gc_tier2_glue) are kept if they were used in a conflict since the 
+       last garbage collection, and (approx.) half of the remaining lemmas are deleted. 
+       The glue and then the activity are used to decide which ones. The m_recent_lemmas_size 
+       most recent lemmas are always kept.
+    */
+    void context::del_inactive_lemmas3() {
+        unsigned sz            = m_lemmas.size();
+        unsigned start_at      = m_base_lvl == 0 ? 0 : m_base_scopes[m_base_lvl - 1].m_lemmas_lim;
+        SASSERT(start_at <= sz);
+        if (start_at + m_fparams.m_recent_lemmas_size >= sz)
+            return;
+        IF_VERBOSE(2, verbose_stream() << "(smt.delete-inactive-lemmas"; verbose_stream().flush(););
+        unsigned end_at        = sz - m_fparams.m_recent_lemmas_size;
+        unsigned num_del_cls   = 0;
+        unsigned num_tier2     = 0;
+        unsigned num_core      = 0;
+        ptr_buffer<clause> local;
+        unsigned i             = start_at;
+        unsigned j             = i;
+        for (; i < end_at; i++) {
+            clause * cls = m_lemmas[i];
+            if (can_delete(cls)) {
+                if (cls->deleted()) {
+                    del_clause(cls);
+                    num_del_cls++;
+                    continue;
+                }
+                unsigned glue = cls->get_glue();
+                if (glue > m_fparams.m_lemma_gc_tier2_glue || 
+                    (glue > m_fparams.m_lemma_gc_core_glue && !cls->is_used())) {
+                    local.push_back(cls);
+                    continue;
+                }
+                if (glue <= m_fparams.m_lemma_gc_core_glue)
+                    num_core++;
+                else
+                    num_tier2++;
+            }
+            cls->set_used(false);
+            m_lemmas[j] = cls;
+            j++;
+        }
+        std::stable_sort(local.begin(), local.end(), clause_glue_lt());
+        unsigned num_kept = local.size() / 2;
+        for (unsigned k = 0; k < local.size(); k++) {
+            clause * cls = local[k];
+            if (k < num_kept) {
+                cls->set_used(false);
+                m_lemmas[j] = cls;
+                j++;
+            }
+            else {
+                TRACE("del_inactive_lemmas", tout << "deleting: "; display_clause(tout, cls); 
+                      tout << ", glue: " << cls->get_glue() << ", activity: " << cls->get_activity() << "\n";);
+                del_clause(cls);
+                num_del_cls++;
+            }
+        }
+        // keep recent clauses
+        for (; i < sz; i++) {
+            clause * cls = m_lemmas[i];
+            if (cls->deleted() && can_delete(cls)) {
+                del_clause(cls);
+                num_del_cls++;
+            }
+            else {
+                m_lemmas[j] = cls;
+                j++;
+            }
+        }
+        m_lemmas.shrink(j);
+        IF_VERBOSE(2, verbose_stream() << " :num-deleted-clauses " << num_del_cls << " :core " << num_core 
+                   << " :tier2 " << num_tier2 << ")" << std::endl;);
+    }
+
     /**
        \brief Return true if "cls" has more than (or equal to) k unassigned literals.
     */
@@ -3474,6 +3710,14 @@ namespace smt {
         }
     }
 
+    void context::update_qi_conflict_stats(bool_var v) {
+        if (static_cast<unsigned>(v) >= m_bool_var2qa.size())
+            return;
+        quantifier * q = m_bool_var2qa[v];
+        if (q != 0)
+            m_qmanager->get_stat(q)->inc_num_conflicts(m_stats.m_num_conflicts);
+    }
+
     bool context::resolve_conflict() {
         m_stats.m_num_conflicts++;
         m_num_conflicts ++;
@@ -3501,6 +3745,8 @@ namespace smt {
             SASSERT(num_lits > 0);
             unsigned conflict_lvl = get_assign_level(lits[0]);
             SASSERT(conflict_lvl <= m_scope_lvl);
+            // the literals of the lemma are still assigned.
+            unsigned glue         = m_fparams.m_lemma_gc_glue ? get_glue(num_lits, lits) : 0;
 
             // When num_lits == 1, then the default behavior is to go 
             // to base-level. If the problem has quantifiers, it may be
@@ -3648,7 +3894,9 @@ namespace smt {
                 }
             }
 #endif
-            mk_clause(num_lits, lits, js, CLS_LEARNED);
+            clause * cls = mk_clause(num_lits, lits, js, CLS_LEARNED);
+            if (cls && m_fparams.m_lemma_gc_glue)
+                cls->set_glue(glue);
             if (delay_forced_restart) {
                 SASSERT(num_lits == 1);
                 expr * unit     = bool_var2expr(lits[0].var());
@@ -656,6 +656,8 @@ namespace smt {
 
     protected:
         unsigned m_generation; //!< temporary variable used during internalization
+        quantifier * m_instance_qa; //!< quantifier of the instance being internalized (only set when qi.stats is enabled)
+        ptr_vector<quantifier> m_bool_var2qa; //!< bool_var -> quantifier whose instance created it (see m_instance_qa)
 
     public:
         bool binary_clause_opt_enabled() const {
@@ -836,6 +838,8 @@ namespace smt {
         unsigned           m_luby_idx; 
         double             m_agility;
         unsigned           m_lemma_gc_threshold;
+        unsigned_vector    m_glue_marks; //!< scope level -> last m_glue_stamp where a literal of this level was seen.
+        unsigned           m_glue_stamp;
         
         void assign_core(literal l, b_justification j, bool decision = false);
         void trace_assign(literal l, b_justification j, bool decision) const;
@@ -894,6 +898,14 @@ namespace smt {
 
         void set_global_generation(unsigned generation) { m_generation = generation; }
 
+        /**
+           \brief Boolean variables created while q is set are attributed to q, and
+           update its conflict statistics when they are used in a conflict.
+        */
+        void set_instance_quantifier(quantifier * q) { m_instance_qa = q; }
+
+        void update_qi_conflict_stats(bool_var v);
+
 #ifdef Z3DEBUG
         bool slow_contains_instance(quantifier const * q, unsigned num_bindings, enode * const * bindings) const {
             return m_fingerprints.slow_contains(q, q->get_id(), num_bindings, bindings);
@@ -975,6 +987,17 @@ namespace smt {
     protected:
         bool decide();
 
+        // -----------------------------------
+        //
+        // Lookahead (smt_lookahead.cpp)
+        //
+        // -----------------------------------
+        unsigned lookahead(literal l);
+
+        bool select_cube_literal(literal_vector & path, literal & result);
+
+        void cube_core(unsigned depth, literal_vector & path, expr_ref_vector & cubes, bool & valid);
+
         void update_phase_cache_counter();
 
 #define ACTIVITY_LIMIT 1e100
@@ -991,6 +1014,10 @@ namespace smt {
             m_case_split_queue->activity_increased_eh(v);
         }
 
+        unsigned get_glue(unsigned num_lits, literal const * lits);
+
+        void update_lemma_glue(clause * cls);
+
     protected:
 
         void decay_bvar_activity() {
@@ -1028,6 +1055,8 @@ namespace smt {
 
         void del_inactive_lemmas2();
 
+        void del_inactive_lemmas3();
+
         bool more_than_k_unassigned_literals(clause * cls, unsigned k);
 
         void internalize_assertions();
@@ -1332,6 +1361,20 @@ namespace smt {
         */
         context * mk_fresh(symbol const * l = 0,  smt_params * p = 0);
 
+        /**
+           \brief Copy the logical state of src into the fresh context dst. The managers of src and dst may differ.
+
+           The preprocessed assertions and macros of src are inserted in dst without preprocessing them again,
+           and dst is configured using them. If proofs are disabled, the base level units, the learned clauses
+           with at most max_lemma_size literals, and the activity and phase of the boolean variables are also copied.
+           The user scopes of src are not copied: all assertions of src are base level assertions in dst.
+
+           \warning This method calls src.pop_to_base_lvl(), so the current search state of src is lost.
+
+           \pre dst is fresh: it has no assertions and was not configured yet. Otherwise, an exception is thrown.
+        */
+        static void copy(context & src, context & dst, unsigned max_lemma_size = 3);
+
         app * mk_eq_atom(expr * lhs, expr * rhs);
 
         bool set_logic(symbol logic) { return m_setup.set_logic(logic); }
@@ -1351,6 +1394,18 @@ namespace smt {
         lbool check(unsigned num_assumptions = 0, expr * const * assumptions = 0, bool reset_cancel = true);        
         
         lbool setup_and_check(bool reset_cancel = true);
+
+        /**
+           \brief Split the search space into at most 2^depth cubes. A cube is a conjunction of literals.
+
+           The literals are selected by lookahead over the most active boolean variables, and the cubes
+           refuted by propagation are omitted. So the disjunction of the cubes is implied by the assertions,
+           and no cubes are returned if the assertions are found to be inconsistent.
+
+           Return true if no cube was refuted and no failed literal was added to a cube, that is, the
+           disjunction of the cubes is valid.
+        */
+        bool cube(unsigned depth, expr_ref_vector & cubes);
         
         // return 'true' if assertions are inconsistent.
         bool reduce_assertions(); 
@@ -834,6 +834,10 @@ namespace smt {
         m_activity.reserve(v+1);
         m_bool_var2expr.reserve(v+1);
         m_bool_var2expr[v] = n;
+        if (m_instance_qa != 0 || static_cast<unsigned>(v) < m_bool_var2qa.size()) {
+            m_bool_var2qa.reserve(v+1, 0);
+            m_bool_var2qa[v] = m_instance_qa;
+        }
         literal l(v, false);
         literal not_l(v, true);
         unsigned aux = std::max(l.index(), not_l.index()) + 1;
@@ -241,6 +241,10 @@ namespace smt {
         }
     }
 
+    void kernel::copy(kernel & src, kernel & dst, unsigned max_lemma_size) {
+        context::copy(src.m_imp->m_kernel, dst.m_imp->m_kernel, max_lemma_size);
+    }
+
     bool kernel::inconsistent() {
         return m_imp->inconsistent();
     }
@@ -255,6 +259,10 @@ namespace smt {
         return r;
     }
 
+    bool kernel::cube(unsigned depth, expr_ref_vector & cubes) {
+        return m_imp->m_kernel.cube(depth, cubes);
+    }
+
     void kernel::get_model(model_ref & m) const {
         m_imp->get_model(m);
     }
@@ -105,6 +105,13 @@ namespace smt {
         */
         void reset();
 
+        /**
+           \brief Copy the assertions, macros and the learned clauses with at most max_lemma_size literals
+           of src into the empty kernel dst. src is backtracked to its base level.
+           See context::copy.
+        */
+        static void copy(kernel & src, kernel & dst, unsigned max_lemma_size = 3);
+
         /**
            \brief Return true if the set of asserted formulas is known to be inconsistent.
         */
@@ -120,6 +127,11 @@ namespace smt {
         */
         lbool check(unsigned num_assumptions = 0, expr * const * assumptions = 0);
 
+        /**
+           \brief Split the search space into at most 2^depth cubes by lookahead. See context::cube.
+        */
+        bool cube(unsigned depth, expr_ref_vector & cubes);
+
         /**
            \brief Return the model associated with the last check command.
         */
@@ -0,0 +1,155 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    smt_lookahead.cpp
+
+Abstract:
+
+    Lookahead based cubing: the search space of a logical context is
+    split into cubes that can be solved independently.
+
+Author:
+
+Revision History:
+
+--*/
+#include"smt_context.h"
+#include"ast_util.h"
+#include"ast_pp.h"
+
+namespace smt {
+
+    /**
+       \brief Number of boolean variables, the most active ones, that are scored by lookahead.
+    */
+    #define LOOKAHEAD_NUM_CANDIDATES 32
+
+    struct bool_var_act_gt {
+        svector<double> const & m_activity;
+        bool_var_act_gt(svector<double> const & act):m_activity(act) {}
+        bool operator()(bool_var v1, bool_var v2) const {
+            return m_activity[v1] > m_activity[v2] || (m_activity[v1] == m_activity[v2] && v1 < v2);
+        }
+    };
+
+    /**
+       \brief Return the number of literals assigned by propagating l,
+       or UINT_MAX if propagation produces a conflict.
+    */
+    unsigned context::lookahead(literal l) {
+        SASSERT(get_assignment(l) == l_undef);
+        unsigned old_sz = m_assigned_literals.size();
+        push_scope();
+        assign(l, b_justification::mk_axiom(), true);
+        bool ok = propagate();
+        unsigned num_assigned = m_assigned_literals.size() - old_sz;
+        pop_scope(1);
+        return ok ? num_assigned : UINT_MAX;
+    }
+
+    /**
+       \brief Store in result the candidate literal that maximizes the product of the
+       number of propagations of both phases. Failed literals found on the way are
+       falsified and appended to path. Return false if the current cube is refuted.
+       Set result to null_literal if all candidates are assigned.
+    */
+    bool context::select_cube_literal(literal_vector & path, literal & result) {
+        bool found_failed = true;
+        while (found_failed) {
+            found_failed = false;
+            result = null_literal;
+            svector<bool_var> candidates;
+            unsigned num_vars = get_num_bool_vars();
+            for (bool_var v = 0; v < static_cast<bool_var>(num_vars); v++) {
+                if (get_assignment(v) == l_undef && !is_quantifier(m_bool_var2expr[v]))
+                    candidates.push_back(v);
+            }
+            bool_var_act_gt gt(m_activity);
+            std::sort(candidates.begin(), candidates.end(), gt);
+            if (candidates.size() > LOOKAHEAD_NUM_CANDIDATES)
+                candidates.shrink(LOOKAHEAD_NUM_CANDIDATES);
+            unsigned long long best_score = 0;
+            for (unsigned i = 0; i < candidates.size() && !m_cancel_flag; i++) {
+                bool_var v = candidates[i];
+                if (get_assignment(v) != l_undef)
+                    continue;
+                literal l(v, false);
+                unsigned num_pos = lookahead(l);
+                unsigned num_neg = lookahead(~l);
+                if (num_pos == UINT_MAX || num_neg == UINT_MAX) {
+                    if (num_pos == UINT_MAX && num_neg == UINT_MAX)
+                        return false;
+                    literal implied = num_pos == UINT_MAX ? ~l : l;
+                    path.push_back(implied);
+                    assign(implied, b_justification::mk_axiom(), true);
+                    if (!propagate())
+                        return false;
+                    found_failed = true;
+                    break;
+                }
+                unsigned long long score = static_cast<unsigned long long>(num_pos + 1) * static_cast<unsigned long long>(num_neg + 1);
+                if (score > best_score) {
+                    best_score = score;
+                    result     = l;
+                }
+            }
+        }
+        return true;
+    }
+
+    void context::cube_core(unsigned depth, literal_vector & path, expr_ref_vector & cubes, bool & valid) {
+        unsigned old_sz = path.size();
+        literal l       = null_literal;
+        if (depth > 0 && !m_cancel_flag && !select_cube_literal(path, l)) {
+            valid = false;
+            path.shrink(old_sz);
+            return;
+        }
+        if (path.size() != old_sz) {
+            // failed literals were added to the cube.
+            valid = false;
+        }
+        if (l == null_literal) {
+            expr_ref_vector lits(m_manager);
+            for (unsigned i = 0; i < path.size(); i++) {
+                expr_ref e(m_manager);
+                literal2expr(path[i], e);
+                lits.push_back(e);
+            }
+            cubes.push_back(mk_and(m_manager, lits.size(), lits.c_ptr()));
+            path.shrink(old_sz);
+            return;
+        }
+        for (unsigned i = 0; i < 2; i++) {
+            literal curr = i == 0 ? l : ~l;
+            push_scope();
+            path.push_back(curr);
+            assign(curr, b_justification::mk_axiom(), true);
+            if (propagate())
+                cube_core(depth - 1, path, cubes, valid);
+            else
+                valid = false;
+            path.pop_back();
+            pop_scope(1);
+        }
+        path.shrink(old_sz);
+    }
+
+    bool context::cube(unsigned depth, expr_ref_vector & cubes) {
+        pop_to_base_lvl();
+        setup_context(m_fparams.m_auto_config);
+        internalize_assertions();
+        if (inconsistent() || !propagate())
+            return false;
+        literal_vector path;
+        bool valid = true;
+        push_scope();
+        cube_core(depth, path, cubes, valid);
+        pop_scope(1);
+        TRACE("cube", for (unsigned i = 0; i < cubes.size(); i++) tout << mk_pp(cubes.get(i), m_manager) << "\n";);
+        return valid;
+    }
+
+};
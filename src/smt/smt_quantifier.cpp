@@ -23,6 +23,7 @@ Revision History:
 #include"smt_model_checker.h"
 #include"smt_quick_checker.h"
 #include"mam.h"
+#include"obj_pair_hashtable.h"
 #include"qi_queue.h"
 #include"ast_smt2_pp.h"
 
@@ -40,6 +41,8 @@ namespace smt {
         ptr_vector<quantifier>                 m_quantifiers;
         scoped_ptr<quantifier_manager_plugin>  m_plugin;
         unsigned                               m_num_instances;
+        obj_pair_map<quantifier, app, unsigned> m_pattern_matches; // only updated if qi.stats is true
+        unsigned                               m_stats_sample_counter;
         
         imp(quantifier_manager & wrapper, context & ctx, smt_params & p, quantifier_manager_plugin * plugin):
             m_wrapper(wrapper),
@@ -49,6 +52,7 @@ namespace smt {
             m_qstat_gen(ctx.get_manager(), ctx.get_region()),
             m_plugin(plugin) {
             m_num_instances = 0;
+            m_stats_sample_counter = 0;
             m_qi_queue.setup();
         }
 
@@ -90,6 +94,8 @@ namespace smt {
             if (m_params.m_qi_profile) {
                 display_stats(verbose_stream(), q);
             }
+            for (unsigned i = 0; i < q->get_num_patterns(); i++)
+                m_pattern_matches.erase(q, to_app(q->get_pattern(i)));
             m_quantifiers.pop_back();
             m_quantifier_stat.erase(q);
         }
@@ -98,6 +104,43 @@ namespace smt {
             return m_quantifiers.empty();
         }
 
+        /**
+           \brief Return a statistics key of the form "qi <qid> <suffix>".
+           The keys are stored in the symbol table because statistics do not copy them.
+        */
+        static char const * mk_stat_key(quantifier * q, char const * suffix) {
+            std::ostringstream buffer;
+            buffer << "qi " << q->get_qid() << " " << suffix;
+            return symbol(buffer.str().c_str()).bare_str();
+        }
+
+        void collect_statistics(::statistics & st) const {
+            m_qi_queue.collect_statistics(st);
+            if (!m_params.m_qi_stats)
+                return;
+            ptr_vector<quantifier>::const_iterator it  = m_quantifiers.begin();
+            ptr_vector<quantifier>::const_iterator end = m_quantifiers.end();
+            for (; it != end; ++it) {
+                quantifier * q         = *it;
+                quantifier_stat * stat = get_stat(q);
+                if (stat->get_num_matches() == 0)
+                    continue;
+                st.update(mk_stat_key(q, "matches"), stat->get_num_matches());
+                st.update(mk_stat_key(q, "instances"), stat->get_num_instances());
+                st.update(mk_stat_key(q, "max generation"), stat->get_max_generation());
+                st.update(mk_stat_key(q, "max cost"), static_cast<double>(stat->get_max_cost()));
+                st.update(mk_stat_key(q, "conflicts"), stat->get_num_conflicts());
+                for (unsigned i = 0; i < q->get_num_patterns(); i++) {
+                    unsigned num = 0;
+                    if (m_pattern_matches.find(q, to_app(q->get_pattern(i)), num)) {
+                        std::ostringstream suffix;
+                        suffix << "pattern " << i << " matches";
+                        st.update(mk_stat_key(q, suffix.str().c_str()), num);
+                    }
+                }
+            }
+        }
+
         bool is_shared(enode * n) const {
             return m_plugin->is_shared(n); 
         }
@@ -112,7 +155,15 @@ namespace smt {
             max_generation = std::max(max_generation, get_generation(q));
             if (m_num_instances > m_params.m_qi_max_instances)
                 return false;
-            get_stat(q)->update_max_generation(max_generation);
+            quantifier_stat * stat = get_stat(q);
+            stat->inc_num_matches();
+            if (pat != 0 && m_params.m_qi_stats && ++m_stats_sample_counter >= m_params.m_qi_stats_sample) {
+                m_stats_sample_counter = 0;
+                unsigned num = 0;
+                m_pattern_matches.find(q, pat, num);
+                m_pattern_matches.insert(q, pat, num + 1);
+            }
+            stat->update_max_generation(max_generation);
             fingerprint * f = m_context.add_fingerprint(q, q->get_id(), num_bindings, bindings);
             if (f) {
                 if (has_trace_stream()) {
@@ -378,7 +429,7 @@ namespace smt {
     }
 
     void quantifier_manager::collect_statistics(::statistics & st) const {
-        m_imp->m_qi_queue.collect_statistics(st);
+        m_imp->collect_statistics(st);
     }
 
     void quantifier_manager::reset_statistics() {
@@ -30,7 +30,10 @@ namespace smt {
         m_num_instances_curr_search(0),
         m_num_instances_curr_branch(0),
         m_max_generation(0),
-        m_max_cost(0.0f) {
+        m_max_cost(0.0f),
+        m_num_matches(0),
+        m_num_conflicts(0),
+        m_last_conflict(UINT_MAX) {
     }
 
     quantifier_stat_gen::quantifier_stat_gen(ast_manager & m, region & r):
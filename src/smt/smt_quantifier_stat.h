@@ -41,6 +41,9 @@ namespace smt {
         unsigned m_num_instances_curr_branch; //!< only updated if QI_TRACK_INSTANCES is true
         unsigned m_max_generation; //!< max. generation of an instance
         float    m_max_cost;
+        unsigned m_num_matches; //!< number of bindings produced by E-matching and MBQI, including duplicates
+        unsigned m_num_conflicts; //!< number of conflicts using literals created by instances, only updated if qi.stats is true
+        unsigned m_last_conflict; //!< last conflict counted in m_num_conflicts
 
         friend class quantifier_stat_gen;
 
@@ -109,6 +112,28 @@ namespace smt {
         float get_max_cost() const {
             return m_max_cost;
         }
+
+        void inc_num_matches() {
+            m_num_matches++;
+        }
+
+        unsigned get_num_matches() const {
+            return m_num_matches;
+        }
+
+        /**
+           \brief Count the conflict with the given id, if it was not counted yet.
+        */
+        void inc_num_conflicts(unsigned conflict_id) {
+            if (m_last_conflict != conflict_id) {
+                m_last_conflict = conflict_id;
+                m_num_conflicts++;
+            }
+        }
+
+        unsigned get_num_conflicts() const {
+            return m_num_conflicts;
+        }
     };
 
     /**
@@ -71,6 +71,24 @@ namespace smt {
             return m_context.check(num_assumptions, assumptions);
         }
 
+        virtual bool cube(unsigned depth, expr_ref_vector & cubes) {
+            // the cubes are computed under the tracked assumptions.
+            m_context.push();
+            for (unsigned i = 0; i < get_num_assumptions(); i++)
+                m_context.assert_expr(get_assumption(i));
+            bool valid = m_context.cube(depth, cubes);
+            m_context.pop(1);
+            return valid;
+        }
+
+        virtual ::solver * translate(ast_manager & m, params_ref const & p) {
+            solver * result = alloc(solver, m, p, m_logic);
+            smt::kernel::copy(m_context, result->m_context);
+            ast_translation tr(m_context.m(), m);
+            result->copy_assumptions(*this, tr);
+            return result;
+        }
+
         virtual void get_unsat_core(ptr_vector<expr> & r) {
             unsigned sz = m_context.get_unsat_core_size();
             for (unsigned i = 0; i < sz; i++)
@@ -35,6 +35,11 @@ namespace smt {
         theory_var r  = theory::mk_var(n);
         m_find.mk_var();
         m_bits.push_back(literal_vector());
+        m_lazy_blasted.push_back(false);
+        m_word_parents.push_back(vars());
+        m_word_bounds.push_back(svector<bool_var>());
+        m_is_word_term.push_back(false);
+        m_word_in_queue.push_back(false);
         m_wpos.push_back(0);
         m_zero_one_bits.push_back(zero_one_bits());
         get_context().attach_th_var(n, this, r);
@@ -810,11 +815,16 @@ namespace smt {
         if (approximate_term(term)) {
             return false;
         }
+        if (m_params.m_bv_lazy_blast && is_lazy_blast_candidate(term)) {
+            internalize_lazy(term);
+            register_word_term(term);
+            return true;
+        }
         switch (term->get_decl_kind()) {
         case OP_BV_NUM:         internalize_num(term); return true;
-        case OP_BADD:           internalize_add(term); return true;
-        case OP_BMUL:           internalize_mul(term); return true;
-        case OP_BSDIV_I:        internalize_sdiv(term); return true;
+        case OP_BADD:           internalize_add(term); register_word_term(term); return true;
+        case OP_BMUL:           internalize_mul(term); register_word_term(term); return true;
+        case OP_BSDIV_I:        internalize_sdiv(term); register_word_term(term); return true;
         case OP_BUDIV_I:        internalize_udiv(term); return true;
         case OP_BSREM_I:        internalize_srem(term); return true;
         case OP_BUREM_I:        internalize_urem(term); return true;
@@ -833,9 +843,9 @@ namespace smt {
         case OP_BREDOR:         internalize_redor(term); return true;
         case OP_BREDAND:        internalize_redand(term); return true;
         case OP_BCOMP:          internalize_comp(term); return true;
-        case OP_BSHL:           internalize_shl(term); return true;
-        case OP_BLSHR:          internalize_lshr(term); return true;
-        case OP_BASHR:          internalize_ashr(term); return true;
+        case OP_BSHL:           internalize_shl(term); register_word_term(term); return true;
+        case OP_BLSHR:          internalize_lshr(term); register_word_term(term); return true;
+        case OP_BASHR:          internalize_ashr(term); register_word_term(term); return true;
         case OP_ROTATE_LEFT:    internalize_rotate_left(term); return true;
         case OP_ROTATE_RIGHT:   internalize_rotate_right(term); return true;
         case OP_EXT_ROTATE_LEFT:  internalize_ext_rotate_left(term); return true;
@@ -921,6 +931,7 @@ namespace smt {
         le_atom * a     = new (get_region()) le_atom(l, def);
         insert_bv2a(l.var(), a);
         m_trail_stack.push(mk_atom_trail(l.var()));
+        register_word_bound(n, a);
         if (!ctx.relevancy() || !m_params.m_bv_lazy_le) {
             ctx.mk_th_axiom(get_id(),  l, ~def);
             ctx.mk_th_axiom(get_id(), ~l,  def);
@@ -1126,11 +1137,18 @@ namespace smt {
             var_pos_occ * curr = b->m_occs;
             while (curr) {
                 m_prop_queue.push_back(var_pos(curr->m_var, curr->m_idx));
+                if (m_params.m_bv_word_prop)
+                    push_word_parents(curr->m_var);
                 curr = curr->m_next;
             }
             TRACE("bv", tout << m_prop_queue.size() << "\n";);
             propagate_bits();
         }
+        else if (m_params.m_bv_word_prop) {
+            le_atom * le = static_cast<le_atom*>(a);
+            if (le->m_word_var != null_theory_var)
+                push_word_parents(le->m_word_var);
+        }
     }
     
     void theory_bv::propagate_bits() {
@@ -1211,6 +1229,8 @@ namespace smt {
                 // this bit will be propagated to the equivalence class of v2 by assign_bit caller.
                 if (propagate_eqc || find(curr->m_var) != find(v2) || curr->m_idx != idx)
                     m_prop_queue.push_back(var_pos(curr->m_var, curr->m_idx));
+                if (m_params.m_bv_word_prop)
+                    push_word_parents(curr->m_var);
                 curr = curr->m_next;
             }
         }
@@ -1260,9 +1280,17 @@ namespace smt {
     
     void theory_bv::pop_scope_eh(unsigned num_scopes) {
         TRACE("bv",tout << num_scopes << "\n";);
+        for (unsigned i = 0; i < m_word_queue.size(); i++)
+            m_word_in_queue[m_word_queue[i]] = false;
+        m_word_queue.reset();
         m_trail_stack.pop_scope(num_scopes);
         unsigned num_old_vars = get_old_num_vars(num_scopes);
         m_bits.shrink(num_old_vars);
+        m_lazy_blasted.shrink(num_old_vars);
+        m_word_parents.shrink(num_old_vars);
+        m_word_bounds.shrink(num_old_vars);
+        m_is_word_term.shrink(num_old_vars);
+        m_word_in_queue.shrink(num_old_vars);
         m_wpos.shrink(num_old_vars);
         m_zero_one_bits.shrink(num_old_vars);
         theory::pop_scope_eh(num_scopes);
@@ -1270,19 +1298,661 @@ namespace smt {
 
     final_check_status theory_bv::final_check_eh() {
         SASSERT(check_invariant());
+        if (!m_lazy_vars.empty() && !check_lazy_terms()) {
+            return FC_CONTINUE;
+        }
         if (m_approximates_large_bvs) {
             return FC_GIVEUP;
         }
         return FC_DONE;
     }
 
+    // -----------------------------------
+    //
+    // Lazy bit-blasting
+    //
+    // Expensive operators are internalized as uninterpreted functions: the term
+    // gets fresh bits, and congruence closure is the only reasoning performed on it.
+    // In the final check, the value of each relevant lazy term is compared with the
+    // value of the operator applied to the values of its arguments. The circuit of
+    // the terms that violate their semantics is created, and connected to their bits.
+    //
+    // -----------------------------------
+
+    bool theory_bv::is_lazy_blast_candidate(app * n) const {
+        switch (n->get_decl_kind()) {
+        case OP_BMUL: {
+            unsigned num_non_numerals = 0;
+            for (unsigned i = 0; i < n->get_num_args(); i++) {
+                if (!m_util.is_numeral(n->get_arg(i)))
+                    num_non_numerals++;
+            }
+            return num_non_numerals >= 2;
+        }
+        case OP_BUDIV_I:
+        case OP_BSDIV_I:
+        case OP_BUREM_I:
+        case OP_BSREM_I:
+        case OP_BSMOD_I:
+        case OP_BSHL:
+        case OP_BLSHR:
+        case OP_BASHR:
+            return !m_util.is_numeral(n->get_arg(1));
+        default:
+            return false;
+        }
+    }
+
+    void theory_bv::internalize_lazy(app * n) {
+        SASSERT(!get_context().e_internalized(n));
+        process_args(n);
+        enode * e    = mk_enode(n);
+        theory_var v = e->get_th_var(get_id());
+        // the bits of the arguments are needed to evaluate n in the final check.
+        for (unsigned i = 0; i < n->get_num_args(); i++)
+            get_arg_var(e, i);
+        mk_bits(v);
+        m_lazy_vars.push_back(v);
+        m_trail_stack.push(push_back_vector<theory_bv, svector<theory_var> >(m_lazy_vars));
+    }
+
+    class lazy_blast_trail : public trail<theory_bv> {
+        theory_var m_var;
+    public:
+        lazy_blast_trail(theory_var v):m_var(v) {}
+        virtual void undo(theory_bv & th) {
+            th.m_lazy_blasted[m_var] = false;
+        }
+    };
+
+    /**
+       \brief Return true if the bits of v and of its arguments are assigned, and
+       the value of v is the value of the operator applied to the values of the arguments.
+    */
+    bool theory_bv::is_lazy_term_consistent(theory_var v) {
+        ast_manager & m = get_manager();
+        enode * e       = get_enode(v);
+        app * n         = e->get_owner();
+        numeral val;
+        expr_ref_vector args(m);
+        for (unsigned i = 0; i < n->get_num_args(); i++) {
+            theory_var arg = get_arg_var(e, i);
+            if (!get_fixed_value(arg, val))
+                return false;
+            args.push_back(m_util.mk_numeral(val, get_bv_size(arg)));
+        }
+        if (!get_fixed_value(v, val))
+            return false;
+        expr_ref t(m.mk_app(n->get_decl(), args.size(), args.c_ptr()), m);
+        expr_ref r(m);
+        proof_ref pr(m);
+        (*m_simplifier)(t, r, pr);
+        numeral r_val;
+        unsigned sz;
+        // division by zero is not evaluated by the simplifier, the term is just bit-blasted.
+        return m_util.is_numeral(r, r_val, sz) && r_val == val;
+    }
+
+    void theory_bv::blast_lazy_term(theory_var v) {
+        TRACE("bv_lazy", tout << "bit-blasting: " << mk_pp(get_enode(v)->get_owner(), get_manager()) << "\n";);
+        ast_manager & m = get_manager();
+        context & ctx   = get_context();
+        enode * e       = get_enode(v);
+        app * n         = e->get_owner();
+        expr_ref_vector bits(m), arg1_bits(m), arg2_bits(m);
+        if (n->get_decl_kind() == OP_BMUL) {
+            unsigned i = n->get_num_args() - 1;
+            get_arg_bits(e, i, bits);
+            while (i > 0) {
+                --i;
+                arg1_bits.reset();
+                arg2_bits.reset();
+                get_arg_bits(e, i, arg1_bits);
+                m_bb.mk_multiplier(arg1_bits.size(), arg1_bits.c_ptr(), bits.c_ptr(), arg2_bits);
+                bits.swap(arg2_bits);
+            }
+        }
+        else {
+            get_arg_bits(e, 0, arg1_bits);
+            get_arg_bits(e, 1, arg2_bits);
+            SASSERT(arg1_bits.size() == arg2_bits.size());
+            unsigned sz          = arg1_bits.size();
+            expr * const * bits1 = arg1_bits.c_ptr();
+            expr * const * bits2 = arg2_bits.c_ptr();
+            switch (n->get_decl_kind()) {
+            case OP_BUDIV_I: m_bb.mk_udiv(sz, bits1, bits2, bits); break;
+            case OP_BSDIV_I: m_bb.mk_sdiv(sz, bits1, bits2, bits); break;
+            case OP_BUREM_I: m_bb.mk_urem(sz, bits1, bits2, bits); break;
+            case OP_BSREM_I: m_bb.mk_srem(sz, bits1, bits2, bits); break;
+            case OP_BSMOD_I: m_bb.mk_smod(sz, bits1, bits2, bits); break;
+            case OP_BSHL:    m_bb.mk_shl(sz, bits1, bits2, bits); break;
+            case OP_BLSHR:   m_bb.mk_lshr(sz, bits1, bits2, bits); break;
+            case OP_BASHR:   m_bb.mk_ashr(sz, bits1, bits2, bits); break;
+            default:
+                UNREACHABLE();
+            }
+        }
+        SASSERT(bits.size() == m_bits[v].size());
+        for (unsigned i = 0; i < bits.size(); i++) {
+            expr_ref s_bit(m);
+            simplify_bit(bits.get(i), s_bit);
+            ctx.internalize(s_bit, true);
+            literal l = ctx.get_literal(s_bit);
+            literal b = m_bits[v][i];
+            ctx.mark_as_relevant(l);
+            ctx.mk_th_axiom(get_id(), ~b, l);
+            ctx.mk_th_axiom(get_id(), b, ~l);
+        }
+        m_lazy_blasted[v] = true;
+        m_trail_stack.push(lazy_blast_trail(v));
+        m_stats.m_num_lazy_blasts++;
+        // the circuit is lost on backtracking, keep it for good in the next restart.
+        if (!ctx.at_base_level() && e->get_iscope_lvl() <= ctx.get_base_level())
+            m_restart_lazy_vars.push_back(v);
+    }
+
+    /**
+       \brief Bit-blast the relevant lazy terms whose values are not consistent with
+       the current assignment. Return true if there are no such terms.
+    */
+    bool theory_bv::check_lazy_terms() {
+        context & ctx = get_context();
+        bool ok       = true;
+        unsigned sz   = m_lazy_vars.size();
+        for (unsigned i = 0; i < sz; i++) {
+            theory_var v = m_lazy_vars[i];
+            if (m_lazy_blasted[v])
+                continue;
+            if (ctx.relevancy() && !ctx.is_relevant(get_enode(v)))
+                continue;
+            if (is_lazy_term_consistent(v))
+                continue;
+            blast_lazy_term(v);
+            ok = false;
+        }
+        return ok;
+    }
+
+    // -----------------------------------
+    //
+    // Word-level propagation
+    //
+    // The known bits and the unsigned range of the arguments of bvadd, bvmul and
+    // shifts are propagated to the bits of the term. A derived bit is justified by
+    // the assigned bits of the arguments, so the reasoning is also performed for
+    // lazy terms that do not have a circuit. The bits of extract and concat terms
+    // are the bits of their arguments, and do not need a transfer function.
+    //
+    // -----------------------------------
+
+    static void to_bits(rational n, unsigned sz, svector<bool> & bits) {
+        rational two(2);
+        bits.reset();
+        for (unsigned i = 0; i < sz; i++) {
+            bits.push_back(!mod(n, two).is_zero());
+            n = div(n, two);
+        }
+    }
+
+    static void mk_full(unsigned sz, bv_word_value & r) {
+        r.m_bits.reset();
+        r.m_bits.resize(sz, l_undef);
+        r.m_lo.reset();
+        r.m_hi  = rational::power_of_two(sz) - rational(1);
+        r.m_slo = -rational::power_of_two(sz - 1);
+        r.m_shi = rational::power_of_two(sz - 1) - rational(1);
+    }
+
+    static void intersect(rational const & lo, rational const & hi, rational & r_lo, rational & r_hi) {
+        if (lo > r_lo)
+            r_lo = lo;
+        if (hi < r_hi)
+            r_hi = hi;
+    }
+
+    /**
+       \brief Tighten the ranges of w using its known bits and each other, and fix the
+       bits in the common prefix of the unsigned range.
+       The signed range only contributes to the unsigned one when its bounds have the
+       same sign, otherwise its set of unsigned values is not an interval.
+    */
+    static void normalize(bv_word_value & w) {
+        unsigned sz = w.m_bits.size();
+        rational lo, hi, p(1);
+        for (unsigned i = 0; i < sz; i++, p *= rational(2)) {
+            if (w.m_bits[i] == l_true)
+                lo += p;
+            if (w.m_bits[i] != l_false)
+                hi += p;
+        }
+        intersect(lo, hi, w.m_lo, w.m_hi);
+        // the sign bit has weight 2^(sz-1) in the unsigned value, and -2^(sz-1) in the signed one.
+        rational n    = rational::power_of_two(sz);
+        rational half = rational::power_of_two(sz - 1);
+        lbool sign    = w.m_bits[sz - 1];
+        if (sign == l_true)
+            intersect(lo - n, hi - n, w.m_slo, w.m_shi);
+        else if (sign == l_false)
+            intersect(lo, hi, w.m_slo, w.m_shi);
+        else
+            intersect(lo - half, hi - half, w.m_slo, w.m_shi);
+        if (w.m_slo.is_nonneg())
+            intersect(w.m_slo, w.m_shi, w.m_lo, w.m_hi);
+        else if (w.m_shi.is_neg())
+            intersect(w.m_slo + n, w.m_shi + n, w.m_lo, w.m_hi);
+        if (w.m_hi < half)
+            intersect(w.m_lo, w.m_hi, w.m_slo, w.m_shi);
+        else if (w.m_lo >= half)
+            intersect(w.m_lo - n, w.m_hi - n, w.m_slo, w.m_shi);
+        if (w.m_lo > w.m_hi || w.m_slo > w.m_shi)
+            return;
+        svector<bool> lo_bits, hi_bits;
+        to_bits(w.m_lo, sz, lo_bits);
+        to_bits(w.m_hi, sz, hi_bits);
+        for (unsigned i = sz; i-- > 0 && lo_bits[i] == hi_bits[i]; ) {
+            if (w.m_bits[i] == l_undef)
+                w.m_bits[i] = lo_bits[i] ? l_true : l_false;
+        }
+    }
+
+    static lbool xor3(lbool a, lbool b, lbool c) {
+        if (a == l_undef || b == l_undef || c == l_undef)
+            return l_undef;
+        return ((a == l_true) != (b == l_true)) != (c == l_true) ? l_true : l_false;
+    }
+
+    static lbool maj3(lbool a, lbool b, lbool c) {
+        if (a != l_undef && (a == b || a == c))
+            return a;
+        if (b != l_undef && b == c)
+            return b;
+        return l_undef;
+    }
+
+    /**
+       \brief Use [lo, hi] as the signed range of r if it does not overflow.
+    */
+    static void set_signed_range(rational const & lo, rational const & hi, bv_word_value & r) {
+        rational half = rational::power_of_two(r.m_bits.size() - 1);
+        if (lo >= -half && hi < half) {
+            r.m_slo = lo;
+            r.m_shi = hi;
+        }
+    }
+
+    /**
+       \brief Store in [lo, hi] the smallest range containing the four values.
+    */
+    static void mk_hull(rational const & v1, rational const & v2, rational const & v3, rational const & v4, 
+                        rational & lo, rational & hi) {
+        lo = std::min(std::min(v1, v2), std::min(v3, v4));
+        hi = std::max(std::max(v1, v2), std::max(v3, v4));
+    }
+
+    static void word_add(bv_word_value const & a, bv_word_value const & b, bv_word_value & r) {
+        unsigned sz = a.m_bits.size();
+        mk_full(sz, r);
+        lbool c = l_false;
+        for (unsigned i = 0; i < sz; i++) {
+            r.m_bits[i] = xor3(a.m_bits[i], b.m_bits[i], c);
+            c           = maj3(a.m_bits[i], b.m_bits[i], c);
+        }
+        rational n  = rational::power_of_two(sz);
+        rational lo = a.m_lo + b.m_lo;
+        rational hi = a.m_hi + b.m_hi;
+        if (hi < n) {
+            r.m_lo = lo;
+            r.m_hi = hi;
+        }
+        else if (lo >= n) {
+            r.m_lo = lo - n;
+            r.m_hi = hi - n;
+        }
+        set_signed_range(a.m_slo + b.m_slo, a.m_shi + b.m_shi, r);
+        normalize(r);
+    }
+
+    static void word_mul(bv_word_value const & a, bv_word_value const & b, bv_word_value & r) {
+        unsigned sz = a.m_bits.size();
+        mk_full(sz, r);
+        // the k lowest bits of the product only depend on the k lowest bits of the arguments.
+        unsigned k = 0;
+        rational va, vb, p(1);
+        for (; k < sz && a.m_bits[k] != l_undef && b.m_bits[k] != l_undef; k++, p *= rational(2)) {
+            if (a.m_bits[k] == l_true)
+                va += p;
+            if (b.m_bits[k] == l_true)
+                vb += p;
+        }
+        svector<bool> low_bits;
+        to_bits(va * vb, k, low_bits);
+        for (unsigned i = 0; i < k; i++)
+            r.m_bits[i] = low_bits[i] ? l_true : l_false;
+        // the trailing zeros of the arguments add up.
+        unsigned za = 0, zb = 0;
+        while (za < sz && a.m_bits[za] == l_false)
+            za++;
+        while (zb < sz && b.m_bits[zb] == l_false)
+            zb++;
+        for (unsigned i = 0; i < za + zb && i < sz; i++)
+            r.m_bits[i] = l_false;
+        rational hi = a.m_hi * b.m_hi;
+        if (hi < rational::power_of_two(sz)) {
+            r.m_lo = a.m_lo * b.m_lo;
+            r.m_hi = hi;
+        }
+        rational slo, shi;
+        mk_hull(a.m_slo * b.m_slo, a.m_slo * b.m_shi, a.m_shi * b.m_slo, a.m_shi * b.m_shi, slo, shi);
+        set_signed_range(slo, shi, r);
+        normalize(r);
+    }
+
+    /**
+       \brief Signed division rounds towards zero. The quotient is only bounded when the
+       divisor cannot be 0; then it is monotone in each argument, so its extremes are
+       at the corners of the ranges. The only overflow is -2^(sz-1) / -1.
+    */
+    static void word_sdiv(bv_word_value const & a, bv_word_value const & b, bv_word_value & r) {
+        unsigned sz = a.m_bits.size();
+        mk_full(sz, r);
+        if (b.m_slo.is_pos() || b.m_shi.is_neg()) {
+            rational slo, shi;
+            mk_hull(machine_div(a.m_slo, b.m_slo), machine_div(a.m_slo, b.m_shi), 
+                    machine_div(a.m_shi, b.m_slo), machine_div(a.m_shi, b.m_shi), slo, shi);
+            set_signed_range(slo, shi, r);
+        }
+        normalize(r);
+    }
+
+    static void word_shift(decl_kind k, bv_word_value const & a, bv_word_value const & s, bv_word_value & r) {
+        unsigned sz = a.m_bits.size();
+        mk_full(sz, r);
+        rational bv_sz(sz);
+        // the shift amount is at least min_s, and it is known if s is fixed.
+        unsigned min_s = s.m_lo < bv_sz ? s.m_lo.get_unsigned() : sz;
+        bool fixed     = s.m_lo == s.m_hi;
+        switch (k) {
+        case OP_BSHL:
+            for (unsigned i = 0; i < min_s; i++)
+                r.m_bits[i] = l_false;
+            if (fixed) {
+                for (unsigned i = min_s; i < sz; i++)
+                    r.m_bits[i] = a.m_bits[i - min_s];
+            }
+            else if (s.m_hi < bv_sz) {
+                rational hi = a.m_hi * rational::power_of_two(s.m_hi.get_unsigned());
+                if (hi < rational::power_of_two(sz)) {
+                    r.m_lo = a.m_lo * rational::power_of_two(min_s);
+                    r.m_hi = hi;
+                }
+            }
+            break;
+        case OP_BLSHR:
+            for (unsigned i = sz - min_s; i < sz; i++)
+                r.m_bits[i] = l_false;
+            if (fixed) {
+                for (unsigned i = 0; i + min_s < sz; i++)
+                    r.m_bits[i] = a.m_bits[i + min_s];
+            }
+            else {
+                if (s.m_hi < bv_sz)
+                    r.m_lo = div(a.m_lo, rational::power_of_two(s.m_hi.get_unsigned()));
+                r.m_hi = div(a.m_hi, rational::power_of_two(min_s));
+            }
+            break;
+        case OP_BASHR: {
+            lbool sign = a.m_bits[sz - 1];
+            if (fixed) {
+                for (unsigned i = 0; i < sz; i++)
+                    r.m_bits[i] = i + min_s < sz ? a.m_bits[i + min_s] : sign;
+            }
+            else {
+                for (unsigned i = min_s < sz ? sz - 1 - min_s : 0; i < sz; i++)
+                    r.m_bits[i] = sign;
+            }
+            // a >> k is div(a, 2^k), shifts of at least sz - 1 leave only the sign.
+            // The bounds decrease with k for non-negative values, and increase for negative ones.
+            rational p_min = rational::power_of_two(std::min(min_s, sz - 1));
+            rational p_max = rational::power_of_two(s.m_hi < bv_sz ? s.m_hi.get_unsigned() : sz - 1);
+            r.m_slo = std::min(div(a.m_slo, p_min), div(a.m_slo, p_max));
+            r.m_shi = std::max(div(a.m_shi, p_min), div(a.m_shi, p_max));
+            break;
+        }
+        default:
+            UNREACHABLE();
+        }
+        normalize(r);
+    }
+
+    class word_parent_trail : public trail<theory_bv> {
+        theory_var m_var;
+    public:
+        word_parent_trail(theory_var v):m_var(v) {}
+        virtual void undo(theory_bv & th) {
+            th.m_word_parents[m_var].pop_back();
+        }
+    };
+
+    void theory_bv::register_word_term(app * n) {
+        if (!m_params.m_bv_word_prop)
+            return;
+        switch (n->get_decl_kind()) {
+        case OP_BADD:
+        case OP_BMUL:
+        case OP_BSHL:
+        case OP_BLSHR:
+        case OP_BASHR:
+        case OP_BSDIV_I:
+            break;
+        default:
+            return;
+        }
+        enode * e    = get_context().get_enode(n);
+        theory_var v = e->get_th_var(get_id());
+        for (unsigned i = 0; i < n->get_num_args(); i++) {
+            theory_var arg = get_arg_var(e, i);
+            m_word_parents[arg].push_back(v);
+            m_trail_stack.push(word_parent_trail(arg));
+        }
+        m_is_word_term[v] = true;
+        // the arguments may already have assigned bits.
+        push_word_term(v);
+    }
+
+    class word_bound_trail : public trail<theory_bv> {
+        theory_var m_var;
+    public:
+        word_bound_trail(theory_var v):m_var(v) {}
+        virtual void undo(theory_bv & th) {
+            th.m_word_bounds[m_var].pop_back();
+        }
+    };
+
+    /**
+       \brief If n compares a term with a numeral, then the word-level terms that contain
+       the term are scheduled when n is assigned, and its value is bounded by n.
+    */
+    void theory_bv::register_word_bound(app * n, le_atom * a) {
+        if (!m_params.m_bv_word_prop)
+            return;
+        unsigned idx;
+        if (m_util.is_numeral(n->get_arg(1)) && !m_util.is_numeral(n->get_arg(0)))
+            idx = 0;
+        else if (m_util.is_numeral(n->get_arg(0)) && !m_util.is_numeral(n->get_arg(1)))
+            idx = 1;
+        else
+            return;
+        theory_var v    = get_var(get_context().get_enode(n->get_arg(idx)));
+        a->m_word_var   = v;
+        m_word_bounds[v].push_back(a->m_var.var());
+        m_trail_stack.push(word_bound_trail(v));
+    }
+
+    /**
+       \brief Tighten the ranges of r using the assigned comparisons of v with numerals,
+       and add the ones that were used to m_word_lits.
+    */
+    void theory_bv::add_word_bounds(theory_var v, bv_word_value & r) {
+        context & ctx                  = get_context();
+        svector<bool_var> const & atoms = m_word_bounds[v];
+        for (unsigned i = 0; i < atoms.size(); i++) {
+            bool_var b = atoms[i];
+            lbool val  = ctx.get_assignment(b);
+            if (val == l_undef)
+                continue;
+            app * n         = to_app(ctx.bool_var2expr(b));
+            bool is_signed  = n->get_decl_kind() == OP_SLEQ;
+            bool is_left    = m_util.is_numeral(n->get_arg(1));
+            rational c;
+            unsigned sz;
+            VERIFY(m_util.is_numeral(n->get_arg(is_left ? 1 : 0), c, sz));
+            if (is_signed && c >= rational::power_of_two(sz - 1))
+                c -= rational::power_of_two(sz);
+            // v <= c is true, c < v is false, c <= v is true, or v < c is false.
+            bool is_upper   = is_left == (val == l_true);
+            rational bound  = c;
+            if (val == l_false)
+                bound += is_left ? rational(1) : rational(-1);
+            rational & lo   = is_signed ? r.m_slo : r.m_lo;
+            rational & hi   = is_signed ? r.m_shi : r.m_hi;
+            if (is_upper ? bound < hi : bound > lo) {
+                (is_upper ? hi : lo) = bound;
+                m_word_lits.push_back(literal(b, val == l_false));
+            }
+        }
+    }
+
+    void theory_bv::push_word_term(theory_var v) {
+        if (!m_word_in_queue[v]) {
+            m_word_in_queue[v] = true;
+            m_word_queue.push_back(v);
+        }
+    }
+
+    /**
+       \brief A bit of v was assigned. Schedule the word-level terms that contain v,
+       and v itself if it is a word-level term, since its own bits may be in conflict
+       with the value of its arguments.
+    */
+    void theory_bv::push_word_parents(theory_var v) {
+        vars const & parents = m_word_parents[v];
+        for (unsigned i = 0; i < parents.size(); i++)
+            push_word_term(parents[i]);
+        if (m_is_word_term[v])
+            push_word_term(v);
+    }
+
+    /**
+       \brief Store in r the abstract value of the current assignment to the bits of v
+       and to its comparisons with numerals, and add the literals used to m_word_lits.
+    */
+    void theory_bv::get_word_value(theory_var v, bv_word_value & r) {
+        context & ctx                = get_context();
+        literal_vector const & bits = m_bits[v];
+        mk_full(bits.size(), r);
+        for (unsigned i = 0; i < bits.size(); i++) {
+            literal l = bits[i];
+            lbool val = ctx.get_assignment(l);
+            r.m_bits[i] = val;
+            if (val != l_undef && l != true_literal && l != false_literal)
+                m_word_lits.push_back(val == l_true ? l : ~l);
+        }
+        add_word_bounds(v, r);
+        normalize(r);
+    }
+
+    void theory_bv::propagate_word_term(theory_var v) {
+        context & ctx = get_context();
+        enode * e     = get_enode(v);
+        app * n       = e->get_owner();
+        bv_word_value r, arg, tmp;
+        m_word_lits.reset();
+        get_word_value(get_arg_var(e, 0), r);
+        for (unsigned i = 1; i < n->get_num_args(); i++) {
+            get_word_value(get_arg_var(e, i), arg);
+            switch (n->get_decl_kind()) {
+            case OP_BADD: word_add(r, arg, tmp); break;
+            case OP_BMUL: word_mul(r, arg, tmp); break;
+            case OP_BSDIV_I: word_sdiv(r, arg, tmp); break;
+            default:      word_shift(n->get_decl_kind(), r, arg, tmp); break;
+            }
+            r.m_bits.swap(tmp.m_bits);
+            r.m_lo  = tmp.m_lo;
+            r.m_hi  = tmp.m_hi;
+            r.m_slo = tmp.m_slo;
+            r.m_shi = tmp.m_shi;
+        }
+        literal_vector const & bits = m_bits[v];
+        SASSERT(bits.size() == r.m_bits.size());
+        for (unsigned i = 0; i < bits.size(); i++) {
+            if (r.m_bits[i] == l_undef)
+                continue;
+            literal l = r.m_bits[i] == l_true ? bits[i] : ~bits[i];
+            switch (ctx.get_assignment(l)) {
+            case l_true:
+                break;
+            case l_undef:
+                TRACE("bv_word", tout << "v" << v << "[" << i << "] := " << r.m_bits[i] << "\n";);
+                m_stats.m_num_word_props++;
+                ctx.assign(l, ctx.mk_justification(ext_theory_propagation_justification(get_id(), ctx.get_region(), 
+                                                                                        m_word_lits.size(), m_word_lits.c_ptr(), 
+                                                                                        0, 0, l)));
+                break;
+            case l_false:
+                TRACE("bv_word", tout << "conflict at v" << v << "[" << i << "]\n";);
+                m_stats.m_num_word_conflicts++;
+                m_word_lits.push_back(~l);
+                ctx.set_conflict(ctx.mk_justification(ext_theory_conflict_justification(get_id(), ctx.get_region(), 
+                                                                                        m_word_lits.size(), m_word_lits.c_ptr(), 
+                                                                                        0, 0)));
+                return;
+            }
+        }
+    }
+
+    bool theory_bv::can_propagate() {
+        return !m_word_queue.empty();
+    }
+
+    void theory_bv::propagate() {
+        context & ctx = get_context();
+        for (unsigned i = 0; i < m_word_queue.size(); i++) {
+            theory_var v = m_word_queue[i];
+            m_word_in_queue[v] = false;
+            if (!ctx.inconsistent())
+                propagate_word_term(v);
+        }
+        m_word_queue.reset();
+    }
+
     void theory_bv::reset_eh() {
         pop_scope_eh(m_trail_stack.get_num_scopes());
         m_bool_var2atom.reset();
         m_fixed_var_table.reset();
+        m_lazy_vars.reset();
+        m_restart_lazy_vars.reset();
+        m_word_queue.reset();
         theory::reset_eh();
     }
 
+    void theory_bv::init_search_eh() {
+        m_restart_lazy_vars.reset();
+    }
+
+    void theory_bv::restart_eh() {
+        svector<theory_var> tmp(m_restart_lazy_vars);
+        m_restart_lazy_vars.reset();
+        svector<theory_var>::iterator it  = tmp.begin();
+        svector<theory_var>::iterator end = tmp.end();
+        for (; it != end; ++it) {
+            theory_var v = *it;
+            if (v < static_cast<theory_var>(get_num_vars()) && !m_lazy_blasted[v]) {
+                TRACE("bv_lazy", tout << "bit-blasting v" << v << " at the base level\n";);
+                blast_lazy_term(v);
+            }
+        }
+    }
+
     theory_bv::theory_bv(ast_manager & m, theory_bv_params const & params, bit_blaster_params const & bb_params):
         theory(m.mk_family_id("bv")),
         m_params(params),
@@ -1580,6 +2250,10 @@ namespace smt {
         st.update("bv dynamic diseqs", m_stats.m_num_diseq_dynamic);
         st.update("bv bit2core", m_stats.m_num_bit2core);
         st.update("bv->core eq", m_stats.m_num_th2core_eq);
+        st.update("bv lazy blasts", m_stats.m_num_lazy_blasts);
+        st.update("bv word propagations", m_stats.m_num_word_props);
+        st.update("bv word conflicts", m_stats.m_num_word_conflicts);
+        m_bb.collect_statistics(st);
     }
 
 #ifdef Z3DEBUG
@@ -34,10 +34,23 @@ namespace smt {
     
     struct theory_bv_stats {
         unsigned   m_num_diseq_static, m_num_diseq_dynamic, m_num_bit2core, m_num_th2core_eq, m_num_conflicts;
+        unsigned   m_num_lazy_blasts, m_num_word_props, m_num_word_conflicts;
         void reset() { memset(this, 0, sizeof(theory_bv_stats)); }
         theory_bv_stats() { reset(); }
     };
 
+    /**
+       \brief Abstract value of a bit-vector used by the word-level propagator:
+       the known bits, an unsigned range [m_lo, m_hi], and a signed range [m_slo, m_shi].
+    */
+    struct bv_word_value {
+        svector<lbool>  m_bits;
+        rational        m_lo;
+        rational        m_hi;
+        rational        m_slo;
+        rational        m_shi;
+    };
+
     class theory_bv : public theory {
         typedef rational numeral;
         typedef trail_stack<theory_bv> th_trail_stack;
@@ -67,7 +80,8 @@ namespace smt {
         struct le_atom : public atom {
             literal    m_var;
             literal    m_def;
-            le_atom(literal v, literal d):m_var(v), m_def(d) {}
+            theory_var m_word_var; // argument compared with a numeral, used by the word-level propagator.
+            le_atom(literal v, literal d):m_var(v), m_def(d), m_word_var(null_theory_var) {}
             virtual ~le_atom() {}
             virtual bool is_bit() const { return false; }
         };
@@ -129,6 +143,17 @@ namespace smt {
         literal_vector           m_tmp_literals;
         svector<var_pos>         m_prop_queue;
         bool                     m_approximates_large_bvs;
+        // lazy bit-blasting (m_bv_lazy_blast)
+        svector<theory_var>      m_lazy_vars;    // variables of the terms that are only bit-blasted on demand.
+        svector<bool>            m_lazy_blasted; // per var, true if the lazy term was already bit-blasted.
+        svector<theory_var>      m_restart_lazy_vars; // lazy terms to be bit-blasted at the base level in the next restart.
+        // word-level propagation (m_bv_word_prop)
+        vector<vars>             m_word_parents;  // per var, the word-level terms that contain it as an argument.
+        vector<svector<bool_var> > m_word_bounds; // per var, the comparisons with a numeral that bound its value.
+        svector<bool>            m_is_word_term;  // per var, true if the word-level propagator handles its term.
+        svector<bool>            m_word_in_queue; // per var, true if it is in m_word_queue.
+        svector<theory_var>      m_word_queue;    // word-level terms whose arguments have new assigned bits.
+        literal_vector           m_word_lits;     // antecedents of the current word-level propagation.
 
         theory_var find(theory_var v) const { return m_find.find(v); }
         theory_var next(theory_var v) const { return m_find.next(v); }
@@ -205,6 +230,23 @@ namespace smt {
 
         bool approximate_term(app* n);
 
+        bool is_lazy_blast_candidate(app * n) const;
+        void internalize_lazy(app * n);
+        bool is_lazy_term_consistent(theory_var v);
+        void blast_lazy_term(theory_var v);
+        bool check_lazy_terms();
+        friend class lazy_blast_trail;
+
+        void register_word_term(app * n);
+        void push_word_term(theory_var v);
+        void push_word_parents(theory_var v);
+        void register_word_bound(app * n, le_atom * a);
+        void add_word_bounds(theory_var v, bv_word_value & r);
+        void get_word_value(theory_var v, bv_word_value & r);
+        void propagate_word_term(theory_var v);
+        friend class word_parent_trail;
+        friend class word_bound_trail;
+
         template<bool Signed>
         void internalize_le(app * atom);
         bool internalize_xor3(app * n, bool gate_ctx);
@@ -236,6 +278,10 @@ namespace smt {
         virtual void pop_scope_eh(unsigned num_scopes);
         virtual final_check_status final_check_eh();
         virtual void reset_eh();
+        virtual void init_search_eh();
+        virtual void restart_eh();
+        virtual bool can_propagate();
+        virtual void propagate();
         svector<theory_var>   m_merge_aux[2]; //!< auxiliary vector used in merge_zero_one_bits
         bool merge_zero_one_bits(theory_var r1, theory_var r2);
 
@@ -218,6 +218,17 @@ public:
         return m_solver1->check_sat(0, 0);
     }
 
+    virtual bool cube(unsigned depth, expr_ref_vector & cubes) {
+        switch_inc_mode();
+        return m_solver2->cube(depth, cubes);
+    }
+
+    // The copy of a combined solver is a copy of its incremental solver.
+    virtual solver * translate(ast_manager & m, params_ref const & p) {
+        switch_inc_mode();
+        return m_solver2->translate(m, p);
+    }
+
     virtual void set_cancel(bool f) {
         if (f) {
             m_solver1->cancel();
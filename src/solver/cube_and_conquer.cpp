@@ -0,0 +1,264 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    cube_and_conquer.cpp
+
+Abstract:
+
+    Cube and conquer: the assertions of a solver are split into cubes
+    (see solver::cube), and the cubes are solved in parallel by copies
+    of the solver (see solver::translate).
+
+Author:
+
+Revision History:
+
+--*/
+#include"cube_and_conquer.h"
+#include"ast_translation.h"
+#include"task_pool.h"
+#include"scoped_ptr_vector.h"
+#include"obj_hashtable.h"
+
+struct cube_and_conquer_state {
+    solver &                           m_solver;      // the original solver, its interruption stops the workers.
+    // The workers use their own managers, except when the cubes are solved by the original solver.
+    scoped_ptr_vector<ast_manager>     m_managers;
+    sref_vector<solver>                m_copies;
+    ptr_vector<solver>                 m_solvers;
+    scoped_ptr_vector<expr_ref_vector> m_cubes;       // cubes of each worker
+    scoped_ptr_vector<expr_ref_vector> m_assumptions; // assumptions of each worker, followed by the tracked assumptions of the solver
+    unsigned                           m_num_assumptions;
+    task_pool::mutex                   m_mutex;
+    unsigned                           m_next_cube;
+    unsigned                           m_sat_worker;
+    model_ref                          m_model;
+    svector<bool>                      m_in_core;     // index in m_assumptions -> it is in the core of some cube
+    bool                               m_undef;
+    std::string                        m_unknown;
+    unsigned                           m_num_unsat;
+
+    cube_and_conquer_state(solver & s, unsigned num_assumptions, unsigned num_tracked):
+        m_solver(s),
+        m_num_assumptions(num_assumptions),
+        m_next_cube(0),
+        m_sat_worker(UINT_MAX),
+        m_undef(false),
+        m_num_unsat(0) {
+        m_in_core.resize(num_assumptions + num_tracked, false);
+    }
+
+    bool next_cube(unsigned & idx) {
+        task_pool::scoped_lock lock(m_mutex);
+        if (m_sat_worker != UINT_MAX || m_next_cube == m_cubes[0]->size())
+            return false;
+        // a worker that starts a check after the interruption would not be interrupted.
+        if (m_solver.canceled()) {
+            if (!m_undef) {
+                m_undef   = true;
+                m_unknown = "canceled";
+            }
+            return false;
+        }
+        idx = m_next_cube++;
+        return true;
+    }
+
+    void set_sat(unsigned i, model_ref & md) {
+        task_pool::scoped_lock lock(m_mutex);
+        if (m_sat_worker != UINT_MAX)
+            return;
+        m_sat_worker = i;
+        m_model      = md;
+        for (unsigned j = 0; j < m_solvers.size(); j++) {
+            if (j != i)
+                m_solvers[j]->cancel();
+        }
+    }
+
+    void set_unsat(unsigned i, ptr_vector<expr> const & core) {
+        task_pool::scoped_lock lock(m_mutex);
+        m_num_unsat++;
+        expr_ref_vector const & as = *(m_assumptions[i]);
+        for (unsigned j = 0; j < core.size(); j++) {
+            for (unsigned k = 0; k < as.size(); k++) {
+                if (as.get(k) == core[j])
+                    m_in_core[k] = true;
+            }
+        }
+    }
+
+    void set_undef(std::string const & reason) {
+        task_pool::scoped_lock lock(m_mutex);
+        if (m_sat_worker != UINT_MAX || m_undef)
+            return;
+        m_undef   = true;
+        m_unknown = reason;
+    }
+
+    void run(unsigned i) {
+        solver & s                    = *(m_solvers[i]);
+        expr_ref_vector const & cubes = *(m_cubes[i]);
+        expr_ref_vector const & as    = *(m_assumptions[i]);
+        unsigned idx;
+        while (next_cube(idx)) {
+            bool pushed = false;
+            try {
+                s.push();
+                pushed = true;
+                s.assert_expr(cubes.get(idx));
+                lbool r = s.check_sat(m_num_assumptions, as.c_ptr());
+                if (r == l_true) {
+                    model_ref md;
+                    s.get_model(md);
+                    set_sat(i, md);
+                }
+                else if (r == l_false) {
+                    ptr_vector<expr> core;
+                    s.get_unsat_core(core);
+                    set_unsat(i, core);
+                }
+                else {
+                    set_undef(s.reason_unknown());
+                }
+                pushed = false;
+                s.pop(1);
+            }
+            catch (z3_exception & ex) {
+                // s may be the original solver, the scope of the cube must not remain in it.
+                if (pushed)
+                    s.pop(1);
+                set_undef(ex.msg());
+                return;
+            }
+        }
+    }
+};
+
+class cube_and_conquer_worker : public task_pool::task {
+    cube_and_conquer_state & m_state;
+    unsigned                 m_idx;
+public:
+    cube_and_conquer_worker(cube_and_conquer_state & s, unsigned idx):m_state(s), m_idx(idx) {}
+    virtual void run() { m_state.run(m_idx); }
+};
+
+/**
+   \brief Store in \c result the given assumptions followed by the tracked assumptions of \c s.
+   A tracked assumption occurs once for each assertion that it tracks.
+*/
+static void mk_worker_assumptions(ast_translation * tr, solver & s, unsigned num_assumptions, expr * const * assumptions,
+                                  expr_ref_vector & result) {
+    for (unsigned j = 0; j < num_assumptions; j++)
+        result.push_back(tr ? (*tr)(assumptions[j]) : assumptions[j]);
+    for (unsigned j = 0; j < s.get_num_assumptions(); j++)
+        result.push_back(tr ? (*tr)(s.get_assumption(j)) : s.get_assumption(j));
+}
+
+lbool cube_and_conquer(solver & s, ast_manager & m, unsigned depth,
+                       unsigned num_assumptions, expr * const * assumptions,
+                       params_ref const & p, simple_check_sat_result & result) {
+    expr_ref_vector cubes(m), all_assumptions(m);
+    mk_worker_assumptions(0, s, num_assumptions, assumptions, all_assumptions);
+    // The cubes are computed under the assumptions. If they were used to omit cubes or to add
+    // failed literals to them, then the cores of the cubes do not account for them.
+    s.push();
+    for (unsigned j = 0; j < num_assumptions; j++)
+        s.assert_expr(assumptions[j]);
+    bool valid = s.cube(depth, cubes);
+    s.pop(1);
+    IF_VERBOSE(10, verbose_stream() << "(cube-and-conquer :cubes " << cubes.size() << " :valid " << valid << ")\n";);
+    result.m_stats.update("cubes", cubes.size());
+    result.m_model = 0;
+    result.m_core.reset();
+    obj_hashtable<expr> in_core;
+    if (cubes.empty()) {
+        for (unsigned j = 0; j < all_assumptions.size(); j++) {
+            if (!in_core.contains(all_assumptions.get(j))) {
+                in_core.insert(all_assumptions.get(j));
+                result.m_core.push_back(all_assumptions.get(j));
+            }
+        }
+        result.set_status(l_false);
+        return l_false;
+    }
+
+    cube_and_conquer_state st(s, num_assumptions, s.get_num_assumptions());
+    unsigned num_workers = std::min(task_pool::get_max_threads(), cubes.size());
+    for (unsigned i = 0; num_workers > 1 && i < num_workers; i++) {
+        ast_manager * new_m = alloc(ast_manager, m, !m.proof_mode());
+        solver * new_s      = s.translate(*new_m, p);
+        if (new_s == 0) {
+            dealloc(new_m);
+            break;
+        }
+        st.m_managers.push_back(new_m);
+        st.m_copies.push_back(new_s);
+        st.m_solvers.push_back(new_s);
+        ast_translation tr(m, *new_m);
+        expr_ref_vector * new_cubes = alloc(expr_ref_vector, *new_m);
+        for (unsigned j = 0; j < cubes.size(); j++)
+            new_cubes->push_back(tr(cubes.get(j)));
+        st.m_cubes.push_back(new_cubes);
+        expr_ref_vector * new_as = alloc(expr_ref_vector, *new_m);
+        mk_worker_assumptions(&tr, s, num_assumptions, assumptions, *new_as);
+        st.m_assumptions.push_back(new_as);
+    }
+    if (st.m_solvers.empty()) {
+        st.m_solvers.push_back(&s);
+        st.m_cubes.push_back(alloc(expr_ref_vector, cubes));
+        st.m_assumptions.push_back(alloc(expr_ref_vector, all_assumptions));
+    }
+
+    {
+        unsigned sz = st.m_solvers.size();
+        scoped_ptr_vector<cube_and_conquer_worker> workers;
+        ptr_buffer<task_pool::task>                tasks;
+        for (unsigned i = 0; i < sz; i++) {
+            workers.push_back(alloc(cube_and_conquer_worker, st, i));
+            tasks.push_back(workers[i]);
+        }
+        for (unsigned i = 0; i < st.m_copies.size(); i++)
+            s.add_cancel_child(st.m_copies.get(i));
+        task_pool::execute(sz, tasks.c_ptr());
+        for (unsigned i = 0; i < st.m_copies.size(); i++)
+            s.remove_cancel_child(st.m_copies.get(i));
+    }
+
+    for (unsigned i = 0; i < st.m_solvers.size(); i++)
+        st.m_solvers[i]->collect_statistics(result.m_stats);
+    result.m_stats.update("cubes refuted", st.m_num_unsat);
+
+    lbool r;
+    if (st.m_sat_worker != UINT_MAX) {
+        r = l_true;
+        if (st.m_model) {
+            if (st.m_managers.empty()) {
+                result.m_model = st.m_model;
+            }
+            else {
+                ast_translation tr(*(st.m_managers[st.m_sat_worker]), m, false);
+                result.m_model = st.m_model->translate(tr);
+            }
+        }
+    }
+    else if (st.m_undef) {
+        r = l_undef;
+        result.m_unknown = st.m_unknown;
+    }
+    else {
+        r = l_false;
+        for (unsigned j = 0; j < all_assumptions.size(); j++) {
+            expr * a = all_assumptions.get(j);
+            if ((!valid || st.m_in_core[j]) && !in_core.contains(a)) {
+                in_core.insert(a);
+                result.m_core.push_back(a);
+            }
+        }
+    }
+    st.m_model = 0;
+    result.set_status(r);
+    return r;
+}
@@ -0,0 +1,42 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    cube_and_conquer.h
+
+Abstract:
+
+    Cube and conquer: the assertions of a solver are split into cubes
+    (see solver::cube), and the cubes are solved in parallel by copies
+    of the solver (see solver::translate).
+
+Author:
+
+Revision History:
+
+--*/
+#ifndef _CUBE_AND_CONQUER_H_
+#define _CUBE_AND_CONQUER_H_
+
+#include"solver.h"
+
+/**
+   \brief Check the assertions of \c s modulo the given assumptions by splitting them
+   into at most 2^depth cubes, and solving the cubes on copies of \c s that run on the
+   threads of the task_pool. The cubes are solved by \c s itself if only one thread is
+   available, or if \c s cannot be copied.
+
+   The status, model, unsat core, reason for unknown, and statistics are stored in \c result.
+   The unsat core is the union of the cores of the cubes, and it may contain the given
+   assumptions and the tracked assumptions of \c s (see solver::assert_expr(t, a)). The cubes
+   are computed under all the assumptions, so the core contains all of them if they were
+   used to refute cubes (see solver::cube).
+
+   Interrupting \c s interrupts its copies.
+*/
+lbool cube_and_conquer(solver & s, ast_manager & m, unsigned depth,
+                       unsigned num_assumptions, expr * const * assumptions,
+                       params_ref const & p, simple_check_sat_result & result);
+
+#endif
@@ -28,6 +28,38 @@ expr * solver::get_assertion(unsigned idx) const {
     return 0;
 }
 
+bool solver::cube(unsigned depth, expr_ref_vector & cubes) {
+    cubes.push_back(cubes.get_manager().mk_true());
+    return true;
+}
+
+void solver::cancel() {
+    // cancel is invoked by signal handlers, so the lock is only taken to access the children.
+    m_canceled = true;
+    set_cancel(true);
+    task_pool::scoped_lock lock(m_cancel_mutex);
+    for (unsigned i = 0; i < m_cancel_children.size(); i++)
+        m_cancel_children[i]->cancel();
+}
+
+void solver::reset_cancel() {
+    task_pool::scoped_lock lock(m_cancel_mutex);
+    m_canceled = false;
+    set_cancel(false);
+}
+
+void solver::add_cancel_child(solver * s) {
+    task_pool::scoped_lock lock(m_cancel_mutex);
+    m_cancel_children.push_back(s);
+    if (m_canceled)
+        s->cancel();
+}
+
+void solver::remove_cancel_child(solver * s) {
+    task_pool::scoped_lock lock(m_cancel_mutex);
+    m_cancel_children.erase(s);
+}
+
 void solver::display(std::ostream & out) const {
     out << "(solver)";
 }
@@ -22,6 +22,7 @@ Notes:
 #include"check_sat_result.h"
 #include"progress_callback.h"
 #include"params.h"
+#include"task_pool.h"
 
 class solver;
 
@@ -44,7 +45,11 @@ public:
      - interruption (set_cancel)
 */
 class solver : public check_sat_result {
+    task_pool::mutex   m_cancel_mutex;
+    volatile bool      m_canceled;
+    ptr_vector<solver> m_cancel_children; // solvers that are interrupted together with this one.
 public:
+    solver():m_canceled(false) {}
     virtual ~solver() {}
     /**
        \brief Update the solver internal settings. 
@@ -100,13 +105,45 @@ public:
     virtual lbool check_sat(unsigned num_assumptions, expr * const * assumptions) = 0;
 
     /**
-       \brief Interrupt this solver.
+       \brief Store in \c cubes at most 2^depth cubes (conjunctions of literals) whose disjunction is
+       implied by the assertions. The cubes are pairwise disjoint. No cube is stored if the
+       assertions are found to be unsatisfiable.
+
+       Return true if the disjunction of the cubes is valid, and false if the assertions were
+       used to omit cubes or to add implied literals to them.
+
+       The default implementation stores the trivial cube \c true.
     */
-    void cancel() { set_cancel(true); }
+    virtual bool cube(unsigned depth, expr_ref_vector & cubes);
+
+    /**
+       \brief Return a copy of this solver that uses the manager \c m and the parameters \c p,
+       or 0 if copying is not supported. The assertions of the copy are not organized in
+       backtracking points.
+    */
+    virtual solver * translate(ast_manager & m, params_ref const & p) { return 0; }
+
+    /**
+       \brief Interrupt this solver, and the solvers added by add_cancel_child.
+       It may be invoked by other threads.
+    */
+    void cancel();
     /**
        \brief Reset the interruption.
     */
-    void reset_cancel() { set_cancel(false); }
+    void reset_cancel();
+    /**
+       \brief Return true if this solver was interrupted, and the interruption was not reset.
+    */
+    bool canceled() const { return m_canceled; }
+
+    /**
+       \brief Interrupt \c s whenever this solver is interrupted, until remove_cancel_child(s) is
+       invoked. \c s is interrupted immediately if this solver is already interrupted.
+       This is used to interrupt the solvers that work on behalf of this one in other threads.
+    */
+    void add_cancel_child(solver * s);
+    void remove_cancel_child(solver * s);
 
     /**
        \brief Set a progress callback procedure that is invoked by this solver during check_sat.
@@ -46,6 +46,15 @@ void solver_na2as::assert_expr(expr * t, expr * a) {
     }
 }
 
+void solver_na2as::copy_assumptions(solver_na2as const & src, ast_translation & tr) {
+    SASSERT(&tr.to() == &m_manager);
+    for (unsigned i = 0; i < src.m_assumptions.size(); i++) {
+        expr * a = tr(src.m_assumptions[i]);
+        m_manager.inc_ref(a);
+        m_assumptions.push_back(a);
+    }
+}
+
 struct append_assumptions {
     ptr_vector<expr> & m_assumptions;
     unsigned           m_old_sz;
@@ -23,6 +23,7 @@ Notes:
 #define _SOLVER_NA2AS_H_
 
 #include"solver.h"
+#include"ast_translation.h"
 
 class solver_na2as : public solver {
     ast_manager &      m_manager;
@@ -45,6 +46,12 @@ public:
     virtual unsigned get_num_assumptions() const { return m_assumptions.size(); }
     virtual expr * get_assumption(unsigned idx) const { return m_assumptions[idx]; }
 protected:
+    /**
+       \brief Append the tracked assumptions of \c src, translated by \c tr, to the assumptions of this solver.
+       The assertions themselves are not copied.
+    */
+    void copy_assumptions(solver_na2as const & src, ast_translation & tr);
+
     virtual lbool check_sat_core(unsigned num_assumptions, expr * const * assumptions) = 0;
     virtual void push_core() = 0;
     virtual void pop_core(unsigned n) = 0;
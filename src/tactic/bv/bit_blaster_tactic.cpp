@@ -123,6 +123,9 @@ public:
         r.insert("blast_mul", CPK_BOOL, "(default: true) bit-blast multipliers (and dividers, remainders).");
         r.insert("blast_add", CPK_BOOL, "(default: true) bit-blast adders.");
         r.insert("blast_quant", CPK_BOOL, "(default: false) bit-blast quantified variables.");
+        r.insert("blast_cache", CPK_BOOL, "(default: false) cache the circuits of multipliers, dividers and shifts by bit-width and argument structure.");
+        r.insert("blast_mul_encoding", CPK_UINT, "(default: 0) multiplier circuit: 0 - array, 1 - Wallace tree, 2 - Dadda tree, 3 - Karatsuba.");
+        r.insert("blast_div_encoding", CPK_UINT, "(default: 0) divider circuit: 0 - restoring, 1 - non-restoring.");
         r.insert("blast_full", CPK_BOOL, "(default: false) bit-blast any term with bit-vector sort, this option will make E-matching ineffective in any pattern containing bit-vector terms.");
     }
      
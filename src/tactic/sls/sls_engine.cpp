@@ -40,7 +40,8 @@ sls_engine::sls_engine(ast_manager & m, params_ref const & p) :
     m_cancel(false),
     m_bv_util(m),
     m_tracker(m, m_bv_util, m_mpz_manager, m_powers),
-    m_evaluator(m, m_bv_util, m_tracker, m_mpz_manager, m_powers)
+    m_evaluator(m, m_bv_util, m_tracker, m_mpz_manager, m_powers),
+    m_shared(0)
 {
     updt_params(p);
     m_tracker.updt_params(p);
@@ -72,6 +73,7 @@ void sls_engine::updt_params(params_ref const & _p) {
     m_early_prune = p.early_prune();
     m_random_offset = p.random_offset();
     m_rescore = p.rescore();
+    m_share_interval = p.share_interval();
 
     // Andreas: Would cause trouble because repick requires an assertion being picked before which is not the case in GSAT.
     if (m_walksat_repick && !m_walksat)
@@ -190,6 +192,11 @@ bool sls_engine::what_if(
 }
 
 void sls_engine::mk_add(unsigned bv_sz, const mpz & old_value, mpz & add_value, mpz & result) {
+    if (powers::is_word(bv_sz)) {
+        uint64 r = m_mpz_manager.get_uint64(old_value) + m_mpz_manager.get_uint64(add_value);
+        m_mpz_manager.set(result, r & powers::mask(bv_sz));
+        return;
+    }
     mpz temp, mask, mask2;
     m_mpz_manager.add(old_value, add_value, temp);
     m_mpz_manager.set(mask, m_powers(bv_sz));
@@ -202,6 +209,10 @@ void sls_engine::mk_add(unsigned bv_sz, const mpz & old_value, mpz & add_value,
 }
 
 void sls_engine::mk_inc(unsigned bv_sz, const mpz & old_value, mpz & incremented) {
+    if (powers::is_word(bv_sz)) {
+        m_mpz_manager.set(incremented, (m_mpz_manager.get_uint64(old_value) + 1) & powers::mask(bv_sz));
+        return;
+    }
     unsigned shift;
     m_mpz_manager.add(old_value, m_one, incremented);
     if (m_mpz_manager.is_power_of_two(incremented, shift) && shift == bv_sz)
@@ -209,6 +220,10 @@ void sls_engine::mk_inc(unsigned bv_sz, const mpz & old_value, mpz & incremented
 }
 
 void sls_engine::mk_dec(unsigned bv_sz, const mpz & old_value, mpz & decremented) {
+    if (powers::is_word(bv_sz)) {
+        m_mpz_manager.set(decremented, (m_mpz_manager.get_uint64(old_value) - 1) & powers::mask(bv_sz));
+        return;
+    }
     if (m_mpz_manager.is_zero(old_value)) {
         m_mpz_manager.set(decremented, m_powers(bv_sz));
         m_mpz_manager.dec(decremented);
@@ -218,13 +233,20 @@ void sls_engine::mk_dec(unsigned bv_sz, const mpz & old_value, mpz & decremented
 }
 
 void sls_engine::mk_inv(unsigned bv_sz, const mpz & old_value, mpz & inverted) {
-    m_mpz_manager.bitwise_not(bv_sz, old_value, inverted);
+    if (powers::is_word(bv_sz))
+        m_mpz_manager.set(inverted, ~m_mpz_manager.get_uint64(old_value) & powers::mask(bv_sz));
+    else
+        m_mpz_manager.bitwise_not(bv_sz, old_value, inverted);
 }
 
 void sls_engine::mk_flip(sort * s, const mpz & old_value, unsigned bit, mpz & flipped) {
     m_mpz_manager.set(flipped, m_zero);
 
-    if (m_bv_util.is_bv_sort(s)) {
+    if (m_bv_util.is_bv_sort(s) && powers::is_word(m_bv_util.get_bv_size(s))) {
+        uint64 mask = static_cast<uint64>(1) << bit;
+        m_mpz_manager.set(flipped, m_mpz_manager.get_uint64(old_value) ^ mask);
+    }
+    else if (m_bv_util.is_bv_sort(s)) {
         mpz mask;
         m_mpz_manager.set(mask, m_powers(bit));
         m_mpz_manager.bitwise_xor(old_value, mask, flipped);
@@ -569,7 +591,7 @@ lbool sls_engine::operator()() {
         report_tactic_progress("Searching... restarts left:", m_max_restarts - m_stats.m_restarts);
         res = search();
 
-        if (res == l_undef)
+        if (res == l_undef && !exchange_assignment())
         {
             if (m_restart_init)
                 m_tracker.randomize(m_assertions);
@@ -583,6 +605,58 @@ lbool sls_engine::operator()() {
     return res;
 }
 
+void sls_engine::shared_assignment::publish(unsigned num_sat, vector<rational> const & values) {
+    #pragma omp critical (sls_shared_assignment)
+    {
+        if (num_sat > m_num_sat) {
+            m_num_sat = num_sat;
+            m_values.reset();
+            m_values.append(values);
+        }
+    }
+}
+
+bool sls_engine::shared_assignment::fetch(unsigned num_sat, vector<rational> & values) {
+    bool r = false;
+    #pragma omp critical (sls_shared_assignment)
+    {
+        if (m_num_sat > num_sat) {
+            values.reset();
+            values.append(m_values);
+            r = true;
+        }
+    }
+    return r;
+}
+
+// publish the current assignment, and adopt the shared one if it satisfies more assertions.
+bool sls_engine::exchange_assignment() {
+    if (!m_shared)
+        return false;
+
+    unsigned num_sat = 0;
+    for (unsigned i = 0; i < m_assertions.size(); i++)
+        if (m_mpz_manager.is_one(m_tracker.get_value(m_assertions[i])))
+            num_sat++;
+
+    unsigned sz = m_tracker.get_num_constants();
+    vector<rational> values;
+    for (unsigned i = 0; i < sz; i++)
+        values.push_back(rational(m_tracker.get_value(m_tracker.get_constant(i))));
+    m_shared->publish(num_sat, values);
+
+    if (m_share_interval == 0 || m_stats.m_restarts % m_share_interval != 0)
+        return false;
+    if (!m_shared->fetch(num_sat, values))
+        return false;
+
+    SASSERT(values.size() == sz);
+    for (unsigned i = 0; i < sz; i++)
+        m_tracker.set_value(m_tracker.get_constant(i), values[i].to_mpq().numerator());
+    TRACE("sls", tout << "Adopted shared model:" << std::endl; m_tracker.show_model(tout););
+    return true;
+}
+
 /* Andreas: Needed for Armin's restart scheme if we don't want to use loops.
 double sls_engine::get_restart_armin(unsigned cnt_restarts)
 {
@@ -56,6 +56,20 @@ public:
         }
     };
 
+    /**
+       \brief Assignment satisfying the most assertions found by a group of engines
+       running on translated copies of the same goal. The values are indexed by the
+       position of the constant in the tracker, which does not depend on the manager.
+    */
+    class shared_assignment {
+        unsigned         m_num_sat;
+        vector<rational> m_values;
+    public:
+        shared_assignment() : m_num_sat(0) {}
+        void publish(unsigned num_sat, vector<rational> const & values);
+        bool fetch(unsigned num_sat, vector<rational> & values);
+    };
+
 protected:
     ast_manager   & m_manager;
     stats           m_stats;
@@ -83,6 +97,8 @@ protected:
     unsigned        m_early_prune;
     unsigned        m_random_offset;
     unsigned        m_rescore;
+    unsigned        m_share_interval;
+    shared_assignment * m_shared;
 
     typedef enum { MV_FLIP = 0, MV_INC, MV_DEC, MV_INV } move_type;
 
@@ -100,6 +116,8 @@ public:
 
     void assert_expr(expr * e) { m_assertions.push_back(e); }
 
+    void set_shared_assignment(shared_assignment * s) { m_shared = s; }
+
     stats const & get_stats(void) { return m_stats; }
     void reset_statistics(void) { m_stats.reset(); }    
 
@@ -136,6 +154,8 @@ protected:
 
     void mk_random_move(ptr_vector<func_decl> & unsat_constants);
 
+    bool exchange_assignment();
+
     //double get_restart_armin(unsigned cnt_restarts);    
     unsigned check_restart(unsigned curr_value);
 };
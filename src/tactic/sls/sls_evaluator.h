@@ -37,6 +37,7 @@ class sls_evaluator {
     expr_ref_buffer       m_temp_exprs;
     vector<ptr_vector<expr> > m_traversal_stack;
     vector<ptr_vector<expr> > m_traversal_stack_bool;
+    bool                  m_word_eval;
 
 public:
     sls_evaluator(ast_manager & m, bv_util & bvu, sls_tracker & t, unsynch_mpz_manager & mm, powers & p) : 
@@ -48,7 +49,8 @@ public:
         m_one(m_mpz_manager.mk_z(1)),
         m_two(m_mpz_manager.mk_z(2)),
         m_powers(p),
-        m_temp_exprs(m) {
+        m_temp_exprs(m),
+        m_word_eval(true) {
         m_bv_fid = m_bv_util.get_family_id();
         m_basic_fid = m_manager.get_basic_family_id();
     }
@@ -59,6 +61,253 @@ public:
         m_mpz_manager.del(m_two);            
     }
     
+    /**
+       \brief Enable or disable the evaluation on machine words. When it is disabled,
+       all bit-vectors are evaluated with mpz numbers.
+    */
+    void set_word_eval(bool f) { m_word_eval = f; }
+
+    bool is_word(app * n) {
+        if (n->get_num_args() == 0)
+            return false;
+        if (m_bv_util.is_bv(n) && !powers::is_word(m_bv_util.get_bv_size(n)))
+            return false;
+        expr * arg = n->get_arg(0);
+        return m_bv_util.is_bv(arg) && powers::is_word(m_bv_util.get_bv_size(arg));
+    }
+
+    uint64 get_word(expr * n) {
+        return m_mpz_manager.get_uint64(m_tracker.get_value(n));
+    }
+
+    /**
+       \brief Evaluate a bit-vector application whose arguments and result have at most 64 bits.
+       Same semantics as the mpz based evaluation in operator().
+    */
+    void eval_word(app * n, mpz & result) {
+        unsigned n_args = n->get_num_args();
+        expr * const * args = n->get_args();
+        unsigned bv_sz = m_bv_util.get_bv_size(args[0]);
+        uint64 r = 0;
+
+        switch (n->get_decl_kind()) {
+        case OP_CONCAT: {
+            SASSERT(n_args >= 2);
+            for (unsigned i = 0; i < n_args; i++)
+                r = shift_left(r, m_bv_util.get_bv_size(args[i])) | get_word(args[i]);
+            break;
+        }
+        case OP_EXTRACT: {
+            SASSERT(n_args == 1);
+            unsigned h = m_bv_util.get_extract_high(n);
+            unsigned l = m_bv_util.get_extract_low(n);
+            r = (get_word(args[0]) >> l) & powers::mask(h - l + 1);
+            break;
+        }
+        case OP_BADD: {
+            SASSERT(n_args >= 2);
+            for (unsigned i = 0; i < n_args; i++)
+                r += get_word(args[i]);
+            r &= powers::mask(bv_sz);
+            break;
+        }
+        case OP_BSUB: {
+            SASSERT(n_args == 2);
+            r = (get_word(args[0]) - get_word(args[1])) & powers::mask(bv_sz);
+            break;
+        }
+        case OP_BMUL: {
+            SASSERT(n_args >= 2);
+            r = get_word(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r *= get_word(args[i]);
+            r &= powers::mask(bv_sz);
+            break;
+        }
+        case OP_BNEG: {
+            SASSERT(n_args == 1);
+            r = (0 - get_word(args[0])) & powers::mask(bv_sz);
+            break;
+        }
+        case OP_BSDIV:
+        case OP_BSDIV0:
+        case OP_BSDIV_I: {
+            SASSERT(n_args == 2);
+            int64 x = powers::to_signed(get_word(args[0]), bv_sz);
+            int64 y = powers::to_signed(get_word(args[1]), bv_sz);
+            if (y == 0)
+                r = x < 0 ? 1 : UINT64_MAX;
+            else if (y == -1)
+                r = 0 - static_cast<uint64>(x); // x / -1 overflows for INT64_MIN
+            else
+                r = static_cast<uint64>(x / y);
+            r &= powers::mask(bv_sz);
+            break;
+        }
+        case OP_BUDIV:
+        case OP_BUDIV0:
+        case OP_BUDIV_I: {
+            SASSERT(n_args == 2);
+            uint64 y = get_word(args[1]);
+            r = (y == 0) ? powers::mask(bv_sz) : get_word(args[0]) / y;
+            break;
+        }
+        case OP_BSREM:
+        case OP_BSREM0:
+        case OP_BSREM_I: {
+            SASSERT(n_args == 2);
+            int64 x = powers::to_signed(get_word(args[0]), bv_sz);
+            int64 y = powers::to_signed(get_word(args[1]), bv_sz);
+            if (y == 0)
+                r = static_cast<uint64>(x);
+            else if (y == -1)
+                r = 0;
+            else
+                r = static_cast<uint64>(x % y);
+            r &= powers::mask(bv_sz);
+            break;
+        }
+        case OP_BUREM:
+        case OP_BUREM0:
+        case OP_BUREM_I: {
+            SASSERT(n_args == 2);
+            uint64 x = get_word(args[0]);
+            uint64 y = get_word(args[1]);
+            r = (y == 0) ? x : x % y;
+            break;
+        }
+        case OP_BSMOD:
+        case OP_BSMOD0:
+        case OP_BSMOD_I: {
+            SASSERT(n_args == 2);
+            int64 x = powers::to_signed(get_word(args[0]), bv_sz);
+            int64 y = powers::to_signed(get_word(args[1]), bv_sz);
+            if (y == 0)
+                r = static_cast<uint64>(x);
+            else {
+                // the absolute values are computed modulo 2^64, so INT64_MIN is fine.
+                uint64 abs_x = x < 0 ? 0 - static_cast<uint64>(x) : static_cast<uint64>(x);
+                uint64 abs_y = y < 0 ? 0 - static_cast<uint64>(y) : static_cast<uint64>(y);
+                r = abs_x % abs_y;
+                if (r != 0 && (x < 0 || y < 0)) {
+                    if (x < 0 && y >= 0)
+                        r = static_cast<uint64>(y) - r;
+                    else if (x >= 0 && y < 0)
+                        r = r + static_cast<uint64>(y);
+                    else
+                        r = 0 - r;
+                }
+            }
+            r &= powers::mask(bv_sz);
+            break;
+        }
+        case OP_BAND: {
+            SASSERT(n_args >= 2);
+            r = get_word(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r &= get_word(args[i]);
+            break;
+        }
+        case OP_BOR: {
+            SASSERT(n_args >= 2);
+            r = get_word(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r |= get_word(args[i]);
+            break;
+        }
+        case OP_BXOR: {
+            SASSERT(n_args >= 2);
+            r = get_word(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r ^= get_word(args[i]);
+            break;
+        }
+        case OP_BNAND: {
+            SASSERT(n_args >= 2);
+            r = get_word(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r = ~(r & get_word(args[i])) & powers::mask(bv_sz);
+            break;
+        }
+        case OP_BNOR: {
+            SASSERT(n_args >= 2);
+            r = get_word(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r = ~(r | get_word(args[i])) & powers::mask(bv_sz);
+            break;
+        }
+        case OP_BNOT: {
+            SASSERT(n_args == 1);
+            r = ~get_word(args[0]) & powers::mask(bv_sz);
+            break;
+        }
+        case OP_ULT:
+        case OP_ULEQ:
+        case OP_UGT:
+        case OP_UGEQ: {
+            SASSERT(n_args == 2);
+            uint64 x = get_word(args[0]);
+            uint64 y = get_word(args[1]);
+            switch (n->get_decl_kind()) {
+            case OP_ULT:  r = x <  y; break;
+            case OP_ULEQ: r = x <= y; break;
+            case OP_UGT:  r = x >  y; break;
+            default:      r = x >= y; break;
+            }
+            break;
+        }
+        case OP_SLT:
+        case OP_SLEQ:
+        case OP_SGT:
+        case OP_SGEQ: {
+            SASSERT(n_args == 2);
+            int64 x = powers::to_signed(get_word(args[0]), bv_sz);
+            int64 y = powers::to_signed(get_word(args[1]), bv_sz);
+            switch (n->get_decl_kind()) {
+            case OP_SLT:  r = x <  y; break;
+            case OP_SLEQ: r = x <= y; break;
+            case OP_SGT:  r = x >  y; break;
+            default:      r = x >= y; break;
+            }
+            break;
+        }
+        case OP_BIT2BOOL:
+        case OP_SIGN_EXT: {
+            SASSERT(n_args == 1);
+            r = get_word(args[0]);
+            break;
+        }
+        case OP_BASHR: {
+            SASSERT(n_args == 2);
+            uint64 x = get_word(args[0]);
+            uint64 shift = get_word(args[1]);
+            bool sign = (x >> (bv_sz - 1)) != 0;
+            if (shift >= bv_sz)
+                r = sign ? powers::mask(bv_sz) : 0;
+            else {
+                r = x >> shift;
+                if (sign)
+                    r |= powers::mask(bv_sz) & ~(powers::mask(bv_sz) >> shift);
+            }
+            break;
+        }
+        case OP_BLSHR: {
+            SASSERT(n_args == 2);
+            r = shift_right(get_word(args[0]), get_word(args[1]));
+            break;
+        }
+        case OP_BSHL: {
+            SASSERT(n_args == 2);
+            r = shift_left(get_word(args[0]), get_word(args[1])) & powers::mask(bv_sz);
+            break;
+        }
+        default:
+            NOT_IMPLEMENTED_YET();
+        }
+
+        m_mpz_manager.set(result, r);
+    }
+
     void operator()(app * n, mpz & result) {
         family_id nfid = n->get_family_id();
         func_decl * fd = n->get_decl();
@@ -124,6 +373,9 @@ public:
                 NOT_IMPLEMENTED_YET();
             }
         }
+        else if (nfid == m_bv_fid && m_word_eval && is_word(n)) {
+            eval_word(n, result);
+        }
         else if (nfid == m_bv_fid) {
             bv_op_kind k = static_cast<bv_op_kind>(fd->get_decl_kind());
             switch(k) {
@@ -425,44 +677,40 @@ public:
             }            
             case OP_BASHR: {
                 SASSERT(n_args == 2);
-                m_mpz_manager.set(result, m_tracker.get_value(args[0]));
-                mpz first;
-                const mpz & p = m_powers(m_bv_util.get_bv_size(args[0])-1);
-                m_mpz_manager.bitwise_and(result, p, first);
-                mpz shift; m_mpz_manager.set(shift, m_tracker.get_value(args[1]));
-                mpz temp;
-                while (!m_mpz_manager.is_zero(shift)) {
-                    m_mpz_manager.machine_div(result, m_two, temp);
-                    m_mpz_manager.add(temp, first, result);
-                    m_mpz_manager.dec(shift);
+                const mpz & x = m_tracker.get_value(args[0]);
+                const mpz & shift = m_tracker.get_value(args[1]);
+                unsigned bv_sz = m_bv_util.get_bv_size(args[0]);
+                bool sign = m_mpz_manager.ge(x, m_powers(bv_sz-1));
+                if (m_mpz_manager.is_uint(shift) && m_mpz_manager.get_uint(shift) < bv_sz) {
+                    unsigned k = m_mpz_manager.get_uint(shift);
+                    m_mpz_manager.machine_div2k(x, k, result);
+                    if (sign) {
+                        // fill the k most significant bits
+                        m_mpz_manager.add(result, m_powers(bv_sz), result);
+                        m_mpz_manager.sub(result, m_powers(bv_sz-k), result);
+                    }
+                }
+                else if (sign) {
+                    m_mpz_manager.set(result, m_powers(bv_sz));
+                    m_mpz_manager.dec(result);
                 }
-                m_mpz_manager.del(first);                 
-                m_mpz_manager.del(shift);
-                m_mpz_manager.del(temp);
                 break;
             }
             case OP_BLSHR: {
                 SASSERT(n_args == 2);
-                m_mpz_manager.set(result, m_tracker.get_value(args[0]));
-                mpz shift; m_mpz_manager.set(shift, m_tracker.get_value(args[1]));
-                while (!m_mpz_manager.is_zero(shift)) {
-                    m_mpz_manager.machine_div(result, m_two, result);
-                    m_mpz_manager.dec(shift);
-                }
-                m_mpz_manager.del(shift);
+                const mpz & shift = m_tracker.get_value(args[1]);
+                if (m_mpz_manager.is_uint(shift) && m_mpz_manager.get_uint(shift) < m_bv_util.get_bv_size(args[0]))
+                    m_mpz_manager.machine_div2k(m_tracker.get_value(args[0]), m_mpz_manager.get_uint(shift), result);
                 break;
             }
             case OP_BSHL: {
                 SASSERT(n_args == 2);
-                m_mpz_manager.set(result, m_tracker.get_value(args[0]));                
-                mpz shift; m_mpz_manager.set(shift, m_tracker.get_value(args[1]));
-                while (!m_mpz_manager.is_zero(shift)) {
-                    m_mpz_manager.mul(result, m_two, result);
-                    m_mpz_manager.dec(shift);
+                const mpz & shift = m_tracker.get_value(args[1]);
+                unsigned bv_sz = m_bv_util.get_bv_size(n);
+                if (m_mpz_manager.is_uint(shift) && m_mpz_manager.get_uint(shift) < bv_sz) {
+                    m_mpz_manager.mul2k(m_tracker.get_value(args[0]), m_mpz_manager.get_uint(shift), result);
+                    m_mpz_manager.rem(result, m_powers(bv_sz), result);
                 }
-                const mpz & p = m_powers(m_bv_util.get_bv_size(n));
-                m_mpz_manager.rem(result, p, result);
-                m_mpz_manager.del(shift);                    
                 break;
             }
             case OP_SIGN_EXT: {
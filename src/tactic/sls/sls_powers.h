@@ -9,6 +9,10 @@ Abstract:
 
     Power-of-2 module for SLS
 
+    Bit-vectors of at most 64 bits are small mpz numerals, and the SLS
+    engine evaluates them directly on uint64 words. The static helpers
+    below produce the masks and signed interpretations for that case.
+
 Author:
 
     Christoph (cwinter) 2012-02-29
@@ -21,6 +25,7 @@ Notes:
 #define _SLS_POWERS_H_
 
 #include"mpz.h"
+#include"util.h"
 
 class powers : public u_map<mpz*> {
     unsynch_mpz_manager & m;
@@ -44,6 +49,22 @@ public:
             return *new_obj;
         }
     }
+
+    static bool is_word(unsigned n) { return n <= 64; }
+
+    // 2^n - 1, for 0 < n <= 64
+    static uint64 mask(unsigned n) {
+        SASSERT(0 < n && n <= 64);
+        return n == 64 ? UINT64_MAX : (static_cast<uint64>(1) << n) - 1;
+    }
+
+    // Two's complement interpretation of the n-bit vector v.
+    static int64 to_signed(uint64 v, unsigned n) {
+        SASSERT(0 < n && n <= 64);
+        if (n < 64 && (v >> (n - 1)) != 0)
+            v |= ~mask(n);
+        return static_cast<int64>(v);
+    }
 };  
 
 #endif
\ No newline at end of file
@@ -26,6 +26,9 @@ Notes:
 #include"elim_uncnstr_tactic.h"
 #include"nnf_tactic.h"
 #include"stopwatch.h"
+#include"ast_translation.h"
+#include"scoped_ptr_vector.h"
+#include"z3_omp.h"
 #include"sls_tactic.h"
 #include"sls_params.hpp"
 #include"sls_engine.h"
@@ -34,6 +37,122 @@ class sls_tactic : public tactic {
     ast_manager    & m;
     params_ref       m_params;
     sls_engine     * m_engine;
+    ptr_vector<sls_engine> m_walkers;   // engines of a parallel run, protected by tactic_cancel
+    statistics       m_walker_stats;    // statistics of all walkers of the last parallel run
+
+    static void collect_engine_statistics(sls_engine::stats const & stats, statistics & st) {
+        double seconds = stats.m_stopwatch.get_current_seconds();            
+        st.update("sls restarts", stats.m_restarts);
+        st.update("sls full evals", stats.m_full_evals);
+        st.update("sls incr evals", stats.m_incr_evals);
+        st.update("sls incr evals/sec", stats.m_incr_evals / seconds);
+        st.update("sls FLIP moves", stats.m_flips);
+        st.update("sls INC moves", stats.m_incs);
+        st.update("sls DEC moves", stats.m_decs);
+        st.update("sls INV moves", stats.m_invs);
+        st.update("sls moves", stats.m_moves);
+        st.update("sls moves/sec", stats.m_moves / seconds);
+    }
+
+    /**
+       \brief Parameters of walker i: all walkers use a different seed, and
+       odd/even pairs alternate the restart initialization and unsat scaling.
+    */
+    params_ref walker_params(unsigned i) {
+        sls_params p(m_params);
+        params_ref r(m_params);
+        r.set_uint("random_seed", p.random_seed() + i);
+        if (i % 2 == 1)
+            r.set_bool("restart_init", !p.restart_init());
+        if (i % 4 >= 2)
+            r.set_double("scale_unsat", p.scale_unsat() / 2);
+        return r;
+    }
+
+    /**
+       \brief Run K walkers on translated copies of g, the first one that
+       satisfies all assertions cancels the others.
+    */
+    void run_parallel(unsigned num_walkers, goal_ref const & g, model_converter_ref & mc) {
+        scoped_ptr_vector<ast_manager> managers;
+        goal_ref_vector                copies;
+        scoped_ptr_vector<sls_engine>  engines;
+        sls_engine::shared_assignment  shared;
+        for (unsigned i = 0; i < num_walkers; i++) {
+            ast_manager * new_m = alloc(ast_manager, m, !m.proof_mode());
+            managers.push_back(new_m);
+            ast_translation translator(m, *new_m);
+            copies.push_back(g->translate(translator));
+            sls_engine * e = alloc(sls_engine, *new_m, walker_params(i));
+            e->set_shared_assignment(&shared);
+            engines.push_back(e);
+        }
+        #pragma omp critical (tactic_cancel)
+        {
+            for (unsigned i = 0; i < num_walkers; i++)
+                m_walkers.push_back(engines[i]);
+        }
+
+        unsigned    finished_id = UINT_MAX;
+        bool        failed      = false;
+        std::string ex_msg;
+
+        #pragma omp parallel for num_threads(num_walkers)
+        for (int i = 0; i < static_cast<int>(num_walkers); i++) {
+            model_converter_ref _mc;
+            goal_ref in_copy = copies[i];
+            try {
+                (*engines[i])(in_copy, _mc);
+                if (in_copy->size() == 0) {
+                    bool first = false;
+                    #pragma omp critical (sls_tactic)
+                    {
+                        if (finished_id == UINT_MAX) {
+                            finished_id = i;
+                            first = true;
+                        }
+                    }
+                    if (first) {
+                        for (unsigned j = 0; j < num_walkers; j++)
+                            if (static_cast<unsigned>(i) != j)
+                                engines[j]->cancel();
+                        ast_translation translator(*(managers[i]), m, false);
+                        mc = _mc ? _mc->translate(translator) : 0;
+                    }
+                }
+            }
+            catch (z3_exception & ex) {
+                #pragma omp critical (sls_tactic)
+                {
+                    if (!failed) {
+                        failed = true;
+                        ex_msg = ex.msg();
+                    }
+                }
+            }
+        }
+
+        #pragma omp critical (tactic_cancel)
+        {
+            m_walkers.reset();
+        }
+        m_walker_stats.reset();
+        for (unsigned i = 0; i < num_walkers; i++)
+            collect_engine_statistics(engines[i]->get_stats(), m_walker_stats);
+        IF_VERBOSE(1, verbose_stream() << "(sls :walkers " << num_walkers << " :winner ";
+                   if (finished_id == UINT_MAX) verbose_stream() << "none"; else verbose_stream() << finished_id;
+                   verbose_stream() << ")" << std::endl;);
+
+        if (finished_id != UINT_MAX) {
+            g->reset();
+        }
+        else {
+            mc = 0;
+            // a walker only fails when it is canceled or runs out of resources.
+            if (failed)
+                throw tactic_exception(ex_msg.c_str());
+        }
+    }
 
 public:
     sls_tactic(ast_manager & _m, params_ref const & p):
@@ -70,7 +189,17 @@ public:
         TRACE("sls", g->display(tout););
         tactic_report report("sls", *g);
         
-        m_engine->operator()(g, mc);
+        unsigned num_walkers = sls_params(m_params).threads();
+        bool use_seq = num_walkers <= 1 || g->inconsistent();
+#ifdef _NO_OMP_
+        use_seq = true;
+#else
+        use_seq = use_seq || 0 != omp_in_parallel();
+#endif
+        if (use_seq)
+            m_engine->operator()(g, mc);
+        else
+            run_parallel(num_walkers, g, mc);
 
         g->inc_depth();
         result.push_back(g.get());
@@ -88,27 +217,23 @@ public:
     }
     
     virtual void collect_statistics(statistics & st) const {
-        sls_engine::stats const & stats = m_engine->get_stats();
-        double seconds = stats.m_stopwatch.get_current_seconds();            
-        st.update("sls restarts", stats.m_restarts);
-        st.update("sls full evals", stats.m_full_evals);
-        st.update("sls incr evals", stats.m_incr_evals);
-        st.update("sls incr evals/sec", stats.m_incr_evals / seconds);
-        st.update("sls FLIP moves", stats.m_flips);
-        st.update("sls INC moves", stats.m_incs);
-        st.update("sls DEC moves", stats.m_decs);
-        st.update("sls INV moves", stats.m_invs);
-        st.update("sls moves", stats.m_moves);
-        st.update("sls moves/sec", stats.m_moves / seconds);
+        if (m_walker_stats.size() > 0)
+            st.copy(m_walker_stats); // rates are summed over the walkers
+        else
+            collect_engine_statistics(m_engine->get_stats(), st);
     }
 
     virtual void reset_statistics() {
         m_engine->reset_statistics();
+        m_walker_stats.reset();
     }
 
     virtual void set_cancel(bool f) {
         if (m_engine)
             m_engine->set_cancel(f);
+        // tactic::cancel() already holds the tactic_cancel lock.
+        for (unsigned i = 0; i < m_walkers.size(); i++)
+            m_walkers[i]->set_cancel(f);
     }
 };
 
@@ -23,6 +23,8 @@ Notes:
 class ast_manager;
 class tactic;
 
+tactic * mk_sls_tactic(ast_manager & m, params_ref const & p = params_ref());
+
 tactic * mk_qfbv_sls_tactic(ast_manager & m, params_ref const & p = params_ref());
 
 /*
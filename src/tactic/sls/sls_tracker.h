@@ -66,8 +66,10 @@ public:
     typedef obj_map<func_decl, expr* > entry_point_type;
 
 private:
-    typedef obj_map<expr, value_score> scores_type;    
-    typedef obj_map<expr, ptr_vector<expr> > uplinks_type;    
+    // The score table and the uplinks are indexed by expression ids,
+    // they are consulted for every node that is re-evaluated.
+    typedef vector<value_score> scores_type;    
+    typedef vector<ptr_vector<expr> > uplinks_type;    
     typedef obj_map<expr, ptr_vector<func_decl> > occ_type;
     obj_hashtable<expr>	  m_top_expr;
     scores_type           m_scores;
@@ -164,9 +166,13 @@ public:
         return m_top_sum;
     }
 
+    inline bool has_score(expr * n) {
+        return n->get_id() < m_scores.size() && m_scores[n->get_id()].m != 0;
+    }
+
     inline void set_value(expr * n, const mpz & r) {
-        SASSERT(m_scores.contains(n));
-        m_mpz_manager.set(m_scores.find(n).value, r);
+        SASSERT(has_score(n));
+        m_mpz_manager.set(m_scores[n->get_id()].value, r);
     }
 
     inline void set_value(func_decl * fd, const mpz & r) {
@@ -176,8 +182,8 @@ public:
     }
 
     inline mpz & get_value(expr * n) {            
-        SASSERT(m_scores.contains(n));
-        return m_scores.find(n).value;
+        SASSERT(has_score(n));
+        return m_scores[n->get_id()].value;
     }
 
     inline mpz & get_value(func_decl * fd) {
@@ -187,8 +193,8 @@ public:
     }        
 
     inline void set_score(expr * n, double score) {
-        SASSERT(m_scores.contains(n));
-        m_scores.find(n).score = score;
+        SASSERT(has_score(n));
+        m_scores[n->get_id()].score = score;
     }
 
     inline void set_score(func_decl * fd, double score) {            
@@ -198,8 +204,8 @@ public:
     }
 
     inline double & get_score(expr * n) {
-        SASSERT(m_scores.contains(n));
-        return m_scores.find(n).score;
+        SASSERT(has_score(n));
+        return m_scores[n->get_id()].score;
     }
 
     inline double & get_score(func_decl * fd) {
@@ -209,33 +215,33 @@ public:
     }
 
     inline void set_score_prune(expr * n, double score) {
-        SASSERT(m_scores.contains(n));
-        m_scores.find(n).score_prune = score;
+        SASSERT(has_score(n));
+        m_scores[n->get_id()].score_prune = score;
     }
 
     inline double & get_score_prune(expr * n) {
-        SASSERT(m_scores.contains(n));
-        return m_scores.find(n).score_prune;
+        SASSERT(has_score(n));
+        return m_scores[n->get_id()].score_prune;
     }
 
     inline unsigned has_pos_occ(expr * n) {
-        SASSERT(m_scores.contains(n));
-        return m_scores.find(n).has_pos_occ;
+        SASSERT(has_score(n));
+        return m_scores[n->get_id()].has_pos_occ;
     }
 
     inline unsigned has_neg_occ(expr * n) {
-        SASSERT(m_scores.contains(n));
-        return m_scores.find(n).has_neg_occ;
+        SASSERT(has_score(n));
+        return m_scores[n->get_id()].has_neg_occ;
     }
 
     inline unsigned get_distance(expr * n) {
-        SASSERT(m_scores.contains(n));
-        return m_scores.find(n).distance;
+        SASSERT(has_score(n));
+        return m_scores[n->get_id()].distance;
     }
 
     inline void set_distance(expr * n, unsigned d) {
-        SASSERT(m_scores.contains(n));
-        m_scores.find(n).distance = d;
+        SASSERT(has_score(n));
+        m_scores[n->get_id()].distance = d;
     }
 
     inline expr * get_entry_point(func_decl * fd) {
@@ -248,7 +254,7 @@ public:
     }
 
     inline bool has_uplinks(expr * n) {
-        return m_uplinks.contains(n);
+        return n->get_id() < m_uplinks.size() && !m_uplinks[n->get_id()].empty();
     }
 
     inline bool is_top_expr(expr * n) {
@@ -256,8 +262,8 @@ public:
     }
 
     inline ptr_vector<expr> & get_uplinks(expr * n) {
-        SASSERT(m_uplinks.contains(n));
-        return m_uplinks.find(n);
+        SASSERT(has_uplinks(n));
+        return m_uplinks[n->get_id()];
     }
 
     inline void ucb_forget(ptr_vector<expr> & as) {
@@ -269,9 +275,9 @@ public:
             for (unsigned i = 0; i < as.size(); i++)
             {
                 e = as[i];
-                touched_old = m_scores.find(e).touched;
+                touched_old = m_scores[e->get_id()].touched;
                 touched_new = (unsigned)((touched_old - 1) * m_ucb_forget + 1);
-                m_scores.find(e).touched = touched_new;
+                m_scores[e->get_id()].touched = touched_new;
                 m_touched += touched_new - touched_old;
             }
         }
@@ -279,18 +285,17 @@ public:
 
     void initialize(app * n) {
         // Build score table
-        if (!m_scores.contains(n)) {
-            value_score vs;
-            vs.m = & m_mpz_manager;
-            m_scores.insert(n, vs);
+        if (!has_score(n)) {
+            m_scores.reserve(n->get_id() + 1);
+            m_scores[n->get_id()].m = & m_mpz_manager;
         }
 
         // Update uplinks
         unsigned na = n->get_num_args();
         for (unsigned i = 0; i < na; i++) {
             expr * c = n->get_arg(i); 
-            uplinks_type::obj_map_entry * entry = m_uplinks.insert_if_not_there2(c, ptr_vector<expr>());
-            entry->get_data().m_value.push_back(n);
+            m_uplinks.reserve(c->get_id() + 1);
+            m_uplinks[c->get_id()].push_back(n);
         }
 
         func_decl * d = n->get_decl();
@@ -546,6 +551,15 @@ public:
         unsigned bv_size = m_bv_util.get_bv_size(s);
         mpz r; m_mpz_manager.set(r, 0);            
 
+        if (powers::is_word(bv_size)) {
+            uint64 w = 0;
+            do {
+                w = (w << 1) | m_mpz_manager.get_uint64(get_random_bool());
+            } while (--bv_size > 0);
+            m_mpz_manager.set(r, w);
+            return r;
+        }
+
         mpz temp;
         do
         {                
@@ -655,15 +669,32 @@ public:
             else
             {
                 if (negated)
-                    m_scores.find(n).has_neg_occ = 1;
+                    m_scores[n->get_id()].has_neg_occ = 1;
                 else
-                    m_scores.find(n).has_pos_occ = 1;
+                    m_scores[n->get_id()].has_pos_occ = 1;
             }
         }
         else
             NOT_IMPLEMENTED_YET();
     }
 
+    // Comparisons of less than 64 bits are scored on machine words: the distance
+    // between the arguments and 2^bv_sz fit into an int64.
+    bool is_small_cmp(expr * n) {
+        return m_bv_util.get_bv_size(to_app(n)->get_decl()->get_domain()[0]) < 64;
+    }
+
+    // Score of x <= y (x < y if strict) for unsigned bv_sz-bit values.
+    double cmp_score(uint64 x, uint64 y, bool strict, unsigned bv_sz) {
+        if (strict ? x < y : x <= y)
+            return 1.0;
+        uint64 diff = x - y;
+        if (strict)
+            diff++;
+        double dbl = ldexp(static_cast<double>(diff), -static_cast<int>(bv_sz));
+        return (dbl > 1.0) ? 0.0 : (dbl < 0.0) ? 1.0 : 1.0 - dbl;
+    }
+
     double score_bool(expr * n, bool negated = false) {
         TRACE("sls_score", tout << ((negated)?"NEG ":"") << "BOOL: " << mk_ismt2_pp(n, m_manager) << std::endl; );
 
@@ -730,6 +761,16 @@ public:
                 TRACE("sls_score", tout << "V0 = " << m_mpz_manager.to_string(v0) << " ; V1 = " << 
                                         m_mpz_manager.to_string(v1) << std::endl; );
             }
+            else if (m_bv_util.is_bv(arg0) && powers::is_word(m_bv_util.get_bv_size(arg0))) {
+                uint64 diff = m_mpz_manager.get_uint64(v0) ^ m_mpz_manager.get_uint64(v1);
+                unsigned hamming_distance = get_num_1bits(static_cast<unsigned>(diff)) + 
+                                            get_num_1bits(static_cast<unsigned>(diff >> 32));
+                unsigned bv_sz = m_bv_util.get_bv_size(arg0);
+                res = 1.0 - (hamming_distance / (double) bv_sz);
+                TRACE("sls_score", tout << "V0 = " << m_mpz_manager.to_string(v0) << " ; V1 = " << 
+                                        m_mpz_manager.to_string(v1) << " ; HD = " << hamming_distance << 
+                                        " ; SZ = " << bv_sz << std::endl; );                    
+            }
             else if (m_bv_util.is_bv(arg0)) {
                 mpz diff, diff_m1;
                 m_mpz_manager.bitwise_xor(v0, v1, diff);
@@ -752,6 +793,13 @@ public:
             else
                 NOT_IMPLEMENTED_YET();
         }            
+        else if (m_bv_util.is_bv_ule(n) && is_small_cmp(n)) { // x <= y
+            app * a = to_app(n);
+            unsigned bv_sz = m_bv_util.get_bv_size(a->get_decl()->get_domain()[0]);
+            uint64 x = m_mpz_manager.get_uint64(get_value(a->get_arg(0)));
+            uint64 y = m_mpz_manager.get_uint64(get_value(a->get_arg(1)));
+            res = negated ? cmp_score(y, x, true, bv_sz) : cmp_score(x, y, false, bv_sz);
+        }
         else if (m_bv_util.is_bv_ule(n)) { // x <= y
             app * a = to_app(n);
             SASSERT(a->get_num_args() == 2);
@@ -790,6 +838,18 @@ public:
             TRACE("sls_score", tout << "x = " << m_mpz_manager.to_string(x) << " ; y = " << 
                                     m_mpz_manager.to_string(y) << " ; SZ = " << bv_sz << std::endl; );
         }
+        else if (m_bv_util.is_bv_sle(n) && is_small_cmp(n)) { // x <= y
+            app * a = to_app(n);
+            unsigned bv_sz = m_bv_util.get_bv_size(a->get_decl()->get_domain()[0]);
+            int64 x = powers::to_signed(m_mpz_manager.get_uint64(get_value(a->get_arg(0))), bv_sz);
+            int64 y = powers::to_signed(m_mpz_manager.get_uint64(get_value(a->get_arg(1))), bv_sz);
+            // shifting by 2^(bv_sz-1) maps the signed order onto the unsigned one.
+            uint64 ux = static_cast<uint64>(x) + (static_cast<uint64>(1) << (bv_sz - 1));
+            uint64 uy = static_cast<uint64>(y) + (static_cast<uint64>(1) << (bv_sz - 1));
+            ux &= powers::mask(bv_sz);
+            uy &= powers::mask(bv_sz);
+            res = negated ? cmp_score(uy, ux, true, bv_sz) : cmp_score(ux, uy, false, bv_sz);
+        }
         else if (m_bv_util.is_bv_sle(n)) { // x <= y
             app * a = to_app(n);
             SASSERT(a->get_num_args() == 2);
@@ -1011,7 +1071,7 @@ public:
                 expr * e = as[i];
                 if (m_mpz_manager.neq(get_value(e), m_one))
                 {
-                    vscore = m_scores.find(e);
+                    vscore = m_scores[e->get_id()];
                     // Andreas: Select the assertion with the greatest ucb score. Potentially add some noise.
                     // double q = vscore.score + m_ucb_constant * sqrt(log((double)m_touched) / vscore.touched);
                     double q = vscore.score + m_ucb_constant * sqrt(log((double)m_touched) / vscore.touched) + m_ucb_noise * get_random_uint(8); 
@@ -1022,10 +1082,10 @@ public:
                 return 0;
 
             m_touched++;
-            m_scores.find(as[pos]).touched++;
+            m_scores[as[pos]->get_id()].touched++;
             // Andreas: Also part of track_unsat data structures. Additionally disable the previous line!
             /* m_last_pos = pos;
-            m_scores.find(m_list_false[pos]).touched++;
+            m_scores[m_list_false[pos]->get_id()].touched++;
             return m_list_false[pos]; */
         }
         else
@@ -20,6 +20,11 @@ Revision History:
 #include"bit_blaster.h"
 #include"ast_pp.h"
 #include"ast_ll_pp.h"
+#include"reg_decl_plugins.h"
+#include"obj_hashtable.h"
+#include"statistics.h"
+#include"bit_blaster_params.h"
+#include"util.h"
 
 void mk_bits(ast_manager & m, char const * prefix, unsigned sz, expr_ref_vector & r) {
     sort_ref b(m);
@@ -113,7 +118,151 @@ void tst_sh(ast_manager & m, unsigned sz) {
 //     TRACE("bit_blaster", tout << "ashr " << c.size() << "\n"; display(tout, c, false););
 }
 
+// value of the Boolean circuit e when the atoms in val are assigned.
+static bool eval_bit(ast_manager & m, obj_map<expr, bool> & val, expr * e) {
+    ptr_buffer<expr> todo;
+    todo.push_back(e);
+    while (!todo.empty()) {
+        expr * t = todo.back();
+        if (val.contains(t)) {
+            todo.pop_back();
+            continue;
+        }
+        app * a = to_app(t);
+        bool visited = true;
+        for (unsigned i = 0; i < a->get_num_args(); i++) {
+            if (!val.contains(a->get_arg(i))) {
+                todo.push_back(a->get_arg(i));
+                visited = false;
+            }
+        }
+        if (!visited)
+            continue;
+        todo.pop_back();
+        bool r;
+        if (m.is_true(a))
+            r = true;
+        else if (m.is_false(a))
+            r = false;
+        else if (m.is_not(a))
+            r = !val.find(a->get_arg(0));
+        else if (m.is_ite(a))
+            r = val.find(a->get_arg(0)) ? val.find(a->get_arg(1)) : val.find(a->get_arg(2));
+        else if (m.is_eq(a) || m.is_iff(a))
+            r = val.find(a->get_arg(0)) == val.find(a->get_arg(1));
+        else {
+            bool is_and = m.is_and(a), is_or = m.is_or(a), is_xor = m.is_xor(a);
+            VERIFY(is_and || is_or || is_xor);
+            r = is_and;
+            for (unsigned i = 0; i < a->get_num_args(); i++) {
+                bool v = val.find(a->get_arg(i));
+                if (is_and) r = r && v;
+                else if (is_or) r = r || v;
+                else r = r != v;
+            }
+        }
+        val.insert(t, r);
+    }
+    return val.find(e);
+}
+
+// value of the circuit bits when the input bits a and b are assigned to the given values.
+static uint64 eval_bits(ast_manager & m, expr_ref_vector const & bits, 
+                        expr_ref_vector const & a, uint64 va, expr_ref_vector const & b, uint64 vb) {
+    obj_map<expr, bool> val;
+    for (unsigned i = 0; i < a.size(); i++) {
+        val.insert(a[i], (va & (1ull << i)) != 0);
+        val.insert(b[i], (vb & (1ull << i)) != 0);
+    }
+    uint64 r = 0;
+    for (unsigned i = 0; i < bits.size(); i++) {
+        if (eval_bit(m, val, bits[i]))
+            r |= (1ull << i);
+    }
+    return r;
+}
+
+// The second multiplier and divider on new input bits are instantiated from the cache.
+static void tst_circuit_cache(unsigned sz) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bit_blaster_params p;
+    p.m_bb_circuit_cache = true;
+    bit_blaster blaster(m, p);
+    expr_ref_vector a1(m), b1(m), a2(m), b2(m), mul1(m), mul2(m), q(m), r(m);
+    mk_bits(m, "a", sz, a1);
+    mk_bits(m, "b", sz, b1);
+    mk_bits(m, "c", sz, a2);
+    mk_bits(m, "d", sz, b2);
+    blaster.mk_multiplier(sz, a1.c_ptr(), b1.c_ptr(), mul1);
+    blaster.mk_multiplier(sz, a2.c_ptr(), b2.c_ptr(), mul2);
+    blaster.mk_udiv_urem(sz, a1.c_ptr(), b1.c_ptr(), q, r);
+    q.reset();
+    r.reset();
+    blaster.mk_udiv_urem(sz, a2.c_ptr(), b2.c_ptr(), q, r);
+    statistics st;
+    blaster.collect_statistics(st);
+    IF_VERBOSE(2, st.display_smt2(verbose_stream()););
+    unsigned mask = (1 << sz) - 1;
+    for (unsigned va = 0; va <= mask; va += 3) {
+        for (unsigned vb = 1; vb <= mask; vb += 2) {
+            VERIFY(eval_bits(m, mul2, a2, va, b2, vb) == ((va * vb) & mask));
+            VERIFY(eval_bits(m, q, a2, va, b2, vb) == va / vb);
+            VERIFY(eval_bits(m, r, a2, va, b2, vb) == va % vb);
+        }
+    }
+}
+
+// Check the multiplier and divider encodings on all pairs of sz-bit values, or on
+// num_samples random pairs if num_samples is not 0.
+static void tst_encodings(unsigned sz, unsigned num_samples) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    expr_ref_vector a(m), b(m);
+    mk_bits(m, "a", sz, a);
+    mk_bits(m, "b", sz, b);
+    uint64 mask = sz == 64 ? UINT64_MAX : (1ull << sz) - 1;
+    svector<std::pair<uint64, uint64> > inputs;
+    if (num_samples == 0) {
+        for (uint64 va = 0; va <= mask; va++)
+            for (uint64 vb = 0; vb <= mask; vb++)
+                inputs.push_back(std::make_pair(va, vb));
+    }
+    else {
+        random_gen rand(sz);
+        inputs.push_back(std::make_pair(mask, mask));
+        inputs.push_back(std::make_pair(mask, 0ull));
+        for (unsigned i = 0; i < num_samples; i++) {
+            uint64 va = ((static_cast<uint64>(rand()) << 30) ^ (static_cast<uint64>(rand()) << 15) ^ rand()) & mask;
+            uint64 vb = ((static_cast<uint64>(rand()) << 30) ^ (static_cast<uint64>(rand()) << 15) ^ rand()) & mask;
+            // small divisors
+            if (i % 4 == 0)
+                vb &= 0xff;
+            inputs.push_back(std::make_pair(va, vb));
+        }
+    }
+    for (unsigned mul = BB_MUL_ARRAY; mul <= BB_MUL_KARATSUBA; mul++) {
+        bit_blaster_params p;
+        p.m_bb_mul_encoding = static_cast<bb_mul_encoding>(mul);
+        p.m_bb_div_encoding = mul % 2 == 0 ? BB_DIV_RESTORING : BB_DIV_NON_RESTORING;
+        bit_blaster blaster(m, p);
+        expr_ref_vector prod(m), q(m), r(m);
+        blaster.mk_multiplier(sz, a.c_ptr(), b.c_ptr(), prod);
+        blaster.mk_udiv_urem(sz, a.c_ptr(), b.c_ptr(), q, r);
+        for (unsigned i = 0; i < inputs.size(); i++) {
+            uint64 va = inputs[i].first, vb = inputs[i].second;
+            VERIFY(eval_bits(m, prod, a, va, b, vb) == ((va * vb) & mask));
+            VERIFY(eval_bits(m, q, a, va, b, vb) == (vb == 0 ? mask : va / vb));
+            VERIFY(eval_bits(m, r, a, va, b, vb) == (vb == 0 ? va : va % vb));
+        }
+    }
+}
+
 void tst_bit_blaster() {
+    tst_circuit_cache(4);
+    tst_encodings(4, 0);
+    tst_encodings(17, 40);
+    tst_encodings(40, 20);
     ast_manager m;
     tst_adder(m, 4);
     tst_multiplier(m, 4);
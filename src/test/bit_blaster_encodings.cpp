@@ -0,0 +1,143 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    bit_blaster_encodings.cpp
+
+Abstract:
+
+    Compare the multiplier and divider encodings of the bit-blaster
+    on arithmetic kernels: number of clauses, conflicts and SAT time.
+
+    Usage: test bit_blaster_encodings [width] [kernel]
+
+Author:
+
+Revision History:
+
+--*/
+#include"smt_context.h"
+#include"reg_decl_plugins.h"
+#include"bv_decl_plugin.h"
+#include"bit_blaster_params.h"
+#include"statistics.h"
+#include"stopwatch.h"
+#include<iomanip>
+
+static char const * g_mul_names[] = { "array", "wallace", "dadda", "karatsuba" };
+static char const * g_div_names[] = { "restoring", "non-restoring" };
+
+// All kernels are unsatisfiable, except for factor. The kernels are not preprocessed, so that
+// the rewriter does not normalize the products and the divisions by non-zero divisors.
+static void mk_kernel(ast_manager & m, char const * name, unsigned sz, expr_ref & fml) {
+    bv_util bv(m);
+    sort_ref s(bv.mk_sort(sz), m);
+    expr_ref x(m.mk_const(symbol("x"), s), m);
+    expr_ref y(m.mk_const(symbol("y"), s), m);
+    expr_ref z(m.mk_const(symbol("z"), s), m);
+    expr_ref zero(bv.mk_numeral(rational(0), sz), m);
+    expr_ref one(bv.mk_numeral(rational(1), sz), m);
+    if (strcmp(name, "distrib") == 0) {
+        // x*(y + z) != x*y + x*z
+        fml = m.mk_not(m.mk_eq(bv.mk_bv_mul(x, bv.mk_bv_add(y, z)), bv.mk_bv_add(bv.mk_bv_mul(x, y), bv.mk_bv_mul(x, z))));
+    }
+    else if (strcmp(name, "square") == 0) {
+        // (x + y)*(x + y) != x*x + 2*x*y + y*y
+        expr_ref s1(bv.mk_bv_add(x, y), m), two(bv.mk_numeral(rational(2), sz), m);
+        expr_ref rhs(bv.mk_bv_add(bv.mk_bv_mul(x, x), bv.mk_bv_add(bv.mk_bv_mul(two, bv.mk_bv_mul(x, y)), bv.mk_bv_mul(y, y))), m);
+        fml = m.mk_not(m.mk_eq(bv.mk_bv_mul(s1, s1), rhs));
+    }
+    else if (strcmp(name, "factor") == 0) {
+        // x*y = c for a product c of two odd numbers of half width, and 1 < x, y < 2^(sz/2)
+        unsigned h = sz / 2;
+        rational p = rational::power_of_two(h) - rational(1);
+        rational q = rational::power_of_two(h - 1) + rational(1);
+        expr_ref c(bv.mk_numeral(p * q, sz), m);
+        expr_ref bound(bv.mk_numeral(rational::power_of_two(h), sz), m);
+        fml = m.mk_and(m.mk_eq(bv.mk_bv_mul(x, y), c),
+                       m.mk_and(m.mk_not(bv.mk_ule(x, one)), m.mk_not(bv.mk_ule(y, one))),
+                       m.mk_and(m.mk_not(bv.mk_ule(bound, x)), m.mk_not(bv.mk_ule(bound, y))));
+    }
+    else if (strcmp(name, "div_identity") == 0) {
+        // y != 0 and (x udiv y)*y + (x urem y) != x
+        expr_ref q(m.mk_app(bv.get_fid(), OP_BUDIV_I, x, y), m), r(m.mk_app(bv.get_fid(), OP_BUREM_I, x, y), m);
+        fml = m.mk_and(m.mk_not(m.mk_eq(y, zero)), m.mk_not(m.mk_eq(bv.mk_bv_add(bv.mk_bv_mul(q, y), r), x)));
+    }
+    else {
+        // y != 0 and y <= (x urem y)
+        SASSERT(strcmp(name, "rem_bound") == 0);
+        fml = m.mk_and(m.mk_not(m.mk_eq(y, zero)), bv.mk_ule(y, m.mk_app(bv.get_fid(), OP_BUREM_I, x, y)));
+    }
+}
+
+static unsigned get_stat(statistics const & st, char const * key) {
+    for (unsigned i = 0; i < st.size(); i++)
+        if (strcmp(st.get_key(i), key) == 0)
+            return st.get_uint_value(i);
+    return 0;
+}
+
+static lbool solve(char const * name, unsigned sz, unsigned mul, unsigned div, unsigned max_conflicts,
+                   unsigned & clauses, unsigned & conflicts, double & seconds) {
+    smt_params params;
+    params.m_preprocess       = false;
+    params.m_max_conflicts    = max_conflicts;
+    params.m_bb_mul_encoding  = static_cast<bb_mul_encoding>(mul);
+    params.m_bb_div_encoding  = static_cast<bb_div_encoding>(div);
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt::context ctx(m, params);
+    expr_ref fml(m);
+    mk_kernel(m, name, sz, fml);
+    ctx.assert_expr(fml);
+    stopwatch sw;
+    sw.start();
+    lbool r = ctx.check();
+    sw.stop();
+    statistics st;
+    ctx.collect_statistics(st);
+    clauses   = get_stat(st, "mk clause");
+    conflicts = get_stat(st, "conflicts");
+    seconds   = sw.get_seconds();
+    return r;
+}
+
+// The clauses are counted before the first conflict, that is, they are the clauses of the circuits.
+static void run_kernel(char const * name, unsigned sz, unsigned mul, unsigned div) {
+    unsigned clauses, conflicts, ignore;
+    double seconds;
+    solve(name, sz, mul, div, 0, clauses, ignore, seconds);
+    lbool r = solve(name, sz, mul, div, UINT_MAX, ignore, conflicts, seconds);
+    VERIFY(r == (strcmp(name, "factor") == 0 ? l_true : l_false));
+    std::cout << std::setw(14) << name << std::setw(11) << g_mul_names[mul] << std::setw(15) << g_div_names[div]
+              << std::setw(10) << clauses << std::setw(11) << conflicts
+              << std::setw(10) << std::fixed << std::setprecision(3) << seconds << "\n";
+}
+
+void tst_bit_blaster_encodings(char ** argv, int argc, int & i) {
+    unsigned sz = 6;
+    char const * only = 0;
+    if (i + 1 < argc) {
+        sz = atoi(argv[i+1]);
+        i += 1;
+    }
+    if (i + 1 < argc) {
+        only = argv[i+1];
+        i += 1;
+    }
+    if (sz < 4)
+        sz = 4;
+    std::cout << std::setw(14) << "kernel" << std::setw(11) << "mul" << std::setw(15) << "div"
+              << std::setw(10) << "clauses" << std::setw(11) << "conflicts" << std::setw(10) << "time" << "\n";
+    char const * mul_kernels[] = { "distrib", "square", "factor" };
+    for (unsigned k = 0; k < 3; k++)
+        for (unsigned mul = BB_MUL_ARRAY; mul <= BB_MUL_KARATSUBA; mul++)
+            if (!only || strcmp(only, mul_kernels[k]) == 0)
+                run_kernel(mul_kernels[k], sz, mul, BB_DIV_RESTORING);
+    char const * div_kernels[] = { "div_identity", "rem_bound" };
+    for (unsigned k = 0; k < 2; k++)
+        for (unsigned div = BB_DIV_RESTORING; div <= BB_DIV_NON_RESTORING; div++)
+            if (!only || strcmp(only, div_kernels[k]) == 0)
+                run_kernel(div_kernels[k], sz, BB_MUL_ARRAY, div);
+}
@@ -0,0 +1,116 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    cube_and_conquer.cpp
+
+Abstract:
+
+    Test solver::cube and the cube and conquer driver.
+
+Author:
+
+Revision History:
+
+--*/
+#include"cube_and_conquer.h"
+#include"smt_solver.h"
+#include"reg_decl_plugins.h"
+#include"task_pool.h"
+
+// pigeon i is in one of the holes, and there is at most one pigeon in each hole.
+static void mk_pigeon_hole(ast_manager & m, unsigned num_pigeons, unsigned num_holes, expr_ref_vector & fmls) {
+    expr_ref_vector ps(m);
+    for (unsigned i = 0; i < num_pigeons; i++) {
+        for (unsigned j = 0; j < num_holes; j++) {
+            std::stringstream strm;
+            strm << "p_" << i << "_" << j;
+            ps.push_back(m.mk_const(symbol(strm.str().c_str()), m.mk_bool_sort()));
+        }
+    }
+    for (unsigned i = 0; i < num_pigeons; i++)
+        fmls.push_back(m.mk_or(num_holes, ps.c_ptr() + i*num_holes));
+    for (unsigned j = 0; j < num_holes; j++)
+        for (unsigned i = 0; i < num_pigeons; i++)
+            for (unsigned k = i + 1; k < num_pigeons; k++)
+                fmls.push_back(m.mk_or(m.mk_not(ps.get(i*num_holes + j)), m.mk_not(ps.get(k*num_holes + j))));
+}
+
+/**
+   \brief Solve the pigeon hole constraints guarded by the tracked assumption a with cube and conquer.
+   If \c prune, then the constraints are disjoined with x, a guards (x implies z1 and z2), and the
+   tracked assumption b guards (not z1 or not z2), otherwise b guards nothing. In the first case
+   x is a failed literal, so b is needed only to prune the cubes.
+*/
+static lbool check(unsigned num_threads, unsigned num_pigeons, unsigned num_holes, unsigned depth, bool prune) {
+    unsigned old_max = task_pool::get_max_threads();
+    task_pool::set_max_threads(num_threads);
+    ast_manager m;
+    reg_decl_plugins(m);
+    params_ref p;
+    ref<solver> s = mk_smt_solver(m, p, symbol::null);
+    expr_ref_vector fmls(m);
+    mk_pigeon_hole(m, num_pigeons, num_holes, fmls);
+    app_ref a(m.mk_const(symbol("a"), m.mk_bool_sort()), m);
+    app_ref b(m.mk_const(symbol("b"), m.mk_bool_sort()), m);
+    app_ref x(m.mk_const(symbol("x"), m.mk_bool_sort()), m);
+    app_ref z1(m.mk_const(symbol("z1"), m.mk_bool_sort()), m);
+    app_ref z2(m.mk_const(symbol("z2"), m.mk_bool_sort()), m);
+    expr_ref guarded_by_b(m.mk_true(), m);
+    if (prune) {
+        // x, z1 and z2 are internalized first, so lookahead tries x before the pigeons.
+        for (unsigned i = 0; i < fmls.size(); i++)
+            fmls[i] = m.mk_or(fmls.get(i), x);
+        fmls.push_back(m.mk_or(m.mk_not(x), z1));
+        fmls.push_back(m.mk_or(m.mk_not(x), z2));
+        guarded_by_b = m.mk_or(m.mk_not(z1), m.mk_not(z2));
+        s->assert_expr(guarded_by_b, b);
+    }
+    for (unsigned i = fmls.size(); i-- > 0; )
+        s->assert_expr(fmls.get(i), a);
+    if (!prune)
+        s->assert_expr(guarded_by_b, b);
+
+    expr_ref_vector cubes(m);
+    s->cube(depth, cubes);
+    VERIFY(cubes.size() <= (1u << depth));
+
+    simple_check_sat_result result(m);
+    lbool r = cube_and_conquer(*s, m, depth, 0, 0, p, result);
+    task_pool::set_max_threads(old_max);
+    if (r == l_true) {
+        model_ref md;
+        result.get_model(md);
+        VERIFY(md);
+        for (unsigned i = 0; i < fmls.size(); i++) {
+            expr_ref val(m);
+            VERIFY(md->eval(fmls.get(i), val, true) && m.is_true(val));
+        }
+    }
+    else if (r == l_false) {
+        // the core is unsatisfiable, and each assumption occurs once.
+        ptr_vector<expr> core;
+        result.get_unsat_core(core);
+        VERIFY(core.contains(a) && (!prune || core.contains(b)));
+        for (unsigned i = 0; i < core.size(); i++)
+            for (unsigned j = i + 1; j < core.size(); j++)
+                VERIFY(core[i] != core[j]);
+        ref<solver> s2 = mk_smt_solver(m, p, symbol::null);
+        for (unsigned i = 0; i < fmls.size(); i++)
+            s2->assert_expr(m.mk_implies(a, fmls.get(i)));
+        s2->assert_expr(m.mk_implies(b, guarded_by_b));
+        VERIFY(s2->check_sat(core.size(), core.c_ptr()) == l_false);
+    }
+    return r;
+}
+
+void tst_cube_and_conquer() {
+    VERIFY(check(1, 6, 5, 3, false) == l_false);
+    VERIFY(check(4, 6, 5, 3, false) == l_false);
+    VERIFY(check(4, 5, 5, 3, false) == l_true);
+    VERIFY(check(4, 6, 5, 0, false) == l_false);
+    VERIFY(check(1, 6, 5, 3, true) == l_false);
+    VERIFY(check(4, 6, 5, 3, true) == l_false);
+    VERIFY(check(4, 5, 5, 3, true) == l_true);
+}
@@ -4,6 +4,9 @@
 #include "dl_context.h"
 #include "smt_params.h"
 #include "dl_register_engine.h"
+#include "dl_relation_manager.h"
+#include "reg_decl_plugins.h"
+#include "task_pool.h"
 
 using namespace datalog;
 
@@ -66,7 +69,235 @@ void dl_context_saturate_file(params_ref & params, const char * f) {
     std::cerr << "Done\n";
 }
 
+/**
+   \brief Saturate \c program with \c params, and store the sizes of the relations of the
+   \c num_preds predicates in \c sizes. If \c st is not null, the statistics of the engine are
+   stored in it. If \c plugins is not null, the names of the plugins of the relations are
+   stored in it.
+*/
+static void dl_context_saturate_program(params_ref const & params, std::string const & program,
+                                        unsigned num_preds, char const * const * preds,
+                                        unsigned_vector & sizes, statistics * st = 0,
+                                        svector<symbol> * plugins = 0) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt_params fparams;
+    register_engine re;
+    context ctx(m, re, fparams);
+    ctx.updt_params(params);
+
+    parser * p = parser::create(ctx, m);
+    VERIFY(p->parse_string(program.c_str()));
+    dealloc(p);
+    for (unsigned i = 0; i < num_preds; i++) {
+        ctx.set_output_predicate(ctx.try_get_predicate_decl(symbol(preds[i])));
+    }
+    VERIFY(ctx.get_rel_context()->saturate() == l_true);
+    for (unsigned i = 0; i < num_preds; i++) {
+        func_decl * pred = ctx.try_get_predicate_decl(symbol(preds[i]));
+        unsigned sz = 0;
+        VERIFY(ctx.get_rel_context()->try_get_size(pred, sz));
+        sizes.push_back(sz);
+        if (plugins) {
+            relation_manager & rm = ctx.get_rel_context()->get_rmanager();
+            plugins->push_back(rm.get_relation(pred).get_plugin().get_name());
+        }
+    }
+    if (st) {
+        ctx.collect_statistics(*st);
+    }
+}
+
+static unsigned get_uint_statistic(statistics const & st, char const * key) {
+    for (unsigned i = 0; i < st.size(); ++i) {
+        if (st.is_uint(i) && std::string(st.get_key(i)) == key) {
+            return st.get_uint_value(i);
+        }
+    }
+    return 0;
+}
+
+// T1 and T2 are mutually recursive, and their rules access disjoint registers in the saturation loop.
+static unsigned dl_context_parallel_test(bool parallel) {
+    params_ref params;
+    params.set_bool("parallel_rule_evaluation", parallel);
+
+    std::stringstream strm;
+    strm << "N 64\n\n"
+         << "E1(x : N, y : N)\nE2(x : N, y : N)\nT1(x : N, y : N)\nT2(x : N, y : N)\n"
+         << "T1(X,Y) :- E1(X,Y).\nT1(X,Y) :- E1(X,Z), T2(Z,Y).\n"
+         << "T2(X,Y) :- E2(X,Y).\nT2(X,Y) :- E2(X,Z), T1(Z,Y).\n";
+    for (unsigned i = 0; i < 30; i++) {
+        strm << "E" << (i % 2 + 1) << "(" << i << "," << (i + 1) << ").\n";
+        strm << "E" << (2 - i % 2) << "(" << i << "," << ((i * 7 + 3) % 30) << ").\n";
+    }
+    char const * preds[] = { "T1", "T2" };
+    unsigned_vector sizes;
+    statistics st;
+    dl_context_saturate_program(params, strm.str(), 2, preds, sizes, &st);
+    // the rules of T1 and T2 are evaluated in the same waves.
+    VERIFY((get_uint_statistic(st, "datalog parallel instructions") > 1) == parallel);
+    return sizes[0] + sizes[1];
+}
+
+// The columns of H have many distinct values, but the join of H with itself goes through
+// the hub 0, so it is much larger than estimated and the rules of T are planned again.
+static unsigned dl_context_join_plan_test(unsigned replan_factor) {
+    params_ref params;
+    params.set_uint("join_replan_factor", replan_factor);
+
+    std::stringstream strm;
+    strm << "N 64\n\n"
+         << "E(x : N, y : N)\nH(x : N, y : N)\nT(x : N, y : N)\n"
+         << "T(X,Y) :- E(X,Y).\nT(X,Z) :- T(X,Y), H(Y,W), H(W,Z).\n";
+    for (unsigned i = 1; i <= 50; i++) {
+        strm << "H(" << i << ",0).\nH(0," << i << ").\n";
+    }
+    for (unsigned i = 0; i < 10; i++) {
+        strm << "E(" << i << "," << (i * 3 % 50 + 1) << ").\n";
+    }
+    char const * preds[] = { "T" };
+    unsigned_vector sizes;
+    statistics st;
+    dl_context_saturate_program(params, strm.str(), 1, preds, sizes, &st);
+    VERIFY(get_uint_statistic(st, "datalog estimated relations") > 0);
+    VERIFY((get_uint_statistic(st, "datalog join replans") > 0) == (replan_factor != 0));
+    return sizes[0];
+}
+
+static void dl_context_leapfrog_test(bool leapfrog, char const * relation, unsigned_vector & sizes) {
+    params_ref params;
+    params.set_bool("leapfrog_join", leapfrog);
+    params.set_sym("default_relation", symbol(relation));
+
+    std::stringstream strm;
+    strm << "N 64\n\n"
+         << "E(x : N, y : N)\nTri(x : N, y : N, z : N)\nC(x : N)\nK(x : N)\n"
+         << "Tri(X,Y,Z) :- E(X,Y), E(Y,Z), E(Z,X).\n"
+         << "C(X) :- E(X,Y), E(Y,Z), E(Z,X), !Tri(Z,Z,Z).\n"
+         << "K(X) :- E(X,Y), E(Y,Y), E(Y,3).\n"
+         << "E(1,2).\nE(2,3).\nE(3,1).\nE(2,2).\nE(4,4).\n";
+    for (unsigned i = 0; i < 60; i++) {
+        strm << "E(" << i << "," << ((i * 7 + 1) % 60) << ").\n";
+        strm << "E(" << i << "," << ((i * 13 + 5) % 60) << ").\n";
+        strm << "E(" << i << "," << ((i * 11 + 2) % 60) << ").\n";
+    }
+    char const * preds[] = { "Tri", "C", "K" };
+    dl_context_saturate_program(params, strm.str(), 3, preds, sizes);
+}
+
+// Recursion, negation, constants and repeated variables evaluated with the given relation.
+static void dl_context_table_test(char const * relation, unsigned_vector & sizes) {
+    params_ref params;
+    params.set_sym("default_relation", symbol(relation));
+
+    std::stringstream strm;
+    strm << "N 64\n\n"
+         << "E(x : N, y : N)\nT(x : N, y : N)\nS(x : N)\nU(x : N, y : N)\nV(x : N)\n"
+         << "T(X,Y) :- E(X,Y).\nT(X,Z) :- T(X,Y), E(Y,Z).\n"
+         << "S(X) :- T(X,X).\n"
+         << "U(X,Y) :- T(X,Y), !T(Y,X).\n"
+         << "V(Y) :- T(3,Y), !S(Y).\n";
+    for (unsigned i = 0; i < 40; i++) {
+        strm << "E(" << i << "," << (i * 5 + 3) % 50 << ").\n";
+        if (i % 4 == 0) {
+            strm << "E(" << i << "," << (i + 1) << ").\n";
+        }
+        if (i % 9 == 0) {
+            strm << "E(" << (i * 5 + 3) % 50 << "," << i << ").\n";
+        }
+    }
+    char const * preds[] = { "T", "S", "U", "V" };
+    svector<symbol> plugins;
+    dl_context_saturate_program(params, strm.str(), 4, preds, sizes, 0, &plugins);
+    VERIFY(plugins[0] == symbol(relation));
+}
+
+// Iterating over a BDD table yields every row exactly once, also when the BDD does not
+// constrain some bits of the row. Values that do not fit in a column are not in the table.
+static void dl_context_bdd_table_test() {
+    ast_manager m;
+    smt_params fparams;
+    register_engine re;
+    context ctx(m, re, fparams);
+    relation_manager & rm = ctx.get_rel_context()->get_rmanager();
+    table_plugin * p = rm.get_table_plugin(symbol("bdd"));
+    VERIFY(p);
+    table_signature sig;
+    sig.push_back(3);
+    sig.push_back(5);
+    sig.push_back(2);
+
+    table_base * t = p->mk_empty(sig);
+    VERIFY(t->begin() == t->end());
+    table_fact f;
+    f.resize(3, 0);
+    unsigned num_facts = 0;
+    for (unsigned i = 0; i < 20; i++) {
+        f[0] = i % 3;
+        f[1] = (i * 3) % 5;
+        f[2] = (i / 3) % 2;
+        if (!t->contains_fact(f)) {
+            t->add_fact(f);
+            num_facts++;
+        }
+    }
+    f[0] = 4;
+    f[1] = 0;
+    f[2] = 0;
+    VERIFY(!t->contains_fact(f));
+
+    table_base * c = t->complement(0);
+    table_base * tables[2] = { t, c };
+    unsigned expected[2] = { num_facts, 3 * 5 * 2 - num_facts };
+    for (unsigned k = 0; k < 2; k++) {
+        svector<bool> seen;
+        seen.resize(3 * 5 * 2, false);
+        unsigned num_rows = 0;
+        table_base::iterator it = tables[k]->begin(), end = tables[k]->end();
+        for (; it != end; ++it) {
+            it->get_fact(f);
+            VERIFY(f[0] < 3 && f[1] < 5 && f[2] < 2);
+            VERIFY(tables[k]->contains_fact(f) && !tables[1 - k]->contains_fact(f));
+            unsigned idx = static_cast<unsigned>((f[0] * 5 + f[1]) * 2 + f[2]);
+            VERIFY(!seen[idx]);
+            seen[idx] = true;
+            num_rows++;
+        }
+        VERIFY(num_rows == expected[k]);
+    }
+    t->deallocate();
+    c->deallocate();
+}
+
 void tst_dl_context() {
+    dl_context_bdd_table_test();
+
+    unsigned_vector sparse, bdd;
+    dl_context_table_test("tr_sparse", sparse);
+    dl_context_table_test("tr_bdd", bdd);
+    for (unsigned i = 0; i < sparse.size(); i++) {
+        VERIFY(sparse[i] > 0 && bdd[i] == sparse[i]);
+    }
+
+    unsigned sz0 = dl_context_join_plan_test(0);
+    VERIFY(sz0 > 0 && dl_context_join_plan_test(4) == sz0);
+
+    unsigned_vector binary, leapfrog, pairwise;
+    dl_context_leapfrog_test(false, "tr_sparse", binary);
+    dl_context_leapfrog_test(true, "tr_sparse", leapfrog);
+    dl_context_leapfrog_test(true, "tr_hashtable", pairwise);
+    VERIFY(binary[0] > 0 && binary[1] > 0 && binary[2] > 0);
+    for (unsigned i = 0; i < binary.size(); i++) {
+        VERIFY(leapfrog[i] == binary[i] && pairwise[i] == binary[i]);
+    }
+
+    unsigned old_max = task_pool::get_max_threads();
+    task_pool::set_max_threads(4);
+    unsigned sz = dl_context_parallel_test(false);
+    VERIFY(sz > 0 && dl_context_parallel_test(true) == sz);
+    task_pool::set_max_threads(old_max);
+
     symbol relations[] = { symbol("tr_skip"), symbol("tr_sparse"), symbol("tr_hashtable"), symbol("smt_relation2")  };
     const unsigned rel_cnt = sizeof(relations)/sizeof(symbol);
 
@@ -12,6 +12,12 @@ static datalog::table_base* mk_bv_table(datalog::relation_manager& m, datalog::t
     return p->mk_empty(sig);
 }
 
+static datalog::table_base* mk_bdd_table(datalog::relation_manager& m, datalog::table_signature& sig) {
+    datalog::table_plugin * p = m.get_table_plugin(symbol("bdd"));
+    SASSERT(p);
+    return p->mk_empty(sig);
+}
+
 static void test_table(mk_table_fn mk_table) {
     datalog::table_signature sig;
     sig.push_back(2);
@@ -91,9 +97,13 @@ void test_dl_bitvector_table() {
     test_table(mk_bv_table);
 }
 
+void test_dl_bdd_table() {
+    test_table(mk_bdd_table);
+}
 
 void tst_dl_table() {
     test_dl_bitvector_table();
+    test_dl_bdd_table();
 }
 #else
 void tst_dl_table() {
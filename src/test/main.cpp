@@ -152,6 +152,8 @@ int main(int argc, char ** argv) {
     TST(simplifier);
     TST(bv_simplifier_plugin);
     TST(bit_blaster);
+    TST(sls);
+    TST_ARGV(bit_blaster_encodings);
     TST(var_subst);
     TST(simple_parser);
     TST(api);
@@ -180,6 +182,7 @@ int main(int argc, char ** argv) {
     TST(arith_rewriter);
     TST(check_assumptions);
     TST(smt_context);
+    TST(cube_and_conquer);
     TST(theory_dl);
     TST(model_retrieval);
     TST(factor_rewriter);
@@ -216,6 +219,8 @@ int main(int argc, char ** argv) {
     TST(polynorm);
     TST(qe_arith);
     TST(expr_substitution);
+    TST(sat_solver);
+    TST(task_pool);
 }
 
 void initialize_mam() {}
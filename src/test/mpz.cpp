@@ -488,8 +488,50 @@ static void tst_pw2() {
     }
 }
 
+// The overflow checks used for small numbers agree with the generic ones, and with the
+// operations on big numbers.
+static void tst_small_ops() {
+    typedef mpz_manager<false> manager;
+    unsynch_mpz_manager m;
+    scoped_mpz a(m), b(m), r(m), expected(m);
+    int64 corners[6] = { INT64_MAX, INT64_MAX - 1, INT64_MIN + 1, static_cast<int64>(1) << 32, -(static_cast<int64>(1) << 31), 0 };
+    unsigned long long seed = 17;
+    for (unsigned i = 0; i < 100000; i++) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        int64 x = static_cast<int64>(seed) >> (seed % 64);
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        int64 y = static_cast<int64>(seed) >> (seed % 64);
+        if (i < 36) {
+            x = corners[i % 6];
+            y = corners[i / 6];
+        }
+        if (x == INT64_MIN || y == INT64_MIN)
+            continue;
+        for (unsigned op = 0; op < 3; op++) {
+            int64 r1 = 0, r2 = 0;
+            bool ok1 = op == 0 ? manager::safe_add(x, y, r1) : op == 1 ? manager::safe_sub(x, y, r1) : manager::safe_mul(x, y, r1);
+            bool ok2 = op == 0 ? manager::safe_add_generic(x, y, r2) : op == 1 ? manager::safe_sub_generic(x, y, r2) : manager::safe_mul_generic(x, y, r2);
+            VERIFY(ok1 == ok2);
+            VERIFY(!ok1 || r1 == r2);
+            // the same operation on numbers that are not small, scaled by 2^64.
+            m.set(a, x);
+            m.set(b, y);
+            m.mul2k(a, 64);
+            m.mul2k(b, 64);
+            if (op == 0) m.add(a, b, r); else if (op == 1) m.sub(a, b, r); else m.mul(a, b, r);
+            m.machine_div2k(r, op == 2 ? 128 : 64);
+            VERIFY(ok1 == m.is_int64(r));
+            if (ok1) {
+                m.set(expected, r1);
+                VERIFY(m.eq(r, expected));
+            }
+        }
+    }
+}
+
 void tst_mpz() {
     disable_trace("mpz");
+    tst_small_ops();
     enable_trace("mpz_2k");
     tst_pw2();
     tst5();
@@ -453,6 +453,65 @@ static void tst11(bool use_ints) {
     std::cout << "\n";
 }
 
+#define NUM_THREADS 4
+
+// Rationals are used by several threads. Some of them are created in one thread
+// and deleted in another one.
+static void tst12() {
+    vector<rational> vals;
+    for (unsigned i = 0; i < NUM_THREADS; i++)
+        vals.push_back(rational("123456789012345678901234567890"));
+    {
+        timeit t(true, "big rationals in parallel threads");
+        #pragma omp parallel for num_threads(NUM_THREADS)
+        for (int i = 0; i < NUM_THREADS; i++) {
+            rational r = vals[i];
+            rational d(7, 3);
+            for (unsigned j = 0; j < 100000; j++) {
+                r *= d;
+                r /= d;
+                r += rational(i);
+            }
+            vals[i] = r;
+        }
+    }
+    for (unsigned i = 0; i < NUM_THREADS; i++) {
+        VERIFY(vals[i] == rational("123456789012345678901234567890") + rational(100000 * i));
+    }
+}
+
+#if !defined(_WINDOWS) && defined(_THREAD_LOCAL_MPQ_MANAGER)
+#include<pthread.h>
+
+static void * big_rational_thread(void * arg) {
+    rational * r = static_cast<rational*>(arg);
+    rational d(7, 3);
+    for (unsigned j = 0; j < 1000; j++) {
+        *r *= d;
+        *r /= d;
+        *r += rational(1);
+    }
+    return 0;
+}
+
+// Each thread releases its manager when it exits, and the next thread reuses it.
+// The numbers created by a thread remain valid after it exits.
+static void tst_thread_exit() {
+    vector<rational> vals;
+    for (unsigned i = 0; i < 20; i++)
+        vals.push_back(rational("123456789012345678901234567890"));
+    for (unsigned i = 0; i < vals.size(); i++) {
+        pthread_t t;
+        VERIFY(pthread_create(&t, 0, big_rational_thread, &vals[i]) == 0);
+        VERIFY(pthread_join(t, 0) == 0);
+    }
+    for (unsigned i = 0; i < vals.size(); i++) {
+        VERIFY(vals[i] == rational("123456789012345678901234567890") + rational(1000));
+    }
+}
+#else
+static void tst_thread_exit() {}
+#endif
 
 void tst_rational() {
     TRACE("rational", tout << "starting rational test...\n";);
@@ -478,4 +537,6 @@ void tst_rational() {
     tst11(true);
     tst10(true);
     tst10(false);
+    tst12();
+    tst_thread_exit();
 }
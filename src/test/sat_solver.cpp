@@ -0,0 +1,239 @@
+#include"sat_solver.h"
+#include"util.h"
+#include"statistics.h"
+#include<fstream>
+#include<sstream>
+#include<cstdio>
+
+static bool in_core(sat::solver const & s, sat::literal l) {
+    return std::find(s.get_core().begin(), s.get_core().end(), l) != s.get_core().end();
+}
+
+static void tst_assumptions() {
+    params_ref p;
+    sat::solver s(p, 0);
+    sat::bool_var a = s.mk_var(true);
+    sat::bool_var b = s.mk_var(true);
+    sat::bool_var c = s.mk_var(true);
+    sat::bool_var d = s.mk_var(true);
+    s.mk_clause(sat::literal(a, false), sat::literal(b, false));
+    s.mk_clause(sat::literal(a, true), sat::literal(c, false));
+    s.mk_clause(sat::literal(b, true), sat::literal(c, false));
+
+    sat::literal as1[2] = { sat::literal(d, false), sat::literal(c, true) };
+    lbool r = s.check(2, as1);
+    VERIFY(r == l_false);
+    VERIFY(in_core(s, sat::literal(c, true)));
+    VERIFY(!in_core(s, sat::literal(d, false)));
+
+    r = s.check();
+    VERIFY(r == l_true);
+    VERIFY(s.get_core().empty());
+
+    sat::literal as2[2] = { sat::literal(c, false), sat::literal(d, true) };
+    r = s.check(2, as2);
+    VERIFY(r == l_true);
+    VERIFY(s.get_model()[c] == l_true);
+    VERIFY(s.get_model()[d] == l_false);
+
+    // contradictory assumptions
+    sat::literal as3[2] = { sat::literal(d, false), sat::literal(d, true) };
+    r = s.check(2, as3);
+    VERIFY(r == l_false);
+    VERIFY(s.get_core().size() == 2);
+
+    // new clauses after a check
+    s.mk_clause(sat::literal(c, true), sat::literal(d, false));
+    sat::literal as4[1] = { sat::literal(d, true) };
+    r = s.check(1, as4);
+    VERIFY(r == l_false);
+    VERIFY(in_core(s, sat::literal(d, true)));
+
+    s.mk_clause(sat::literal(d, true), sat::literal(c, true));
+    r = s.check();
+    VERIFY(r == l_false);
+    VERIFY(s.get_core().empty());
+}
+
+// x is not external, so the simplifier may eliminate it, and then it cannot be assumed.
+static void tst_eliminated_assumption() {
+    params_ref p;
+    p.set_uint("burst_search", 0); // simplify before the search
+    sat::solver s(p, 0);
+    sat::bool_var a = s.mk_var(true);
+    sat::bool_var b = s.mk_var(true);
+    sat::bool_var x = s.mk_var();
+    s.mk_clause(sat::literal(x, false), sat::literal(a, false));
+    s.mk_clause(sat::literal(x, true), sat::literal(b, false));
+    VERIFY(s.check() == l_true);
+    VERIFY(s.was_eliminated(x));
+    sat::literal as[1] = { sat::literal(x, false) };
+    bool thrown = false;
+    try {
+        s.check(1, as);
+    }
+    catch (sat::solver_exception &) {
+        thrown = true;
+    }
+    VERIFY(thrown);
+}
+
+typedef svector<int> dimacs_clause;
+typedef vector<dimacs_clause> dimacs_clauses;
+
+static int to_dimacs(sat::literal l) {
+    return l.sign() ? -static_cast<int>(l.var()) : static_cast<int>(l.var());
+}
+
+static void mk_clause(sat::solver & s, sat::literal_vector const & lits, dimacs_clauses * cls) {
+    s.mk_clause(lits.size(), lits.c_ptr());
+    if (cls) {
+        cls->push_back(dimacs_clause());
+        for (unsigned i = 0; i < lits.size(); i++)
+            cls->back().push_back(to_dimacs(lits[i]));
+    }
+}
+
+// pigeon hole: n+1 pigeons in n holes
+static void mk_pigeon_hole(sat::solver & s, unsigned n, dimacs_clauses * cls = 0) {
+    svector<sat::bool_var> vs;
+    for (unsigned i = 0; i < (n + 1) * n; i++)
+        vs.push_back(s.mk_var());
+    sat::literal_vector lits;
+    for (unsigned p = 0; p <= n; p++) {
+        lits.reset();
+        for (unsigned h = 0; h < n; h++)
+            lits.push_back(sat::literal(vs[p*n + h], false));
+        mk_clause(s, lits, cls);
+    }
+    for (unsigned h = 0; h < n; h++)
+        for (unsigned p = 0; p <= n; p++)
+            for (unsigned q = p + 1; q <= n; q++) {
+                lits.reset();
+                lits.push_back(sat::literal(vs[p*n + h], true));
+                lits.push_back(sat::literal(vs[q*n + h], true));
+                mk_clause(s, lits, cls);
+            }
+}
+
+static void tst_portfolio() {
+    params_ref p;
+    p.set_uint("threads", 3);
+    sat::solver s(p, 0);
+    mk_pigeon_hole(s, 6);
+    lbool r = s.check();
+    std::cout << "pigeon hole 6: " << r << "\n";
+    SASSERT(r == l_false);
+
+    sat::solver s2(p, 0);
+    sat::bool_var a = s2.mk_var();
+    sat::bool_var b = s2.mk_var();
+    s2.mk_clause(sat::literal(a, true), sat::literal(b, false));
+    sat::literal l(a, false);
+    s2.mk_clause(1, &l);
+    r = s2.check();
+    std::cout << "a, a => b: " << r << "\n";
+    SASSERT(r == l_true);
+    SASSERT(s2.get_model()[b] == l_true);
+}
+
+static lbool dimacs_value(svector<lbool> const & vals, int l) {
+    lbool v = vals[l > 0 ? l : -l];
+    return l > 0 ? v : ~v;
+}
+
+// the lemma is RUP: unit propagation on db refutes the negation of the lemma
+static bool is_rup(dimacs_clauses const & db, dimacs_clause const & lemma, unsigned num_vars) {
+    svector<lbool> vals(num_vars + 1, l_undef);
+    for (unsigned i = 0; i < lemma.size(); i++) {
+        if (dimacs_value(vals, lemma[i]) == l_true)
+            return true;
+        vals[lemma[i] > 0 ? lemma[i] : -lemma[i]] = lemma[i] > 0 ? l_false : l_true;
+    }
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (unsigned i = 0; i < db.size(); i++) {
+            dimacs_clause const & c = db[i];
+            int unit = 0;
+            unsigned num_undef = 0;
+            bool sat = false;
+            for (unsigned j = 0; !sat && j < c.size(); j++) {
+                lbool v = dimacs_value(vals, c[j]);
+                if (v == l_true)
+                    sat = true;
+                else if (v == l_undef) {
+                    num_undef++;
+                    unit = c[j];
+                }
+            }
+            if (sat || num_undef > 1)
+                continue;
+            if (num_undef == 0)
+                return true;
+            vals[unit > 0 ? unit : -unit] = unit > 0 ? l_true : l_false;
+            progress = true;
+        }
+    }
+    return false;
+}
+
+static void tst_drat() {
+    params_ref p;
+    p.set_sym("drat.file", symbol("sat_solver_test.drat"));
+    dimacs_clauses db;
+    unsigned num_vars = 0;
+    {
+        sat::solver s(p, 0);
+        s.mk_var(); // variable 0 cannot be written in DIMACS numbering
+        mk_pigeon_hole(s, 5, &db);
+        num_vars = s.num_vars();
+        lbool r = s.check();
+        std::cout << "pigeon hole 5 with DRAT: " << r << "\n";
+        VERIFY(r == l_false);
+    }
+    // replay the proof: every added clause must be RUP, and the last one empty
+    std::ifstream in("sat_solver_test.drat");
+    std::string line;
+    unsigned num_add = 0;
+    bool empty_clause = false;
+    while (std::getline(in, line)) {
+        if (line.empty())
+            continue;
+        bool del = line[0] == 'd';
+        std::istringstream strm(del ? line.substr(1) : line);
+        dimacs_clause c;
+        int l;
+        while (strm >> l && l != 0)
+            c.push_back(l);
+        VERIFY(l == 0);
+        std::sort(c.begin(), c.end());
+        if (del) {
+            for (unsigned i = 0; i < db.size(); i++) {
+                dimacs_clause d(db[i]);
+                std::sort(d.begin(), d.end());
+                if (d.size() == c.size() && std::equal(d.begin(), d.end(), c.begin())) {
+                    db[i] = db.back();
+                    db.pop_back();
+                    break;
+                }
+            }
+            continue;
+        }
+        VERIFY(is_rup(db, c, num_vars));
+        db.push_back(c);
+        empty_clause = c.empty();
+        num_add++;
+    }
+    std::cout << "lemmas in proof: " << num_add << "\n";
+    VERIFY(empty_clause);
+    in.close();
+    remove("sat_solver_test.drat");
+}
+
+void tst_sat_solver() {
+    tst_assumptions();
+    tst_eliminated_assumption();
+    tst_portfolio();
+    tst_drat();
+}
@@ -24,6 +24,19 @@ Revision History:
 #include"warning.h"
 #include"reg_decl_plugins.h"
 
+static void check_compiled(ast_manager & m, cost_evaluator & eval, expr * f) {
+    cost_program prog;
+    eval.compile(f, 2, prog);
+    TRACE("simple_parser", tout << mk_pp(f, m) << "\n"; prog.display(tout););
+    float xs[5] = { -1.0f, 0.0f, 2.0f, 3.0f, 5.0f };
+    for (unsigned i = 0; i < 5; i++) {
+        for (unsigned j = 0; j < 5; j++) {
+            float vals[2] = { xs[i], xs[j] };
+            VERIFY(eval(f, 2, vals) == prog(2, vals));
+        }
+    }
+}
+
 void tst_simple_parser() {
     ast_manager    m;
     reg_decl_plugins(m);
@@ -58,5 +71,12 @@ void tst_simple_parser() {
     TRACE("simple_parser", 
           tout << mk_pp(r, m) << "\n";
           tout << "val: " << eval(r, 2, vals) << "\n";);
+    check_compiled(m, eval, r);
+    char const * fs[] = { "(+ x (* y x) x)", "(- x y 1)", "(ite (and (> x 3) (<= y 4)) (/ x 2) 10)", "(implies (< x y) (= x 2))", 
+                          "(or (not (>= x y)) (xor (> x 0) (> y 0)))", "(* 0.5 (+ x y))", "(and)", "(or)" };
+    for (unsigned i = 0; i < sizeof(fs)/sizeof(fs[0]); i++) {
+        VERIFY(p.parse_string(fs[i], r));
+        check_compiled(m, eval, r);
+    }
 }
 
@@ -0,0 +1,146 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    sls.cpp
+
+Abstract:
+
+    Test the SLS evaluator.
+
+Author:
+
+Revision History:
+
+--*/
+#include"sls_evaluator.h"
+#include"sls_tactic.h"
+#include"tactic.h"
+#include"model.h"
+#include"reg_decl_plugins.h"
+
+static uint64 next_random(uint64 & seed) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    return seed;
+}
+
+// The evaluation on machine words agrees with the evaluation with mpz numbers.
+static void tst_word_eval(unsigned bv_sz) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    unsynch_mpz_manager mm;
+    powers pw(mm);
+    sls_tracker tracker(m, bv, mm, pw);
+    sls_evaluator ev(m, bv, tracker, mm, pw);
+    tracker.updt_params(params_ref());
+
+    sort_ref s(bv.mk_sort(bv_sz), m);
+    app_ref x(m.mk_const(symbol("x"), s), m);
+    app_ref y(m.mk_const(symbol("y"), s), m);
+    decl_kind binary_ops[] = {
+        OP_BADD, OP_BSUB, OP_BMUL, OP_BSDIV_I, OP_BUDIV_I, OP_BSREM_I, OP_BUREM_I, OP_BSMOD_I,
+        OP_BAND, OP_BOR, OP_BXOR, OP_BNAND, OP_BNOR, OP_BSHL, OP_BLSHR, OP_BASHR,
+        OP_ULT, OP_ULEQ, OP_UGT, OP_UGEQ, OP_SLT, OP_SLEQ, OP_SGT, OP_SGEQ
+    };
+    app_ref_vector terms(m);
+    for (unsigned i = 0; i < sizeof(binary_ops) / sizeof(decl_kind); i++)
+        terms.push_back(m.mk_app(bv.get_fid(), binary_ops[i], x.get(), y.get()));
+    terms.push_back(m.mk_app(bv.get_fid(), OP_BNEG, x.get()));
+    terms.push_back(m.mk_app(bv.get_fid(), OP_BNOT, x.get()));
+    terms.push_back(bv.mk_extract(bv_sz - 1, bv_sz / 2, x));
+    terms.push_back(bv.mk_concat(x, y));
+
+    ptr_vector<expr> as;
+    for (unsigned i = 0; i < terms.size(); i++) {
+        app * t = terms.get(i);
+        as.push_back(m.is_bool(t) ? t : m.mk_eq(t, t));
+    }
+    expr_ref_vector pinned(m);
+    pinned.append(as.size(), as.c_ptr());
+    tracker.initialize(as);
+
+    uint64 seed = bv_sz;
+    scoped_mpz vx(mm), vy(mm), r1(mm), r2(mm);
+    for (unsigned k = 0; k < 200; k++) {
+        // small values, values close to the bounds, and random values.
+        uint64 mask = bv_sz == 64 ? UINT64_MAX : (static_cast<uint64>(1) << bv_sz) - 1;
+        uint64 a = next_random(seed), b = next_random(seed);
+        switch (k % 4) {
+        case 0: a %= 4; b %= bv_sz + 2; break;
+        case 1: a = mask - a % 4; b %= 4; break;
+        case 2: a = mask - a % 4; b = mask - b % 4; break;
+        default: break;
+        }
+        mm.set(vx, a & mask);
+        mm.set(vy, b & mask);
+        tracker.set_value(x, vx);
+        tracker.set_value(y, vy);
+        for (unsigned i = 0; i < terms.size(); i++) {
+            ev.set_word_eval(true);
+            ev(terms.get(i), r1);
+            ev.set_word_eval(false);
+            ev(terms.get(i), r2);
+            VERIFY(mm.eq(r1, r2));
+        }
+    }
+}
+
+// Parallel walkers solve a satisfiable goal with a model of the original goal, and give up
+// on an unsatisfiable one.
+static void tst_walkers(unsigned num_walkers) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    sort_ref s(bv.mk_sort(8), m);
+    expr_ref x(m.mk_const(symbol("x"), s), m);
+    expr_ref y(m.mk_const(symbol("y"), s), m);
+    expr_ref_vector sat_fmls(m), unsat_fmls(m);
+    // x * y = 36, 1 < x < y
+    sat_fmls.push_back(m.mk_eq(bv.mk_bv_mul(x, y), bv.mk_numeral(rational(36), 8)));
+    sat_fmls.push_back(m.mk_not(bv.mk_ule(x, bv.mk_numeral(rational(1), 8))));
+    sat_fmls.push_back(m.mk_not(bv.mk_ule(y, x)));
+    // 2 is not a square modulo 256
+    unsat_fmls.push_back(m.mk_eq(bv.mk_bv_mul(x, x), bv.mk_numeral(rational(2), 8)));
+
+    params_ref p;
+    p.set_uint("threads", num_walkers);
+    for (unsigned k = 0; k < 2; k++) {
+        expr_ref_vector const & fmls = k == 0 ? sat_fmls : unsat_fmls;
+        p.set_uint("max_restarts", k == 0 ? UINT_MAX : 3);
+        goal_ref g = alloc(goal, m);
+        for (unsigned i = 0; i < fmls.size(); i++)
+            g->assert_expr(fmls[i]);
+        tactic_ref t = mk_sls_tactic(m, p);
+        goal_ref_buffer result;
+        model_converter_ref mc;
+        proof_converter_ref pc;
+        expr_dependency_ref core(m);
+        (*t)(g, result, mc, pc, core);
+        VERIFY(result.size() == 1);
+        if (k == 0) {
+            VERIFY(result[0]->size() == 0);
+            VERIFY(mc);
+            model_ref md = alloc(model, m);
+            (*mc)(md, 0);
+            for (unsigned i = 0; i < fmls.size(); i++) {
+                expr_ref v(m);
+                VERIFY(md->eval(fmls[i], v, true));
+                VERIFY(m.is_true(v));
+            }
+        }
+        else {
+            VERIFY(result[0]->size() == fmls.size());
+            VERIFY(!mc);
+        }
+    }
+}
+
+void tst_sls() {
+    unsigned sizes[] = { 1, 7, 32, 63, 64 };
+    for (unsigned i = 0; i < sizeof(sizes) / sizeof(unsigned); i++)
+        tst_word_eval(sizes[i]);
+    tst_walkers(1);
+    tst_walkers(4);
+}
@@ -1,5 +1,325 @@
 #include "smt_context.h"
 #include "reg_decl_plugins.h"
+#include "task_pool.h"
+#include "bv_decl_plugin.h"
+
+static bool has_stat(statistics const & st, char const * key) {
+    for (unsigned i = 0; i < st.size(); i++)
+        if (strcmp(st.get_key(i), key) == 0)
+            return true;
+    return false;
+}
+
+static bool find_stat(statistics const & st, char const * key, unsigned & r) {
+    for (unsigned i = 0; i < st.size(); i++) {
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0) {
+            r = st.get_uint_value(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// The instances of (forall x. f_i(h(x)) = k_i(x)) are needed to refute the ground part,
+// which is only asserted after the patterns were added to the matching abstract machine.
+static lbool check_incremental_matching(bool parallel) {
+    smt_params params;
+    params.m_mbqi = false;
+    params.m_qi_parallel_matching = parallel;
+    params.m_relevancy_lvl = 0; // all ground terms are matched in the same round
+
+    ast_manager m;
+    reg_decl_plugins(m);
+
+    smt::context ctx(m, params);
+
+    sort_ref u(m.mk_uninterpreted_sort(symbol("U")), m);
+    sort * us[1] = { u };
+    func_decl_ref h(m.mk_func_decl(symbol("h"), 1, us, u), m);
+    func_decl_ref_vector fs(m), ks(m);
+    symbol x("x");
+    app_ref c1(m.mk_const(symbol("c1"), u), m);
+    app_ref c2(m.mk_const(symbol("c2"), u), m);
+    expr_ref_vector diseqs(m);
+    for (unsigned i = 0; i < 40; i++) {
+        fs.push_back(m.mk_fresh_func_decl("f", 1, us, u));
+        ks.push_back(m.mk_fresh_func_decl("k", 1, us, u));
+        expr_ref v(m.mk_var(0, u), m);
+        app_ref f_h(m.mk_app(fs.get(i), m.mk_app(h, v.get())), m);
+        expr * pat = m.mk_pattern(f_h);
+        ctx.assert_expr(m.mk_forall(1, us, &x, m.mk_eq(f_h, m.mk_app(ks.get(i), v.get())), 0, symbol::null, symbol::null, 1, &pat));
+        diseqs.push_back(m.mk_not(m.mk_eq(m.mk_app(fs.get(i), m.mk_app(h, c1.get())), m.mk_app(ks.get(i), c1.get()))));
+        diseqs.push_back(m.mk_not(m.mk_eq(m.mk_app(fs.get(i), m.mk_app(h, c2.get())), m.mk_app(ks.get(i), c2.get()))));
+    }
+    ctx.check();
+    ctx.push();
+    ctx.assert_expr(m.mk_or(diseqs.size(), diseqs.c_ptr()));
+    lbool r = ctx.check();
+    ctx.pop(1);
+    return r;
+}
+
+static void tst_parallel_matching() {
+    unsigned old_max = task_pool::get_max_threads();
+    task_pool::set_max_threads(4);
+    VERIFY(check_incremental_matching(false) == l_false);
+    VERIFY(check_incremental_matching(true) == l_false);
+    task_pool::set_max_threads(old_max);
+}
+
+// Lazy bit-blasting gives the same results as eager bit-blasting. The unsatisfiable
+// identities only hold once the terms are bit-blasted, and the model of the satisfiable
+// instance respects the semantics of the lazy terms.
+static void check_lazy_blast(bool lazy_blast, bool sat) {
+    smt_params params;
+    params.m_bv_lazy_blast = lazy_blast;
+
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+
+    smt::context ctx(m, params);
+    sort_ref s(bv.mk_sort(8), m);
+    app_ref x(m.mk_const(symbol("x"), s), m);
+    app_ref y(m.mk_const(symbol("y"), s), m);
+    expr_ref_vector fmls(m);
+    if (sat) {
+        // x * y = 35, 1 < x <= y, x / y = 0, x >> (y - x) = 0
+        fmls.push_back(m.mk_eq(bv.mk_bv_mul(x, y), bv.mk_numeral(rational(35), 8)));
+        fmls.push_back(m.mk_not(bv.mk_ule(x, bv.mk_numeral(rational(1), 8))));
+        fmls.push_back(bv.mk_ule(x, y));
+        fmls.push_back(m.mk_eq(m.mk_app(bv.get_fid(), OP_BUDIV_I, x.get(), y.get()), bv.mk_numeral(rational(0), 8)));
+        fmls.push_back(m.mk_eq(bv.mk_bv_lshr(x, bv.mk_bv_sub(y, x)), bv.mk_numeral(rational(0), 8)));
+    }
+    else {
+        // x << y != x * (1 << y) or x != (x / y) * y + x % y
+        app_ref one(bv.mk_numeral(rational(1), 8), m);
+        app_ref q(m.mk_app(bv.get_fid(), OP_BUDIV_I, x.get(), y.get()), m);
+        app_ref r(m.mk_app(bv.get_fid(), OP_BUREM_I, x.get(), y.get()), m);
+        fmls.push_back(m.mk_or(m.mk_not(m.mk_eq(bv.mk_bv_shl(x, y), bv.mk_bv_mul(x, bv.mk_bv_shl(one, y)))),
+                               m.mk_not(m.mk_eq(x, bv.mk_bv_add(bv.mk_bv_mul(q, y), r)))));
+    }
+    for (unsigned i = 0; i < fmls.size(); i++)
+        ctx.assert_expr(fmls.get(i));
+    VERIFY(ctx.check() == (sat ? l_true : l_false));
+
+    statistics st;
+    ctx.collect_statistics(st);
+    VERIFY(lazy_blast == has_stat(st, "bv lazy blasts"));
+    if (sat) {
+        model_ref md;
+        ctx.get_model(md);
+        for (unsigned i = 0; i < fmls.size(); i++) {
+            expr_ref v(m);
+            VERIFY(md->eval(fmls.get(i), v, true));
+            VERIFY(m.is_true(v));
+        }
+    }
+}
+
+static void tst_bv_lazy_blast() {
+    for (unsigned i = 0; i < 4; i++)
+        check_lazy_blast((i & 1) != 0, (i & 2) != 0);
+}
+
+// x < 2^12, y < 2^12, z < 2^bound_z, and x * y * z >= 2^28.
+static void assert_mul_range(ast_manager & m, smt::context & ctx, unsigned bound_z) {
+    bv_util bv(m);
+    sort_ref s(bv.mk_sort(32), m);
+    app_ref x(m.mk_const(symbol("x"), s), m);
+    app_ref y(m.mk_const(symbol("y"), s), m);
+    app_ref z(m.mk_const(symbol("z"), s), m);
+    ctx.assert_expr(m.mk_not(bv.mk_ule(bv.mk_numeral(rational::power_of_two(12), 32), x)));
+    ctx.assert_expr(m.mk_not(bv.mk_ule(bv.mk_numeral(rational::power_of_two(12), 32), y)));
+    ctx.assert_expr(m.mk_not(bv.mk_ule(bv.mk_numeral(rational::power_of_two(bound_z), 32), z)));
+    ctx.assert_expr(bv.mk_ule(bv.mk_numeral(rational::power_of_two(28), 32), bv.mk_bv_mul(bv.mk_bv_mul(x, y), z)));
+}
+
+static lbool check_mul_range(bool lazy_blast, bool word_prop, unsigned bound_z) {
+    smt_params params;
+    params.m_bv_lazy_blast = lazy_blast;
+    params.m_bv_word_prop  = word_prop;
+
+    ast_manager m;
+    reg_decl_plugins(m);
+
+    smt::context ctx(m, params);
+    assert_mul_range(m, ctx, bound_z);
+    return ctx.check();
+}
+
+static void tst_bv_word_propagation() {
+    for (unsigned i = 0; i < 4; i++) {
+        bool lazy_blast = (i & 1) != 0;
+        bool word_prop  = (i & 2) != 0;
+        VERIFY(check_mul_range(lazy_blast, word_prop, 4) == l_false);
+        VERIFY(check_mul_range(lazy_blast, word_prop, 8) == l_true);
+    }
+}
+
+// 0 <= x < 64, y > y_lo, and x / y >= 16, where / is the signed division.
+// -64 <= u < 0, z_lo <= z < 32, and u >> z < -16, where >> is the arithmetic shift.
+static lbool check_signed_range(bool lazy_blast, bool word_prop, bool sdiv, unsigned lo) {
+    smt_params params;
+    params.m_bv_lazy_blast = lazy_blast;
+    params.m_bv_word_prop  = word_prop;
+
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+
+    smt::context ctx(m, params);
+    sort_ref s(bv.mk_sort(32), m);
+    app_ref x(m.mk_const(symbol("x"), s), m);
+    app_ref y(m.mk_const(symbol("y"), s), m);
+    if (sdiv) {
+        ctx.assert_expr(bv.mk_sle(bv.mk_numeral(rational(0), 32), x));
+        ctx.assert_expr(m.mk_not(bv.mk_sle(bv.mk_numeral(rational(64), 32), x)));
+        ctx.assert_expr(m.mk_not(bv.mk_sle(y, bv.mk_numeral(rational(lo), 32))));
+        app_ref q(m.mk_app(bv.get_fid(), OP_BSDIV_I, x.get(), y.get()), m);
+        ctx.assert_expr(bv.mk_sle(bv.mk_numeral(rational(16), 32), q));
+    }
+    else {
+        ctx.assert_expr(bv.mk_sle(bv.mk_numeral(rational(-64), 32), x));
+        ctx.assert_expr(m.mk_not(bv.mk_sle(bv.mk_numeral(rational(0), 32), x)));
+        ctx.assert_expr(bv.mk_ule(bv.mk_numeral(rational(lo), 32), y));
+        ctx.assert_expr(m.mk_not(bv.mk_ule(bv.mk_numeral(rational(32), 32), y)));
+        ctx.assert_expr(m.mk_not(bv.mk_sle(bv.mk_numeral(rational(-16), 32), bv.mk_bv_ashr(x, y))));
+    }
+    lbool r = ctx.check();
+    // the bounds of the comparisons are propagated to the bits of the quotient and of the shift.
+    statistics st;
+    ctx.collect_statistics(st);
+    VERIFY(word_prop == has_stat(st, "bv word propagations"));
+    return r;
+}
+
+static void tst_bv_word_signed_propagation() {
+    for (unsigned i = 0; i < 4; i++) {
+        bool lazy_blast = (i & 1) != 0;
+        bool word_prop  = (i & 2) != 0;
+        VERIFY(check_signed_range(lazy_blast, word_prop, true, 3) == l_false);
+        VERIFY(check_signed_range(lazy_blast, word_prop, true, 2) == l_true);
+        VERIFY(check_signed_range(lazy_blast, word_prop, false, 2) == l_false);
+        VERIFY(check_signed_range(lazy_blast, word_prop, false, 1) == l_true);
+    }
+}
+
+// The search of the source is interrupted, and the copies resume it from its learned clauses.
+static void tst_copy() {
+    smt_params src_params;
+    src_params.m_max_conflicts = 20;
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt::context src(m, src_params);
+    assert_mul_range(m, src, 4);
+    VERIFY(src.check() == l_undef);
+
+    smt_params params;
+    smt::context same(m, params);
+    smt::context::copy(src, same);
+    VERIFY(same.get_num_asserted_formulas() == src.get_num_asserted_formulas());
+    VERIFY(same.check() == l_false);
+
+    ast_manager m2;
+    reg_decl_plugins(m2);
+    smt::context other(m2, params);
+    smt::context::copy(src, other, UINT_MAX);
+    VERIFY(other.check() == l_false);
+
+    // the copies are independent of the source.
+    smt::context sat_src(m, params);
+    assert_mul_range(m, sat_src, 8);
+    VERIFY(sat_src.check() == l_true);
+    smt::context sat_copy(m, params);
+    smt::context::copy(sat_src, sat_copy);
+    VERIFY(sat_copy.check() == l_true);
+    sat_copy.assert_expr(m.mk_false());
+    VERIFY(sat_copy.check() == l_false);
+    VERIFY(sat_src.check() == l_true);
+
+    // the target of a copy must be fresh.
+    bool failed = false;
+    try {
+        smt::context::copy(sat_src, sat_copy);
+    }
+    catch (z3_exception &) {
+        failed = true;
+    }
+    VERIFY(failed);
+}
+
+// Pigeon hole problem: n+1 pigeons do not fit in n holes.
+static void assert_pigeon_hole(ast_manager & m, smt::context & ctx, unsigned n) {
+    expr_ref_vector ps(m);
+    for (unsigned i = 0; i <= n; i++) {
+        expr_ref_vector holes(m);
+        for (unsigned j = 0; j < n; j++) {
+            ps.push_back(m.mk_fresh_const("p", m.mk_bool_sort()));
+            holes.push_back(ps.back());
+        }
+        ctx.assert_expr(m.mk_or(holes.size(), holes.c_ptr()));
+    }
+    for (unsigned j = 0; j < n; j++)
+        for (unsigned i1 = 0; i1 <= n; i1++)
+            for (unsigned i2 = i1 + 1; i2 <= n; i2++)
+                ctx.assert_expr(m.mk_or(m.mk_not(ps.get(i1 * n + j)), m.mk_not(ps.get(i2 * n + j))));
+}
+
+// Lemmas are garbage collected often, using their glue or their activity.
+static void tst_lemma_gc(bool glue) {
+    smt_params params;
+    params.m_lemma_gc_glue       = glue;
+    params.m_lemma_gc_initial    = 50;
+    params.m_recent_lemmas_size  = 10;
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt::context ctx(m, params);
+    assert_pigeon_hole(m, ctx, 6);
+    VERIFY(ctx.check() == l_false);
+    statistics st;
+    ctx.collect_statistics(st);
+    unsigned num_del = 0;
+    VERIFY(find_stat(st, "del clause", num_del));
+    VERIFY(num_del > 0);
+}
+
+// The per-quantifier and per-pattern keys are reported only with qi.stats.
+static void tst_qi_stats(bool enabled) {
+    smt_params params;
+    params.m_mbqi     = false;
+    params.m_qi_stats = enabled;
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt::context ctx(m, params);
+
+    sort_ref u(m.mk_uninterpreted_sort(symbol("U")), m);
+    sort * us[1] = { u };
+    func_decl_ref f(m.mk_func_decl(symbol("f"), 1, us, u), m);
+    func_decl_ref g(m.mk_func_decl(symbol("g"), 1, us, u), m);
+    app_ref a(m.mk_const(symbol("a"), u), m);
+    expr_ref v(m.mk_var(0, u), m);
+    app_ref f_v(m.mk_app(f, v.get()), m);
+    expr * pat = m.mk_pattern(f_v);
+    symbol x("x");
+    ctx.assert_expr(m.mk_forall(1, us, &x, m.mk_eq(f_v, m.mk_app(g, v.get())), 3, symbol("fg"), symbol::null, 1, &pat));
+    ctx.assert_expr(m.mk_not(m.mk_eq(m.mk_app(f, a.get()), m.mk_app(g, a.get()))));
+    VERIFY(ctx.check() == l_false);
+
+    statistics st;
+    ctx.collect_statistics(st);
+    unsigned matches = 0, pattern_matches = 0, instances = 0;
+    VERIFY(find_stat(st, "qi fg matches", matches) == enabled);
+    VERIFY(find_stat(st, "qi fg pattern 0 matches", pattern_matches) == enabled);
+    VERIFY(find_stat(st, "qi fg instances", instances) == enabled);
+    if (enabled) {
+        VERIFY(matches > 0);
+        VERIFY(pattern_matches > 0);
+        VERIFY(instances > 0);
+        // zero values are not stored, so the cost is only reported because of the weight.
+        VERIFY(has_stat(st, "qi fg max cost"));
+    }
+}
 
 void tst_smt_context()
 {
@@ -26,4 +346,14 @@ void tst_smt_context()
     }
 
     ctx.check();
+
+    tst_parallel_matching();
+    tst_bv_lazy_blast();
+    tst_bv_word_propagation();
+    tst_bv_word_signed_propagation();
+    tst_copy();
+    tst_lemma_gc(false);
+    tst_lemma_gc(true);
+    tst_qi_stats(false);
+    tst_qi_stats(true);
 }
@@ -0,0 +1,71 @@
+#include"task_pool.h"
+#include"vector.h"
+#include"util.h"
+#include"debug.h"
+
+// Sums 0 ... n-1 by splitting the range recursively into nested batches.
+class range_sum_task : public task_pool::task {
+    unsigned           m_lo;
+    unsigned           m_hi;
+    unsigned long long m_sum;
+public:
+    range_sum_task(unsigned lo, unsigned hi):m_lo(lo), m_hi(hi), m_sum(0) {}
+
+    unsigned long long sum() const { return m_sum; }
+
+    virtual void run() {
+        if (m_hi - m_lo <= 64) {
+            for (unsigned i = m_lo; i < m_hi; i++)
+                m_sum += i;
+            return;
+        }
+        unsigned mid = m_lo + (m_hi - m_lo) / 2;
+        range_sum_task t1(m_lo, mid);
+        range_sum_task t2(mid, m_hi);
+        task_pool::task * ts[2] = { &t1, &t2 };
+        task_pool::execute(2, ts);
+        m_sum = t1.sum() + t2.sum();
+    }
+};
+
+class counter_task : public task_pool::task {
+    task_pool::mutex & m_mutex;
+    unsigned &         m_counter;
+public:
+    counter_task(task_pool::mutex & m, unsigned & c):m_mutex(m), m_counter(c) {}
+    virtual void run() {
+        for (unsigned i = 0; i < 1000; i++) {
+            task_pool::scoped_lock lock(m_mutex);
+            m_counter++;
+        }
+    }
+};
+
+static void tst_nested(unsigned max_threads) {
+    task_pool::set_max_threads(max_threads);
+    unsigned n = 100000;
+    range_sum_task t(0, n);
+    task_pool::task * ts[1] = { &t };
+    task_pool::execute(1, ts);
+    SASSERT(t.sum() == static_cast<unsigned long long>(n) * (n - 1) / 2);
+}
+
+static void tst_mutex(unsigned max_threads) {
+    task_pool::set_max_threads(max_threads);
+    task_pool::mutex m;
+    unsigned counter = 0;
+    ptr_vector<task_pool::task> tasks;
+    for (unsigned i = 0; i < 16; i++)
+        tasks.push_back(alloc(counter_task, m, counter));
+    task_pool::execute(tasks.size(), tasks.c_ptr());
+    SASSERT(counter == 16000);
+    std::for_each(tasks.begin(), tasks.end(), delete_proc<task_pool::task>());
+}
+
+void tst_task_pool() {
+    for (unsigned n = 1; n <= 8; n *= 2) {
+        tst_nested(n);
+        tst_mutex(n);
+    }
+    task_pool::set_max_threads(0);
+}
@@ -1,16 +1,74 @@
-
 #include "timeout.h"
 #include "trace.h"
+#include "debug.h"
+#include "util.h"
+#include "vector.h"
+#include "stopwatch.h"
+#include "event_handler.h"
+#include "scoped_timer.h"
 
-#ifdef _WINDOWS
+class record_eh : public event_handler {
+    unsigned           m_id;
+    unsigned volatile & m_num_fired;
+    unsigned *         m_order;
+public:
+    record_eh(unsigned id, unsigned volatile & num_fired, unsigned * order):
+        m_id(id), m_num_fired(num_fired), m_order(order) {}
+    void operator()() {
+        m_order[m_num_fired] = m_id;
+        m_num_fired = m_num_fired + 1;
+    }
+};
 
-#include <windows.h>
+// the event handler destroys its own timer.
+class self_delete_eh : public event_handler {
+public:
+    scoped_timer *      m_timer;
+    unsigned volatile & m_num_fired;
+    self_delete_eh(unsigned volatile & num_fired):m_timer(0), m_num_fired(num_fired) {}
+    void operator()() {
+        dealloc(m_timer);
+        m_timer = 0;
+        m_num_fired = m_num_fired + 1;
+    }
+};
 
-void tst_timeout() {
+static void wait_fired(unsigned volatile & num_fired, unsigned expected) {
+    stopwatch sw;
+    sw.start();
+    while (num_fired < expected && sw.get_current_seconds() < 10.0)
+        ;
 }
 
-#else
 void tst_timeout() {
-}
-
+    unsigned volatile num_fired = 0;
+    unsigned order[3] = { 0, 0, 0 };
+    // timers that are disarmed before they expire are never executed.
+    {
+        record_eh eh(100, num_fired, order);
+        ptr_vector<scoped_timer> timers;
+        for (unsigned i = 0; i < 1000; i++)
+            timers.push_back(alloc(scoped_timer, 60000 + i, &eh));
+        for (unsigned i = 0; i < 1000; i++)
+            dealloc(timers[i]);
+        scoped_timer zero(0, &eh);
+    }
+    // timers fire in the order of their deadlines, not of their creation.
+    record_eh eh1(1, num_fired, order), eh2(2, num_fired, order), eh3(3, num_fired, order);
+    {
+        scoped_timer t3(60, &eh3);
+        scoped_timer t1(20, &eh1);
+        scoped_timer t2(40, &eh2);
+        wait_fired(num_fired, 3);
+    }
+    VERIFY(num_fired == 3);
+    VERIFY(order[0] == 1 && order[1] == 2 && order[2] == 3);
+#ifndef _WINDOWS
+    {
+        self_delete_eh eh(num_fired);
+        eh.m_timer = alloc(scoped_timer, 10, &eh);
+        wait_fired(num_fired, 4);
+        VERIFY(num_fired == 4 && eh.m_timer == 0);
+    }
 #endif
+}
@@ -21,6 +21,7 @@ Notes:
 #include"gparams.h"
 #include"util.h"
 #include"memory_manager.h"
+#include"task_pool.h"
 
 void env_params::updt_params() {
     params_ref p = gparams::get();
@@ -28,6 +29,7 @@ void env_params::updt_params() {
     enable_warning_messages(p.get_bool("warning", true));
     memory::set_max_size(megabytes_to_bytes(p.get_uint("memory_max_size", 0)));
     memory::set_high_watermark(p.get_uint("memory_high_watermark", 0));
+    task_pool::set_max_threads(p.get_uint("max_threads", 0));
 }
 
 void env_params::collect_param_descrs(param_descrs & d) {
@@ -35,4 +37,5 @@ void env_params::collect_param_descrs(param_descrs & d) {
     d.insert("warning", CPK_BOOL, "enable/disable warning messages", "true");
     d.insert("memory_max_size", CPK_UINT, "set hard upper limit for memory consumption (in megabytes), if 0 then there is no limit", "0");
     d.insert("memory_high_watermark", CPK_UINT, "set high watermark for memory consumption (in megabytes), if 0 then there is no limit", "0");
+    d.insert("max_threads", CPK_UINT, "maximum number of threads used by parallel tactic combinators (par-or, par-then), if 0 then the number of processors is used", "0");
 }
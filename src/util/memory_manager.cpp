@@ -5,6 +5,24 @@
 #include"memory_manager.h"
 #include"error_codes.h"
 #include"z3_omp.h"
+
+// Z3 keeps per-thread allocation counters, and only adds them to the global counter 
+// (using atomic operations) when they exceed SYNCH_THRESHOLD.
+// The lock based version is only used when the compiler does not support thread local storage.
+#if defined(_WINDOWS) || defined(__GNUC__) || defined(_USE_THREAD_LOCAL)
+#define _THREAD_LOCAL_MEMORY_COUNTERS
+#endif
+
+#ifdef _THREAD_LOCAL_MEMORY_COUNTERS
+#ifdef _WINDOWS
+#include<windows.h>
+#define ATOMIC_ADD(_ptr_, _val_) (InterlockedExchangeAdd64(_ptr_, _val_) + (_val_))
+#define ATOMIC_CAS(_ptr_, _old_, _new_) (InterlockedCompareExchange64(_ptr_, _new_, _old_) == (_old_))
+#else
+#define ATOMIC_ADD(_ptr_, _val_) __sync_add_and_fetch(_ptr_, _val_)
+#define ATOMIC_CAS(_ptr_, _old_, _new_) __sync_bool_compare_and_swap(_ptr_, _old_, _new_)
+#endif
+#endif
 // The following two function are automatically generated by the mk_make.py script.
 // The script collects ADD_INITIALIZER and ADD_FINALIZER commands in the .h files.
 // For example, rational.h contains
@@ -29,14 +47,28 @@ out_of_memory_error::out_of_memory_error():z3_error(ERR_MEMOUT) {
 
 static volatile bool g_memory_out_of_memory  = false;
 static bool       g_memory_initialized       = false;
-static long long  g_memory_alloc_size        = 0;
+static volatile long long g_memory_alloc_size    = 0;
 static long long  g_memory_max_size          = 0;
-static long long  g_memory_max_used_size     = 0;
+static volatile long long g_memory_max_used_size = 0;
 static long long  g_memory_watermark         = 0;
 static bool       g_exit_when_out_of_memory  = false;
 static char const * g_out_of_memory_msg      = "ERROR: out of memory";
 static volatile bool g_memory_fully_initialized = false;
 
+#ifdef _THREAD_LOCAL_MEMORY_COUNTERS
+// We only integrate the local thread counters with the global one
+// when the local counter > SYNCH_THRESHOLD 
+#define SYNCH_THRESHOLD 100000
+
+#ifdef _WINDOWS
+// Actually this is VS specific instead of Windows specific.
+__declspec(thread) long long g_memory_thread_alloc_size    = 0;
+#else
+// GCC style
+__thread long long g_memory_thread_alloc_size    = 0;
+#endif
+#endif
+
 void memory::exit_when_out_of_memory(bool flag, char const * msg) {
     g_exit_when_out_of_memory = flag;
     if (flag && msg)
@@ -44,12 +76,7 @@ void memory::exit_when_out_of_memory(bool flag, char const * msg) {
 }
 
 static void throw_out_of_memory() {
-    #pragma omp critical (z3_memory_manager) 
-    {
-        if (!g_memory_out_of_memory) {
-            g_memory_out_of_memory = true;
-        }
-    }
+    g_memory_out_of_memory = true;
     if (g_exit_when_out_of_memory) {
         std::cerr << g_out_of_memory_msg << "\n";
         exit(ERR_MEMOUT);
@@ -99,12 +126,7 @@ void memory::initialize(size_t max_size) {
 }
 
 bool memory::is_out_of_memory() {
-    bool r = false;
-    #pragma omp critical (z3_memory_manager) 
-    {
-        r = g_memory_out_of_memory;
-    }
-    return r;
+    return g_memory_out_of_memory;
 }
 
 void memory::set_high_watermark(size_t watermark) {
@@ -115,12 +137,7 @@ void memory::set_high_watermark(size_t watermark) {
 bool memory::above_high_watermark() {
     if (g_memory_watermark == 0)
         return false;
-    bool r;
-    #pragma omp critical (z3_memory_manager) 
-    {
-        r = g_memory_watermark < g_memory_alloc_size;
-    }
-    return r;
+    return g_memory_watermark < static_cast<long long>(get_allocation_size());
 }
 
 void memory::set_max_size(size_t max_size) {
@@ -139,24 +156,23 @@ void memory::finalize() {
     }
 }
 
+/**
+   \brief Return the amount of allocated memory. It does not take the lock, and
+   the result is approximate: the counters of other threads are only added to
+   g_memory_alloc_size when they exceed SYNCH_THRESHOLD.
+*/
 unsigned long long memory::get_allocation_size() {
-    long long r;
-    #pragma omp critical (z3_memory_manager) 
-    {
-        r = g_memory_alloc_size;
-    }
+    long long r = g_memory_alloc_size;
+#ifdef _THREAD_LOCAL_MEMORY_COUNTERS
+    r += g_memory_thread_alloc_size;
+#endif
     if (r < 0)
         r = 0;
     return r;
 }
 
 unsigned long long memory::get_max_used_memory() {
-    unsigned long long r;
-    #pragma omp critical (z3_memory_manager) 
-    {
-        r = g_memory_max_used_size;
-    }
-    return r;
+    return g_memory_max_used_size;
 }
 
 void memory::display_max_usage(std::ostream & os) {
@@ -186,41 +202,24 @@ void * memory::allocate(char const* file, int line, char const* obj, size_t s) {
 }
 #endif
 
-#if defined(_WINDOWS) || defined(_USE_THREAD_LOCAL)
+#ifdef _THREAD_LOCAL_MEMORY_COUNTERS
 // ==================================
 // ==================================
 // THREAD LOCAL VERSION
 // ==================================
 // ==================================
 
-
-// We only integrate the local thread counters with the global one
-// when the local counter > SYNCH_THRESHOLD 
-#define SYNCH_THRESHOLD 100000
-
-#ifdef _WINDOWS
-// Actually this is VS specific instead of Windows specific.
-__declspec(thread) long long g_memory_thread_alloc_size    = 0;
-#else
-// GCC style
-__thread long long g_memory_thread_alloc_size    = 0;
-#endif
-
 static void synchronize_counters(bool allocating) {
 #ifdef PROFILE_MEMORY
     g_synch_counter++;
 #endif
 
-    bool out_of_mem = false;
-    #pragma omp critical (z3_memory_manager) 
-    {
-        g_memory_alloc_size += g_memory_thread_alloc_size;
-        if (g_memory_alloc_size > g_memory_max_used_size)
-            g_memory_max_used_size = g_memory_alloc_size;
-        if (g_memory_max_size != 0 && g_memory_alloc_size > g_memory_max_size)
-            out_of_mem = true;
-    }
+    long long sz = ATOMIC_ADD(&g_memory_alloc_size, g_memory_thread_alloc_size);
     g_memory_thread_alloc_size = 0;
+    long long max_sz = g_memory_max_used_size;
+    while (sz > max_sz && !ATOMIC_CAS(&g_memory_max_used_size, max_sz, sz))
+        max_sz = g_memory_max_used_size;
+    bool out_of_mem = g_memory_max_size != 0 && sz > g_memory_max_size;
     if (out_of_mem && allocating) {
         throw_out_of_memory();
     }
@@ -43,6 +43,15 @@ typedef unsigned digit_t;
 template<bool SYNCH> class mpz_manager;
 template<bool SYNCH> class mpq_manager;
 
+// Compilers that provide builtins for overflow checked arithmetic.
+#if defined(__GNUC__) && __GNUC__ >= 5
+#define _MPZ_OVERFLOW_BUILTINS
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) && __has_builtin(__builtin_mul_overflow)
+#define _MPZ_OVERFLOW_BUILTINS
+#endif
+#endif
+
 #if !defined(_MP_GMP) && !defined(_MP_MSBIGNUM) && !defined(_MP_INTERNAL)
 #ifdef _WINDOWS
 #define _MP_INTERNAL
@@ -75,9 +84,12 @@ class mpz_cell {
    If m_ptr == 0, the it is a small number and the value is stored at m_val.
    Otherwise, m_val contains the sign (-1 negative, 1 positive), and m_ptr points to a mpz_cell that
    store the value. <<< This last statement is true only in Windows.
+
+   Small numbers are in the range [-INT64_MAX, INT64_MAX]. INT64_MIN is not a small number,
+   thus neg and abs never overflow.
 */
 class mpz {
-    int        m_val; 
+    int64      m_val; 
 #ifndef _MP_GMP
     mpz_cell * m_ptr;
 #else
@@ -102,6 +114,15 @@ public:
 
 inline void swap(mpz & m1, mpz & m2) { m1.swap(m2); }
 
+/**
+   \brief Manager for multi-precision integers.
+   
+   When SYNCH is true, the manager can be shared by several threads. Moreover, 
+   the cells of big numbers are allocated in the global heap instead of m_allocator.
+   Thus, a number created by a synchronized manager can be deleted by any other 
+   synchronized manager, and different threads can use different managers for the 
+   same numbers.
+*/
 template<bool SYNCH = true>
 class mpz_manager {
     small_object_allocator  m_allocator;
@@ -114,13 +135,13 @@ class mpz_manager {
     unsigned                m_init_cell_capacity;
     mpz_cell *              m_tmp[2];
     mpz_cell *              m_arg[2];
-    mpz                     m_int_min;
     
     static unsigned cell_size(unsigned capacity) { return sizeof(mpz_cell) + sizeof(digit_t) * capacity; }
 
     mpz_cell * allocate(unsigned capacity) {
         SASSERT(capacity >= m_init_cell_capacity);
-        mpz_cell * cell  = reinterpret_cast<mpz_cell *>(m_allocator.allocate(cell_size(capacity)));
+        void * mem       = SYNCH ? memory::allocate(cell_size(capacity)) : m_allocator.allocate(cell_size(capacity));
+        mpz_cell * cell  = reinterpret_cast<mpz_cell *>(mem);
         cell->m_capacity = capacity;
         return cell;
     }
@@ -143,7 +164,10 @@ class mpz_manager {
     }
 
     void deallocate(mpz_cell * ptr) { 
-        m_allocator.deallocate(cell_size(ptr->m_capacity), ptr); 
+        if (SYNCH)
+            memory::deallocate(ptr);
+        else
+            m_allocator.deallocate(cell_size(ptr->m_capacity), ptr); 
     }
 
     /**
@@ -173,12 +197,19 @@ class mpz_manager {
     mpz_t     m_int64_min;
 
     mpz_t * allocate() {
-        mpz_t * cell = reinterpret_cast<mpz_t*>(m_allocator.allocate(sizeof(mpz_t)));
+        void * mem   = SYNCH ? memory::allocate(sizeof(mpz_t)) : m_allocator.allocate(sizeof(mpz_t));
+        mpz_t * cell = reinterpret_cast<mpz_t*>(mem);
         mpz_init(*cell);
         return cell;
     }
 
-    void deallocate(mpz_t * ptr) { mpz_clear(*ptr); m_allocator.deallocate(sizeof(mpz_t), ptr); }
+    void deallocate(mpz_t * ptr) { 
+        mpz_clear(*ptr); 
+        if (SYNCH)
+            memory::deallocate(ptr);
+        else
+            m_allocator.deallocate(sizeof(mpz_t), ptr); 
+    }
 #endif
     mpz                     m_two64;
 
@@ -189,14 +220,56 @@ class mpz_manager {
     template<int IDX>
     void set(mpz & a, int sign, unsigned sz);
 
-    static int64 i64(mpz const & a) { return static_cast<int64>(a.m_val); }
+    static int64 i64(mpz const & a) { return a.m_val; }
 
+public:
+    // Overflow checked operations on small numbers (they are not INT64_MIN). 
+    // They return false if the result does not fit in an int64.
+    // The generic versions are used when the compiler has no builtins for them.
+    static bool safe_add_generic(int64 a, int64 b, int64 & r) {
+        r = static_cast<int64>(static_cast<uint64>(a) + static_cast<uint64>(b));
+        return ((a ^ r) & (b ^ r)) >= 0;
+    }
+    static bool safe_sub_generic(int64 a, int64 b, int64 & r) {
+        r = static_cast<int64>(static_cast<uint64>(a) - static_cast<uint64>(b));
+        return ((a ^ b) & (a ^ r)) >= 0;
+    }
+    static bool safe_mul_generic(int64 a, int64 b, int64 & r) {
+        if (INT_MIN <= a && a <= INT_MAX && INT_MIN <= b && b <= INT_MAX) {
+            r = a * b;
+            return true;
+        }
+        // a and b are not INT64_MIN
+        uint64 ua = a < 0 ? static_cast<uint64>(-a) : static_cast<uint64>(a);
+        uint64 ub = b < 0 ? static_cast<uint64>(-b) : static_cast<uint64>(b);
+        if (ua == 0 || ub == 0) {
+            r = 0;
+            return true;
+        }
+        // the magnitude of a negative result can be 2^63
+        bool neg  = (a < 0) != (b < 0);
+        uint64 p  = ua * ub;
+        if (p / ub != ua || p > static_cast<uint64>(INT64_MAX) + (neg ? 1 : 0))
+            return false;
+        r = neg ? static_cast<int64>(0 - p) : static_cast<int64>(p);
+        return true;
+    }
+#ifdef _MPZ_OVERFLOW_BUILTINS
+    static bool safe_add(int64 a, int64 b, int64 & r) { return !__builtin_add_overflow(a, b, &r); }
+    static bool safe_sub(int64 a, int64 b, int64 & r) { return !__builtin_sub_overflow(a, b, &r); }
+    static bool safe_mul(int64 a, int64 b, int64 & r) { return !__builtin_mul_overflow(a, b, &r); }
+#else
+    static bool safe_add(int64 a, int64 b, int64 & r) { return safe_add_generic(a, b, r); }
+    static bool safe_sub(int64 a, int64 b, int64 & r) { return safe_sub_generic(a, b, r); }
+    static bool safe_mul(int64 a, int64 b, int64 & r) { return safe_mul_generic(a, b, r); }
+#endif
+private:
     void set_big_i64(mpz & c, int64 v);
 
     void set_i64(mpz & c, int64 v) { 
-        if (v >= INT_MIN && v <= INT_MAX) {
+        if (v != INT64_MIN) {
             del(c);
-            c.m_val = static_cast<int>(v); 
+            c.m_val = v; 
         }
         else {
             MPZ_BEGIN_CRITICAL();
@@ -238,25 +311,40 @@ class mpz_manager {
             return ((static_cast<uint64>(digits(a)[1]) << 32) | (static_cast<uint64>(digits(a)[0])));
     }
 
+    // Store the absolute value of the small number v in cell.
+    static void set_small_digits(mpz_cell * cell, int64 v) {
+        uint64 u = v < 0 ? static_cast<uint64>(-v) : static_cast<uint64>(v);
+        cell->m_digits[0] = static_cast<digit_t>(u);
+        if (sizeof(digit_t) == sizeof(uint64) || (u >> 32) == 0) {
+            cell->m_size = 1;
+        }
+        else {
+            cell->m_digits[1] = static_cast<digit_t>(u >> 32);
+            cell->m_size = 2;
+        }
+    }
+
+    // Return true if the number with sz digits ds fits in a small number, and store its absolute value in v.
+    static bool is_small_digits(unsigned sz, digit_t const * ds, int64 & v) {
+        uint64 u;
+        if (sz == 1)
+            u = ds[0];
+        else if (sz == 2 && sizeof(digit_t) < sizeof(uint64))
+            u = (static_cast<uint64>(ds[1]) << 32) | static_cast<uint64>(ds[0]);
+        else
+            return false;
+        if (u > static_cast<uint64>(INT64_MAX))
+            return false;
+        v = static_cast<int64>(u);
+        return true;
+    }
+
     template<int IDX>
     void get_sign_cell(mpz const & a, int & sign, mpz_cell * & cell) {
         if (is_small(a)) {
-            if (a.m_val == INT_MIN) {
-                sign = -1;
-                cell = m_int_min.m_ptr;
-            }
-            else {
-                cell = m_arg[IDX];
-                SASSERT(cell->m_size == 1);
-                if (a.m_val < 0) {
-                    sign = -1;
-                    cell->m_digits[0] = -a.m_val;
-                }
-                else {
-                    sign = 1;
-                    cell->m_digits[0] = a.m_val;
-                }
-            }
+            cell = m_arg[IDX];
+            sign = a.m_val < 0 ? -1 : 1;
+            set_small_digits(cell, a.m_val);
         }
         else {
             sign = a.m_val;
@@ -266,11 +354,26 @@ class mpz_manager {
 #else
     // GMP code
 
+    static void set_small(mpz_t & r, int64 v) {
+        if (sizeof(long) == sizeof(int64) || (INT_MIN <= v && v <= INT_MAX)) {
+            mpz_set_si(r, static_cast<long>(v));
+        }
+        else {
+            // long is 32 bits
+            uint64 u = v < 0 ? static_cast<uint64>(-v) : static_cast<uint64>(v);
+            mpz_set_ui(r, static_cast<unsigned>(u >> 32));
+            mpz_mul_2exp(r, r, 32);
+            mpz_add_ui(r, r, static_cast<unsigned>(u));
+            if (v < 0)
+                mpz_neg(r, r);
+        }
+    }
+
     template<int IDX>
     void get_arg(mpz const & a, mpz_t * & result) {
         if (is_small(a)) {
             result = m_arg[IDX];
-            mpz_set_si(*result, a.m_val);
+            set_small(*result, a.m_val);
         }
         else {
             result = a.m_ptr;
@@ -335,18 +438,18 @@ public:
     static mpz mk_z(int val) { return mpz(val); }
     
     void del(mpz & a) { 
+        // deallocate does not need the lock: synchronized managers use the global heap.
         if (a.m_ptr != 0) {
-            MPZ_BEGIN_CRITICAL();
             deallocate(a.m_ptr); 
-            MPZ_END_CRITICAL();
             a.m_ptr = 0; 
         } 
     }
     
     void add(mpz const & a, mpz const & b, mpz & c) {
         STRACE("mpz", tout << "[mpz] " << to_string(a) << " + " << to_string(b) << " == ";); 
-        if (is_small(a) && is_small(b)) {
-            set_i64(c, i64(a) + i64(b));
+        int64 r;
+        if (is_small(a) && is_small(b) && safe_add(i64(a), i64(b), r)) {
+            set_i64(c, r);
         }
         else {
             MPZ_BEGIN_CRITICAL();
@@ -358,8 +461,9 @@ public:
 
     void sub(mpz const & a, mpz const & b, mpz & c) {
         STRACE("mpz", tout << "[mpz] " << to_string(a) << " - " << to_string(b) << " == ";); 
-        if (is_small(a) && is_small(b)) {
-            set_i64(c, i64(a) - i64(b));
+        int64 r;
+        if (is_small(a) && is_small(b) && safe_sub(i64(a), i64(b), r)) {
+            set_i64(c, r);
         }
         else {
             MPZ_BEGIN_CRITICAL();
@@ -375,8 +479,9 @@ public:
 
     void mul(mpz const & a, mpz const & b, mpz & c) {
         STRACE("mpz", tout << "[mpz] " << to_string(a) << " * " << to_string(b) << " == ";); 
-        if (is_small(a) && is_small(b)) {
-            set_i64(c, i64(a) * i64(b));
+        int64 r;
+        if (is_small(a) && is_small(b) && safe_mul(i64(a), i64(b), r)) {
+            set_i64(c, r);
         }
         else {
             MPZ_BEGIN_CRITICAL();
@@ -495,11 +600,6 @@ public:
 
     void neg(mpz & a) {
         STRACE("mpz", tout << "[mpz] 0 - " << to_string(a) << " == ";); 
-        if (is_small(a) && a.m_val == INT_MIN) {
-            // neg(INT_MIN) is not a small int
-            set_big_i64(a, - static_cast<long long>(INT_MIN)); 
-            return;
-        }
 #ifndef _MP_GMP
         a.m_val = -a.m_val;
 #else
@@ -515,14 +615,8 @@ public:
 
     void abs(mpz & a) {
         if (is_small(a)) {
-            if (a.m_val < 0) {
-                if (a.m_val == INT_MIN) {
-                    // abs(INT_MIN) is not a small int
-                    set_big_i64(a, - static_cast<long long>(INT_MIN)); 
-                }
-                else
-                    a.m_val = -a.m_val;
-            }
+            if (a.m_val < 0)
+                a.m_val = -a.m_val;
         }
         else {
 #ifndef _MP_GMP
@@ -568,10 +662,10 @@ public:
 
     static int sign(mpz const & a) {
 #ifndef _MP_GMP
-        return a.m_val;
+        return a.m_val < 0 ? -1 : (a.m_val > 0 ? 1 : 0);
 #else
         if (is_small(a))
-            return a.m_val;
+            return a.m_val < 0 ? -1 : (a.m_val > 0 ? 1 : 0);
         else
             return mpz_sgn(*a.m_ptr);
 #endif
@@ -661,10 +755,8 @@ public:
     }
 
     void set(mpz & a, unsigned val) {
-        if (val <= INT_MAX)
-            set(a, static_cast<int>(val));
-        else
-            set(a, static_cast<int64>(static_cast<uint64>(val)));
+        del(a);
+        a.m_val = val;
     }
 
     void set(mpz & a, char const * val);
@@ -674,9 +766,9 @@ public:
     }
 
     void set(mpz & a, uint64 val) {
-        if (val < INT_MAX) {
+        if (val <= static_cast<uint64>(INT64_MAX)) {
             del(a);
-            a.m_val = static_cast<int>(val);
+            a.m_val = static_cast<int64>(val);
         }
         else {
             MPZ_BEGIN_CRITICAL();
@@ -23,7 +23,22 @@ Revision History:
 #include<strsafe.h>
 #endif
 
+#ifdef _THREAD_LOCAL_MPQ_MANAGER
+#ifdef _WINDOWS
+#include<windows.h>
+#else
+#include<pthread.h>
+#endif
+MPQ_THREAD_LOCAL synch_mpq_manager * rational::g_mpq_manager     = 0;
+MPQ_THREAD_LOCAL unsigned            rational::g_mpq_manager_gen = 0;
+unsigned                             rational::g_gen             = 1;
+// Managers created by the threads that used rational numbers.
+static ptr_vector<synch_mpq_manager> * g_mpq_managers      = 0;
+// Managers of the threads that exited. They are reused by new threads.
+static ptr_vector<synch_mpq_manager> * g_free_mpq_managers = 0;
+#else
 synch_mpq_manager *  rational::g_mpq_manager = 0;
+#endif
 rational             rational::m_zero(0);
 rational             rational::m_one(1);
 rational             rational::m_minus_one(-1);
@@ -53,6 +68,88 @@ rational rational::power_of_two(unsigned k) {
     return result;
 }
 
+#ifdef _THREAD_LOCAL_MPQ_MANAGER
+// The manager of a thread is released when the thread exits. The managers allocate the
+// cells of the numbers in the global heap, so the numbers of the thread remain valid.
+#ifdef _WINDOWS
+static DWORD g_mpq_manager_key = FLS_OUT_OF_INDEXES;
+#define MPQ_EXIT_CALLBACK VOID WINAPI
+#else
+static pthread_key_t g_mpq_manager_key;
+static bool          g_mpq_manager_key_created = false;
+#define MPQ_EXIT_CALLBACK void
+#endif
+
+void rational::release_manager() {
+    // managers of a previous generation were deleted by finalize.
+    if (g_mpq_manager_gen != g_gen)
+        return;
+    #pragma omp critical (rational_managers)
+    {
+        if (g_free_mpq_managers)
+            g_free_mpq_managers->push_back(g_mpq_manager);
+    }
+    g_mpq_manager_gen = 0;
+}
+
+static MPQ_EXIT_CALLBACK release_mpq_manager(void * m) {
+    if (m)
+        rational::release_manager();
+}
+
+synch_mpq_manager & rational::mk_manager() {
+    synch_mpq_manager * r = 0;
+    #pragma omp critical (rational_managers)
+    {
+        if (!g_mpq_managers) {
+            g_mpq_managers      = alloc(ptr_vector<synch_mpq_manager>);
+            g_free_mpq_managers = alloc(ptr_vector<synch_mpq_manager>);
+        }
+        if (!g_free_mpq_managers->empty()) {
+            r = g_free_mpq_managers->back();
+            g_free_mpq_managers->pop_back();
+        }
+        else {
+            r = alloc(synch_mpq_manager);
+            g_mpq_managers->push_back(r);
+        }
+    }
+    g_mpq_manager     = r;
+    g_mpq_manager_gen = g_gen;
+#ifdef _WINDOWS
+    if (g_mpq_manager_key != FLS_OUT_OF_INDEXES)
+        FlsSetValue(g_mpq_manager_key, r);
+#else
+    if (g_mpq_manager_key_created)
+        pthread_setspecific(g_mpq_manager_key, r);
+#endif
+    return *r;
+}
+
+void rational::initialize() {
+#ifdef _WINDOWS
+    if (g_mpq_manager_key == FLS_OUT_OF_INDEXES)
+        g_mpq_manager_key = FlsAlloc(release_mpq_manager);
+#else
+    if (!g_mpq_manager_key_created)
+        g_mpq_manager_key_created = pthread_key_create(&g_mpq_manager_key, release_mpq_manager) == 0;
+#endif
+    m();
+}
+
+void rational::finalize() {
+    m_powers_of_two.finalize();
+    // The other threads must not use rational numbers after this point.
+    g_gen++;
+    if (g_mpq_managers) {
+        std::for_each(g_mpq_managers->begin(), g_mpq_managers->end(), delete_proc<synch_mpq_manager>());
+        dealloc(g_mpq_managers);
+        dealloc(g_free_mpq_managers);
+        g_mpq_managers      = 0;
+        g_free_mpq_managers = 0;
+    }
+}
+#else
 void rational::initialize() {
     if (!g_mpq_manager) {
         g_mpq_manager = alloc(synch_mpq_manager);
@@ -64,4 +161,5 @@ void rational::finalize() {
     dealloc(g_mpq_manager);
     g_mpq_manager = 0;
 }
+#endif
 
@@ -21,15 +21,38 @@ Revision History:
 
 #include"mpq.h"
 
+#if defined(_WINDOWS) || defined(__GNUC__) || defined(_USE_THREAD_LOCAL)
+#define _THREAD_LOCAL_MPQ_MANAGER
+#ifdef _WINDOWS
+#define MPQ_THREAD_LOCAL __declspec(thread)
+#else
+#define MPQ_THREAD_LOCAL __thread
+#endif
+#endif
+
 class rational {
     mpq   m_val;
     static rational                  m_zero;
     static rational                  m_one;
     static rational                  m_minus_one;
     static vector<rational>          m_powers_of_two;
+#ifdef _THREAD_LOCAL_MPQ_MANAGER
+    // Each thread uses its own manager, so threads do not contend for the manager lock.
+    // Synchronized managers allocate cells in the global heap, so a rational created 
+    // in one thread can be copied and deleted in another one.
+    // g_mpq_manager is only valid when g_mpq_manager_gen == g_gen, and finalize() increments g_gen.
+    static MPQ_THREAD_LOCAL synch_mpq_manager * g_mpq_manager;
+    static MPQ_THREAD_LOCAL unsigned            g_mpq_manager_gen;
+    static unsigned                             g_gen;
+
+    static synch_mpq_manager & mk_manager();
+    
+    static synch_mpq_manager & m() { return g_mpq_manager_gen == g_gen ? *g_mpq_manager : mk_manager(); }
+#else
     static synch_mpq_manager *       g_mpq_manager;
     
     static synch_mpq_manager & m() { return *g_mpq_manager; }
+#endif
 
 public:
     static void initialize();
@@ -38,6 +61,13 @@ public:
       ADD_INITIALIZER('rational::initialize();')
       ADD_FINALIZER('rational::finalize();')
     */
+#ifdef _THREAD_LOCAL_MPQ_MANAGER
+    /**
+       \brief Release the manager of the current thread, so that other threads reuse it.
+       It is invoked when a thread exits.
+    */
+    static void release_manager();
+#endif
     rational() {}
     
     rational(rational const & r) { m().set(m_val, r.m_val); }
@@ -104,8 +134,7 @@ public:
     }
 
     bool is_int32() const {
-        if (is_small() && is_int()) return true; 
-        // we don't assume that if it is small, then it is int32.
+        // a small number is not necessarily an int32.
         if (!is_int64()) return false;
         int64 v = get_int64();
         return INT_MIN <= v && v <= INT_MAX;
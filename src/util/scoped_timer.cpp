@@ -26,27 +26,14 @@ Revision History:
 #if defined(_WINDOWS) || defined(_CYGWIN)
 // Windows
 #include<windows.h>
-#elif defined(__APPLE__) && defined(__MACH__)
-// Mac OS X
-#include<mach/mach.h>
-#include<mach/clock.h>
-#include<sys/time.h>
-#include<sys/errno.h>
+#elif (defined(__APPLE__) && defined(__MACH__)) || defined(_LINUX_) || defined(_FREEBSD_)
+// Mac OS X, Linux & FreeBSD
 #include<pthread.h>
-#elif defined(_LINUX_) || defined(_FREEBSD_)
-// Linux
-#include<csignal>
-#include<ctime>
-#include<memory.h>
-#include"warning.h"
-   #ifdef _LINUX_
-   #define CLOCKID CLOCK_PROCESS_CPUTIME_ID
-   #else
-   // FreeBSD does not support CLOCK_PROCESS_CPUTIME_ID 
-   #define CLOCKID CLOCK_MONOTONIC
-   #endif
-#define SIG     SIGRTMIN
-// ---------
+#include<errno.h>
+#include<time.h>
+#include<sys/time.h>
+#include<algorithm>
+#define _SCOPED_TIMER_THREAD
 #else
 // Other platforms
 #endif 
@@ -57,25 +44,232 @@ Revision History:
 #undef max
 #endif
 #include"util.h"
+#include"vector.h"
 #include<limits.h>
 #include"z3_omp.h"
 
+#ifdef _SCOPED_TIMER_THREAD
+/**
+   \brief Process-wide timer service. A single thread executes the event handlers
+   of all scoped_timers, instead of one thread per timer.
+
+   The armed timers are kept in a heap ordered by deadline, and the thread sleeps
+   until the earliest deadline. Disarming a timer that did not expire just marks it
+   as canceled. Canceled timers are reclaimed when they reach the top of the heap,
+   or when they are the majority of the heap.
+*/
+struct timer_entry {
+    unsigned long long m_deadline;  // in nanoseconds
+    event_handler *    m_eh;        // 0 if the timer was disarmed
+    bool               m_in_heap;
+    bool               m_disarmed_while_running;
+};
+
+struct timer_entry_gt {
+    bool operator()(timer_entry const * e1, timer_entry const * e2) const { return e1->m_deadline > e2->m_deadline; }
+};
+
+#define MIN_CANCELED_TO_PURGE 64
+
+class timer_service {
+    pthread_mutex_t          m_mutex;
+    pthread_cond_t           m_cond;         // the earliest deadline changed, or the service is stopping
+    pthread_cond_t           m_fired_cond;   // an event handler returned
+    pthread_t                m_thread;
+    bool                     m_thread_started;
+    bool                     m_stop;
+    ptr_vector<timer_entry>  m_heap;
+    ptr_vector<timer_entry>  m_free;
+    unsigned                 m_num_canceled; // canceled entries in m_heap
+    timer_entry *            m_running;      // entry whose event handler is being executed
+
+#if defined(__APPLE__) && defined(__MACH__)
+    // pthread_condattr_setclock is not available: use the calendar clock.
+    static unsigned long long now() {
+        struct timeval tv;
+        gettimeofday(&tv, 0);
+        return static_cast<unsigned long long>(tv.tv_sec) * 1000000000ull + static_cast<unsigned long long>(tv.tv_usec) * 1000ull;
+    }
+
+    void init_cond(pthread_cond_t & c) {
+        if (pthread_cond_init(&c, 0) != 0)
+            throw default_exception("failed to initialize timer condition variable");
+    }
+#else
+    static unsigned long long now() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<unsigned long long>(ts.tv_sec) * 1000000000ull + static_cast<unsigned long long>(ts.tv_nsec);
+    }
+
+    void init_cond(pthread_cond_t & c) {
+        pthread_condattr_t attr;
+        if (pthread_condattr_init(&attr) != 0 ||
+            pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0 ||
+            pthread_cond_init(&c, &attr) != 0)
+            throw default_exception("failed to initialize timer condition variable");
+        pthread_condattr_destroy(&attr);
+    }
+#endif
+
+    void free_entry(timer_entry * e) {
+        m_free.push_back(e);
+    }
+
+    void pop_top() {
+        std::pop_heap(m_heap.begin(), m_heap.end(), timer_entry_gt());
+        m_heap.pop_back();
+    }
+
+    void purge_canceled() {
+        unsigned j = 0;
+        for (unsigned i = 0; i < m_heap.size(); i++) {
+            timer_entry * e = m_heap[i];
+            if (e->m_eh == 0)
+                free_entry(e);
+            else
+                m_heap[j++] = e;
+        }
+        m_heap.shrink(j);
+        std::make_heap(m_heap.begin(), m_heap.end(), timer_entry_gt());
+        m_num_canceled = 0;
+    }
+
+    static void * thread_main(void * arg) {
+        static_cast<timer_service*>(arg)->loop();
+        return 0;
+    }
+
+    void loop() {
+        pthread_mutex_lock(&m_mutex);
+        while (!m_stop) {
+            if (m_heap.empty()) {
+                pthread_cond_wait(&m_cond, &m_mutex);
+                continue;
+            }
+            timer_entry * e = m_heap[0];
+            if (e->m_eh == 0) {
+                pop_top();
+                m_num_canceled--;
+                free_entry(e);
+                continue;
+            }
+            if (e->m_deadline > now()) {
+                struct timespec ts;
+                ts.tv_sec  = e->m_deadline / 1000000000ull;
+                ts.tv_nsec = e->m_deadline % 1000000000ull;
+                pthread_cond_timedwait(&m_cond, &m_mutex, &ts);
+                continue;
+            }
+            pop_top();
+            e->m_in_heap = false;
+            m_running    = e;
+            event_handler * eh = e->m_eh;
+            pthread_mutex_unlock(&m_mutex);
+            (*eh)();
+            pthread_mutex_lock(&m_mutex);
+            m_running = 0;
+            if (e->m_disarmed_while_running)
+                free_entry(e);
+            pthread_cond_broadcast(&m_fired_cond);
+        }
+        pthread_mutex_unlock(&m_mutex);
+    }
+
+public:
+    timer_service():
+        m_thread_started(false),
+        m_stop(false),
+        m_num_canceled(0),
+        m_running(0) {
+        if (pthread_mutex_init(&m_mutex, 0) != 0)
+            throw default_exception("failed to initialize timer mutex");
+        init_cond(m_cond);
+        init_cond(m_fired_cond);
+    }
+
+    ~timer_service() {
+        pthread_mutex_lock(&m_mutex);
+        m_stop = true;
+        pthread_cond_broadcast(&m_cond);
+        pthread_mutex_unlock(&m_mutex);
+        if (m_thread_started && !pthread_equal(pthread_self(), m_thread))
+            pthread_join(m_thread, 0);
+        std::for_each(m_heap.begin(), m_heap.end(), delete_proc<timer_entry>());
+        std::for_each(m_free.begin(), m_free.end(), delete_proc<timer_entry>());
+        pthread_cond_destroy(&m_fired_cond);
+        pthread_cond_destroy(&m_cond);
+        pthread_mutex_destroy(&m_mutex);
+    }
+
+    timer_entry * arm(unsigned ms, event_handler * eh) {
+        unsigned long long deadline = now() + static_cast<unsigned long long>(ms) * 1000000ull;
+        pthread_mutex_lock(&m_mutex);
+        if (!m_thread_started) {
+            if (pthread_create(&m_thread, 0, thread_main, this) != 0) {
+                pthread_mutex_unlock(&m_mutex);
+                throw default_exception("failed to start timer thread");
+            }
+            m_thread_started = true;
+        }
+        timer_entry * e;
+        if (m_free.empty()) {
+            e = alloc(timer_entry);
+        }
+        else {
+            e = m_free.back();
+            m_free.pop_back();
+        }
+        e->m_deadline = deadline;
+        e->m_eh       = eh;
+        e->m_in_heap  = true;
+        e->m_disarmed_while_running = false;
+        m_heap.push_back(e);
+        std::push_heap(m_heap.begin(), m_heap.end(), timer_entry_gt());
+        if (m_heap[0] == e)
+            pthread_cond_signal(&m_cond);
+        pthread_mutex_unlock(&m_mutex);
+        return e;
+    }
+
+    /**
+       \brief Disarm the timer e. When this method returns, the event handler of e is not
+       being executed, and it will not be executed, unless disarm is invoked by the
+       event handler of e itself.
+    */
+    void disarm(timer_entry * e) {
+        pthread_mutex_lock(&m_mutex);
+        if (m_running == e && pthread_equal(pthread_self(), m_thread)) {
+            e->m_eh = 0;
+            e->m_disarmed_while_running = true;
+            pthread_mutex_unlock(&m_mutex);
+            return;
+        }
+        while (m_running == e)
+            pthread_cond_wait(&m_fired_cond, &m_mutex);
+        e->m_eh = 0;
+        if (e->m_in_heap) {
+            m_num_canceled++;
+            if (m_num_canceled > MIN_CANCELED_TO_PURGE && 2 * m_num_canceled > m_heap.size())
+                purge_canceled();
+        }
+        else {
+            free_entry(e);
+        }
+        pthread_mutex_unlock(&m_mutex);
+    }
+};
+
+static timer_service * g_timer_service = 0;
+#endif
+
 struct scoped_timer::imp {
     event_handler *  m_eh;
 #if defined(_WINDOWS) || defined(_CYGWIN)
     HANDLE           m_timer;
     bool             m_first;
-#elif defined(__APPLE__) && defined(__MACH__)
-    // Mac OS X
-    pthread_t        m_thread_id;
-    pthread_attr_t   m_attributes;
-    unsigned         m_interval;    
-    pthread_mutex_t  m_mutex;
-    pthread_cond_t   m_condition_var;
-    struct timespec  m_end_time;
-#elif defined(_LINUX_) || defined(_FREEBSD_)
-    // Linux & FreeBSD
-    timer_t         m_timerid;
+#elif defined(_SCOPED_TIMER_THREAD)
+    timer_entry *    m_entry;
 #else
     // Other
 #endif
@@ -90,32 +284,8 @@ struct scoped_timer::imp {
             obj->m_eh->operator()();
         }
     }
-#elif defined(__APPLE__) && defined(__MACH__)
-    // Mac OS X
-    static void * thread_func(void * arg) {
-        scoped_timer::imp * st = static_cast<scoped_timer::imp*>(arg);  
-
-        pthread_mutex_lock(&st->m_mutex);
-
-        int e = pthread_cond_timedwait(&st->m_condition_var, &st->m_mutex, &st->m_end_time);
-        if (e != 0 && e != ETIMEDOUT)
-            throw default_exception("failed to start timed wait");
-        st->m_eh->operator()();
-
-        pthread_mutex_unlock(&st->m_mutex);
-
-        return st;
-    }
-#elif defined(_LINUX_) || defined(_FREEBSD_)
-    static void sig_handler(union sigval s) {
-        void * ptr = s.sival_ptr;
-        static_cast<imp*>(ptr)->m_eh->operator()();
-    }
-#else
-    // Other
 #endif
 
-
     imp(unsigned ms, event_handler * eh):
         m_eh(eh) {
 #if defined(_WINDOWS) || defined(_CYGWIN)
@@ -127,48 +297,14 @@ struct scoped_timer::imp {
                               0,				
                               ms,				
                               WT_EXECUTEINTIMERTHREAD);	
-#elif defined(__APPLE__) && defined(__MACH__)
-        // Mac OS X
-        m_interval = ms?ms:0xFFFFFFFF;
-        if (pthread_attr_init(&m_attributes) != 0)
-            throw default_exception("failed to initialize timer thread attributes");
-        if (pthread_cond_init(&m_condition_var, NULL) != 0)
-            throw default_exception("failed to initialize timer condition variable");
-        if (pthread_mutex_init(&m_mutex, NULL) != 0)
-            throw default_exception("failed to initialize timer mutex");
-
-        clock_serv_t host_clock;
-        mach_timespec_t now;
-        unsigned long long nano = static_cast<unsigned long long>(m_interval) * 1000000ull;
-        
-        host_get_clock_service(mach_host_self(), CALENDAR_CLOCK, &host_clock);
-        m_end_time.tv_sec  = nano / 1000000000ull;
-        m_end_time.tv_nsec = nano % 1000000000ull;
-        clock_get_time(host_clock, &now);
-        ADD_MACH_TIMESPEC(&m_end_time, &now);
-
-
-        if (pthread_create(&m_thread_id, &m_attributes, &thread_func, this) != 0)
-            throw default_exception("failed to start timer thread");
-#elif defined(_LINUX_) || defined(_FREEBSD_)
-	// Linux & FreeBSD
-	struct sigevent sev;
-        memset(&sev, 0, sizeof(sigevent));
-	sev.sigev_notify = SIGEV_THREAD;
-        sev.sigev_value.sival_ptr = this;
-        sev.sigev_notify_function = sig_handler;
-	if (timer_create(CLOCKID, &sev, &m_timerid) == -1)
-	    throw default_exception("failed to create timer");
-
-	unsigned long long nano = static_cast<unsigned long long>(ms) * 1000000ull;
-	struct itimerspec its;
-	its.it_value.tv_sec  = nano / 1000000000ull;
-	its.it_value.tv_nsec = nano % 1000000000ull;
-	its.it_interval.tv_sec  = 0; // timer experies once
-	its.it_interval.tv_nsec = 0;
-        
-	if (timer_settime(m_timerid, 0, &its, NULL) == -1)
-	    throw default_exception("failed to set timer");
+#elif defined(_SCOPED_TIMER_THREAD)
+        // Mac OS X, Linux & FreeBSD
+        #pragma omp critical (scoped_timer)
+        {
+            if (g_timer_service == 0)
+                g_timer_service = alloc(timer_service);
+        }
+        m_entry = g_timer_service->arm(ms, eh);
 #else
 	// Other platforms
 #endif
@@ -179,32 +315,9 @@ struct scoped_timer::imp {
         DeleteTimerQueueTimer(NULL,
                               m_timer,
                               INVALID_HANDLE_VALUE);
-#elif defined(__APPLE__) && defined(__MACH__)
-        // Mac OS X
-
-        // If the waiting-thread is not up and waiting yet, 
-        // we can make sure that it finishes quickly by 
-        // setting the end-time to zero.
-        m_end_time.tv_sec = 0;
-        m_end_time.tv_nsec = 0;
-
-        // Otherwise it's already up and waiting, and
-        // we can send a signal on m_condition_var:
-        pthread_mutex_lock(&m_mutex);
-        pthread_cond_signal(&m_condition_var);
-        pthread_mutex_unlock(&m_mutex);
-
-        if (pthread_join(m_thread_id, NULL) != 0)
-            throw default_exception("failed to join thread");
-        if (pthread_mutex_destroy(&m_mutex) != 0)
-            throw default_exception("failed to destroy pthread mutex");
-        if (pthread_cond_destroy(&m_condition_var) != 0)
-            throw default_exception("failed to destroy pthread condition variable");
-        if (pthread_attr_destroy(&m_attributes) != 0)
-            throw default_exception("failed to destroy pthread attributes object");
-#elif defined(_LINUX_) || defined(_FREEBSD_)
-	// Linux & FreeBSD
-	timer_delete(m_timerid);
+#elif defined(_SCOPED_TIMER_THREAD)
+        // Mac OS X, Linux & FreeBSD
+        g_timer_service->disarm(m_entry);
 #else
 	// Other Platforms
 #endif
@@ -213,7 +326,8 @@ struct scoped_timer::imp {
 };
 
 scoped_timer::scoped_timer(unsigned ms, event_handler * eh) {
-    if (ms != UINT_MAX)
+    // A zero timeout is never triggered.
+    if (ms != UINT_MAX && ms != 0)
         m_imp = alloc(imp, ms, eh);
     else
         m_imp = 0;
@@ -223,3 +337,12 @@ scoped_timer::~scoped_timer() {
     if (m_imp)
         dealloc(m_imp);
 }
+
+void scoped_timer::finalize() {
+#ifdef _SCOPED_TIMER_THREAD
+    if (g_timer_service) {
+        dealloc(g_timer_service);
+        g_timer_service = 0;
+    }
+#endif
+}
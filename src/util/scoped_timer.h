@@ -7,7 +7,9 @@ Module Name:
 
 Abstract:
 
-    <abstract>
+    Execute an event handler when a timeout expires, unless the
+    scoped_timer is destroyed before that. On Mac OS X, Linux and
+    FreeBSD all timers share a single thread.
 
 Author:
 
@@ -27,6 +29,11 @@ class scoped_timer {
 public:
     scoped_timer(unsigned ms, event_handler * eh);
     ~scoped_timer();
+    static void finalize();
 };
 
+/*
+  ADD_FINALIZER('scoped_timer::finalize();')
+*/
+
 #endif
@@ -0,0 +1,51 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    stream_buffer.cpp
+
+Abstract:
+
+    Simple stream buffer interface.
+
+Author:
+
+
+Revision History:
+
+--*/
+#include<stdio.h>
+#include"stream_buffer.h"
+#include"memory_manager.h"
+
+stream_buffer::stream_buffer(std::istream & s, bool interactive):
+    m_stream(s),
+    m_interactive(interactive),
+    m_buffer(0),
+    m_pos(0),
+    m_end(0) {
+    if (!m_interactive)
+        m_buffer = alloc_svect(char, STREAM_BUFFER_SIZE);
+    fill();
+}
+
+stream_buffer::~stream_buffer() {
+    if (m_buffer)
+        dealloc_svect(m_buffer);
+}
+
+void stream_buffer::fill() {
+    if (m_interactive) {
+        m_val = m_stream.get();
+        return;
+    }
+    m_stream.read(m_buffer, STREAM_BUFFER_SIZE);
+    unsigned sz = static_cast<unsigned>(m_stream.gcount());
+    m_pos = m_buffer;
+    m_end = m_buffer + sz;
+    if (sz == 0)
+        m_val = EOF;
+    else
+        m_val = static_cast<unsigned char>(*m_pos++);
+}
@@ -11,6 +11,10 @@ Abstract:
     In the future we should be able to read different kinds of stream (e.g., compressed files used
     in the SAT competitions).
 
+    The input is read in large blocks. Scanners may look directly at the
+    characters that are already in memory using pos() and end(), and skip
+    them using advance().
+
 Author:
 
     Leonardo de Moura (leonardo) 2006-10-02.
@@ -23,22 +27,52 @@ Revision History:
 
 #include<iostream>
 
+#define STREAM_BUFFER_SIZE (1 << 16)
+
 class stream_buffer {
     std::istream & m_stream;
-    int            m_val;
+    bool           m_interactive; // read one character at a time.
+    char *         m_buffer;
+    char const *   m_pos;         // next character in the buffer
+    char const *   m_end;
+    int            m_val;         // current character
+
+    void fill();
+
+    // not copyable
+    stream_buffer(stream_buffer const &);
+    stream_buffer & operator=(stream_buffer const &);
 public:
-    
-    stream_buffer(std::istream & s):
-        m_stream(s) {
-        m_val = m_stream.get();
-    }
 
-    int  operator *() const { 
+    stream_buffer(std::istream & s, bool interactive = false);
+
+    ~stream_buffer();
+
+    int  operator *() const {
         return m_val;
     }
 
-    void operator ++() { 
-        m_val = m_stream.get();
+    void operator ++() {
+        if (m_pos < m_end)
+            m_val = static_cast<unsigned char>(*m_pos++);
+        else
+            fill();
+    }
+
+    /**
+       \brief Characters after the current one that are already in memory.
+       The range is empty in interactive mode.
+    */
+    char const * pos() const { return m_pos; }
+    char const * end() const { return m_end; }
+
+    /**
+       \brief Skip the current character and the characters in [pos(), p).
+       The character at p becomes the current one.
+    */
+    void advance(char const * p) {
+        m_pos = p;
+        operator++();
     }
 };
 
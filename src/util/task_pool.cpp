@@ -0,0 +1,359 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    task_pool.cpp
+
+Abstract:
+
+    Global pool of worker threads for fork/join parallelism.
+
+    Tasks are coarse grained (e.g., complete tactic applications), so
+    the deques are protected by a single pool lock. A thread that waits
+    for a batch only picks up tasks of that batch or of batches nested
+    in it. Otherwise, a thread whose batch is done could be stuck
+    executing an unrelated, long running task.
+
+Author:
+
+Revision History:
+
+--*/
+#include<limits.h>
+#include<algorithm>
+#include"task_pool.h"
+#include"util.h"
+#include"vector.h"
+#include"z3_omp.h"
+
+#if !defined(_NO_OMP_) && (defined(_WINDOWS) || defined(__GNUC__) || defined(_USE_THREAD_LOCAL))
+#define _TASK_POOL_THREADS
+#endif
+
+#ifdef _TASK_POOL_THREADS
+#ifdef _WINDOWS
+#include<windows.h>
+#define TASK_POOL_THREAD_LOCAL __declspec(thread)
+
+struct native_mutex {
+    CRITICAL_SECTION m_cs;
+    native_mutex() { InitializeCriticalSection(&m_cs); }
+    ~native_mutex() { DeleteCriticalSection(&m_cs); }
+    void lock() { EnterCriticalSection(&m_cs); }
+    void unlock() { LeaveCriticalSection(&m_cs); }
+};
+
+struct native_condition {
+    CONDITION_VARIABLE m_cv;
+    native_condition() { InitializeConditionVariable(&m_cv); }
+    void wait(native_mutex & m) { SleepConditionVariableCS(&m_cv, &m.m_cs, INFINITE); }
+    void notify_all() { WakeAllConditionVariable(&m_cv); }
+};
+
+typedef HANDLE native_thread;
+#else
+#include<pthread.h>
+#define TASK_POOL_THREAD_LOCAL __thread
+
+struct native_mutex {
+    pthread_mutex_t m_mutex;
+    native_mutex() { pthread_mutex_init(&m_mutex, 0); }
+    ~native_mutex() { pthread_mutex_destroy(&m_mutex); }
+    void lock() { pthread_mutex_lock(&m_mutex); }
+    void unlock() { pthread_mutex_unlock(&m_mutex); }
+};
+
+struct native_condition {
+    pthread_cond_t m_cond;
+    native_condition() { pthread_cond_init(&m_cond, 0); }
+    ~native_condition() { pthread_cond_destroy(&m_cond); }
+    void wait(native_mutex & m) { pthread_cond_wait(&m_cond, &m.m_mutex); }
+    void notify_all() { pthread_cond_broadcast(&m_cond); }
+};
+
+typedef pthread_t native_thread;
+#endif
+#else
+struct native_mutex {
+    void lock() {}
+    void unlock() {}
+};
+#endif
+
+static unsigned g_max_threads = 0;
+
+void task_pool::set_max_threads(unsigned n) {
+    g_max_threads = n;
+}
+
+unsigned task_pool::get_max_threads() {
+#ifdef _TASK_POOL_THREADS
+    unsigned n = g_max_threads == 0 ? static_cast<unsigned>(omp_get_num_procs()) : g_max_threads;
+    return n == 0 ? 1 : n;
+#else
+    return 1;
+#endif
+}
+
+struct task_pool::mutex::imp {
+    native_mutex m_mutex;
+};
+
+task_pool::mutex::mutex():m_imp(alloc(imp)) {
+}
+
+task_pool::mutex::~mutex() {
+    dealloc(m_imp);
+}
+
+void task_pool::mutex::lock() {
+    m_imp->m_mutex.lock();
+}
+
+void task_pool::mutex::unlock() {
+    m_imp->m_mutex.unlock();
+}
+
+#ifdef _TASK_POOL_THREADS
+
+namespace {
+    /**
+       \brief Tasks submitted by a single call to task_pool::execute.
+    */
+    struct batch {
+        batch *  m_parent;  // batch of the task that submitted this one, 0 if none.
+        unsigned m_pending; // number of tasks that were not completed yet.
+        batch(batch * p, unsigned n):m_parent(p), m_pending(n) {}
+        bool is_nested_in(batch const * b) const {
+            for (batch const * curr = this; curr; curr = curr->m_parent)
+                if (curr == b)
+                    return true;
+            return false;
+        }
+    };
+
+    struct job {
+        task_pool::task * m_task;
+        batch *           m_batch;
+        job():m_task(0), m_batch(0) {}
+        job(task_pool::task * t, batch * b):m_task(t), m_batch(b) {}
+    };
+
+    /**
+       \brief The owner pushes and pops jobs at the back, thieves take them from the front.
+    */
+    struct job_deque {
+        svector<job> m_jobs;
+        unsigned     m_head;
+        job_deque():m_head(0) {}
+        bool empty() const { return m_head == m_jobs.size(); }
+        job const & back() const { return m_jobs.back(); }
+        job const & front() const { return m_jobs[m_head]; }
+        void push_back(job const & j) { m_jobs.push_back(j); }
+        void pop_back() { m_jobs.pop_back(); reset_if_empty(); }
+        void pop_front() { m_head++; reset_if_empty(); }
+        void reset_if_empty() {
+            if (empty()) {
+                m_jobs.reset();
+                m_head = 0;
+            }
+        }
+    };
+}
+
+// Deque of the current thread (UINT_MAX if it was not assigned yet), and
+// batch of the task being executed by the current thread.
+static TASK_POOL_THREAD_LOCAL unsigned g_deque_id = UINT_MAX;
+static TASK_POOL_THREAD_LOCAL batch *  g_batch    = 0;
+
+static task_pool::imp * g_task_pool = 0;
+
+struct task_pool::imp {
+    native_mutex              m_mutex;
+    native_condition          m_cond;
+    ptr_vector<job_deque>     m_deques;
+    svector<native_thread>    m_workers;
+    unsigned_vector           m_worker_deques; // deque of each worker
+    bool                      m_stop;
+
+    imp():m_stop(false) {}
+
+    ~imp() {
+        m_mutex.lock();
+        m_stop = true;
+        m_cond.notify_all();
+        m_mutex.unlock();
+        for (unsigned i = 0; i < m_workers.size(); i++) {
+#ifdef _WINDOWS
+            WaitForSingleObject(m_workers[i], INFINITE);
+            CloseHandle(m_workers[i]);
+#else
+            pthread_join(m_workers[i], 0);
+#endif
+        }
+        std::for_each(m_deques.begin(), m_deques.end(), delete_proc<job_deque>());
+    }
+
+    // The following methods must be invoked with m_mutex locked.
+
+    unsigned mk_deque() {
+        m_deques.push_back(alloc(job_deque));
+        return m_deques.size() - 1;
+    }
+
+    unsigned get_deque_id() {
+        if (g_deque_id == UINT_MAX)
+            g_deque_id = mk_deque();
+        return g_deque_id;
+    }
+
+    static bool can_run(job const & j, batch const * waiting_for) {
+        return waiting_for == 0 || j.m_batch->is_nested_in(waiting_for);
+    }
+
+    /**
+       \brief Pick a job for the thread owning deque \c id.
+       If \c waiting_for is not 0, then only jobs nested in this batch are considered.
+    */
+    bool find_job(unsigned id, batch const * waiting_for, job & r) {
+        job_deque & own = *(m_deques[id]);
+        if (!own.empty() && can_run(own.back(), waiting_for)) {
+            r = own.back();
+            own.pop_back();
+            return true;
+        }
+        unsigned sz = m_deques.size();
+        for (unsigned k = 1; k < sz; k++) {
+            job_deque & d = *(m_deques[(id + k) % sz]);
+            if (!d.empty() && can_run(d.front(), waiting_for)) {
+                r = d.front();
+                d.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void run_job(job const & j) {
+        batch * old_batch = g_batch;
+        g_batch = j.m_batch;
+        m_mutex.unlock();
+        j.m_task->run();
+        m_mutex.lock();
+        g_batch = old_batch;
+        SASSERT(j.m_batch->m_pending > 0);
+        j.m_batch->m_pending--;
+        if (j.m_batch->m_pending == 0)
+            m_cond.notify_all();
+    }
+
+    unsigned num_active_workers() const {
+        return get_max_threads() - 1;
+    }
+
+#ifdef _WINDOWS
+    static DWORD WINAPI worker_main(LPVOID arg) {
+#else
+    static void * worker_main(void * arg) {
+#endif
+        unsigned worker = static_cast<unsigned>(reinterpret_cast<size_t>(arg));
+        g_task_pool->worker_loop(worker);
+        return 0;
+    }
+
+    void worker_loop(unsigned worker) {
+        m_mutex.lock();
+        unsigned id = m_worker_deques[worker];
+        g_deque_id  = id;
+        while (!m_stop) {
+            job j;
+            // workers above the current cap stay idle
+            if (worker < num_active_workers() && find_job(id, 0, j))
+                run_job(j);
+            else
+                m_cond.wait(m_mutex);
+        }
+        m_mutex.unlock();
+    }
+
+    void ensure_workers() {
+        unsigned n = num_active_workers();
+        while (m_workers.size() < n) {
+            native_thread t;
+            void * arg = reinterpret_cast<void*>(static_cast<size_t>(m_workers.size()));
+            m_worker_deques.push_back(mk_deque());
+#ifdef _WINDOWS
+            t = CreateThread(NULL, 0, worker_main, arg, 0, NULL);
+            if (t == NULL) {
+                m_worker_deques.pop_back();
+                return;
+            }
+#else
+            if (pthread_create(&t, 0, worker_main, arg) != 0) {
+                m_worker_deques.pop_back();
+                return;
+            }
+#endif
+            m_workers.push_back(t);
+        }
+    }
+
+    void execute(unsigned num, task * const * ts) {
+        batch b(g_batch, num);
+        m_mutex.lock();
+        unsigned id = get_deque_id();
+        job_deque & d = *(m_deques[id]);
+        // ts[0] is at the back of the deque, that is, the owner starts with ts[0]
+        // and thieves with ts[num-1].
+        for (unsigned i = num; i-- > 0; )
+            d.push_back(job(ts[i], &b));
+        ensure_workers();
+        m_cond.notify_all();
+        while (b.m_pending > 0) {
+            job j;
+            if (find_job(id, &b, j))
+                run_job(j);
+            else
+                m_cond.wait(m_mutex);
+        }
+        m_mutex.unlock();
+    }
+};
+
+void task_pool::initialize() {
+    if (!g_task_pool)
+        g_task_pool = alloc(imp);
+}
+
+void task_pool::finalize() {
+    dealloc(g_task_pool);
+    g_task_pool = 0;
+}
+
+void task_pool::execute(unsigned num, task * const * ts) {
+    if (num > 1 && g_task_pool && get_max_threads() > 1) {
+        g_task_pool->execute(num, ts);
+        return;
+    }
+    for (unsigned i = 0; i < num; i++)
+        ts[i]->run();
+}
+
+#else
+
+struct task_pool::imp {
+};
+
+void task_pool::initialize() {
+}
+
+void task_pool::finalize() {
+}
+
+void task_pool::execute(unsigned num, task * const * ts) {
+    for (unsigned i = 0; i < num; i++)
+        ts[i]->run();
+}
+
+#endif
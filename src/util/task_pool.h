@@ -0,0 +1,88 @@
+/*++
+Copyright (c) 2014 Microsoft Corporation
+
+Module Name:
+
+    task_pool.h
+
+Abstract:
+
+    Global pool of worker threads for fork/join parallelism.
+    Each thread owns a deque of pending tasks; idle workers steal
+    from the other end of the deques of busy threads.
+    A thread waiting for a batch of tasks keeps executing pending
+    tasks of that batch (or of batches spawned by them), so batches
+    can be nested without blocking the pool.
+
+    The number of threads (including the thread that submits a batch)
+    is bounded by the global cap set with set_max_threads.
+    When Z3 is compiled without OpenMP (_NO_OMP_), tasks are executed
+    sequentially by the calling thread.
+
+Author:
+
+Revision History:
+
+--*/
+#ifndef _TASK_POOL_H_
+#define _TASK_POOL_H_
+
+class task_pool {
+public:
+    struct imp;
+
+    /**
+       \brief Unit of work. run() must not throw exceptions:
+       a task is responsible for catching and recording its own errors.
+    */
+    class task {
+    public:
+        virtual ~task() {}
+        virtual void run() = 0;
+    };
+
+    /**
+       \brief Mutual exclusion for data shared by the tasks of a batch.
+    */
+    class mutex {
+        struct imp;
+        imp * m_imp;
+    public:
+        mutex();
+        ~mutex();
+        void lock();
+        void unlock();
+    };
+
+    class scoped_lock {
+        mutex & m_mutex;
+    public:
+        scoped_lock(mutex & m):m_mutex(m) { m_mutex.lock(); }
+        ~scoped_lock() { m_mutex.unlock(); }
+    };
+
+    static void initialize();
+    static void finalize();
+
+    /**
+       \brief Set the maximum number of threads used to execute batches.
+       0 means the number of processors.
+    */
+    static void set_max_threads(unsigned n);
+    static unsigned get_max_threads();
+
+    /**
+       \brief Execute ts[0], ..., ts[num-1] and return when all of them are done.
+       The calling thread participates in the execution, starting with ts[0]
+       and continuing in order, while idle threads steal tasks starting from
+       ts[num-1]. So no order of execution should be assumed.
+    */
+    static void execute(unsigned num, task * const * ts);
+};
+
+/*
+  ADD_INITIALIZER('task_pool::initialize();')
+  ADD_FINALIZER('task_pool::finalize();')
+*/
+
+#endif